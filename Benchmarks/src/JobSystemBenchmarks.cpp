@@ -0,0 +1,86 @@
+// Project includes
+#include "MicroBenchmark.h"
+#include "JobSystem.h"
+
+// Standard includes
+#include <cmath>
+#include <vector>
+
+using namespace dae;
+using namespace dae::bench;
+
+namespace
+{
+    JobSystem& GetJobSystem()
+    {
+        static JobSystem jobSystem{};
+        return jobSystem;
+    }
+
+    // Some per-element math, roughly the weight of a vertex transform
+    inline float Work(float value)
+    {
+        return std::sqrt(value * value + 1.0f) * 0.5f + value;
+    }
+
+    void BM_SerialFor(State& state)
+    {
+        std::vector<float> values(static_cast<size_t>(state.GetArgument()), 1.0f);
+        while (state.KeepRunning())
+        {
+            for (float& value : values) value = Work(value);
+            DoNotOptimize(values.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_SerialFor, 1024, 65536, 1 << 20);
+
+    void BM_ParallelFor(State& state)
+    {
+        JobSystem& jobSystem{GetJobSystem()};
+        std::vector<float> values(static_cast<size_t>(state.GetArgument()), 1.0f);
+        while (state.KeepRunning())
+        {
+            jobSystem.ParallelFor(static_cast<uint32_t>(values.size()), 1024, [&values](uint32_t begin, uint32_t end, uint32_t)
+            {
+                for (uint32_t idx{begin}; idx < end; ++idx) values[idx] = Work(values[idx]);
+            });
+            DoNotOptimize(values.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_ParallelFor, 1024, 65536, 1 << 20);
+
+    // Pure scheduling cost: empty jobs, one per index
+    void BM_ScheduleEmptyJobs(State& state)
+    {
+        JobSystem& jobSystem{GetJobSystem()};
+        const auto count{static_cast<uint32_t>(state.GetArgument())};
+        while (state.KeepRunning())
+        {
+            jobSystem.ParallelFor(count, 1, [](uint32_t, uint32_t, uint32_t) {});
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_ScheduleEmptyJobs, 64, 1024);
+
+    // vertex -> bin -> raster -> resolve with empty stages, the fixed per-frame cost of a graph
+    void BM_JobGraphRun(State& state)
+    {
+        JobSystem& jobSystem{GetJobSystem()};
+        JobGraph graph{};
+        const auto vertex  = graph.AddNode([](uint32_t) {});
+        const auto bin     = graph.AddNode([](uint32_t) {});
+        const auto raster  = graph.AddNode([](uint32_t) {});
+        const auto resolve = graph.AddNode([](uint32_t) {});
+        graph.AddDependency(vertex, bin);
+        graph.AddDependency(bin, raster);
+        graph.AddDependency(raster, resolve);
+
+        while (state.KeepRunning())
+        {
+            graph.Run(jobSystem);
+        }
+    }
+    DAE_BENCHMARK(BM_JobGraphRun);
+}
@@ -0,0 +1,212 @@
+// Project includes
+#include "MicroBenchmark.h"
+#include "Maths.h"
+
+// Standard includes
+#include <random>
+#include <vector>
+
+using namespace dae;
+using namespace dae::bench;
+
+namespace
+{
+    // Same seed every run, so the inputs (and the branches they take) do not change between runs
+    std::vector<Vector3> CreateVector3s(size_t count)
+    {
+        std::mt19937 generator{42};
+        std::uniform_real_distribution<float> distribution{-100.0f, 100.0f};
+
+        std::vector<Vector3> vectors(count);
+        for (Vector3& vector : vectors)
+        {
+            vector = {distribution(generator), distribution(generator), distribution(generator)};
+        }
+        return vectors;
+    }
+
+    std::vector<Matrix> CreateMatrices(size_t count)
+    {
+        std::mt19937 generator{42};
+        std::uniform_real_distribution<float> angle{-PI, PI};
+        std::uniform_real_distribution<float> offset{-100.0f, 100.0f};
+
+        std::vector<Matrix> matrices(count);
+        for (Matrix& matrix : matrices)
+        {
+            // Rotation * translation, like a world matrix, always invertible
+            matrix = Matrix::CreateRotation(angle(generator), angle(generator), angle(generator))
+                   * Matrix::CreateTranslation(offset(generator), offset(generator), offset(generator));
+        }
+        return matrices;
+    }
+
+#pragma region Vector
+    void BM_Vector2Cross(State& state)
+    {
+        const std::vector<Vector3> inputs{CreateVector3s(static_cast<size_t>(state.GetArgument()) + 1)};
+        std::vector<Vector2> vectors(inputs.size());
+        for (size_t idx{0}; idx < inputs.size(); ++idx) vectors[idx] = inputs[idx].GetXY();
+
+        while (state.KeepRunning())
+        {
+            float sum{0.0f};
+            for (size_t idx{0}; idx + 1 < vectors.size(); ++idx) sum += Vector2::Cross(vectors[idx], vectors[idx + 1]);
+            DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_Vector2Cross, 4096);
+
+    void BM_Vector3Dot(State& state)
+    {
+        const std::vector<Vector3> vectors{CreateVector3s(static_cast<size_t>(state.GetArgument()) + 1)};
+        while (state.KeepRunning())
+        {
+            float sum{0.0f};
+            for (size_t idx{0}; idx + 1 < vectors.size(); ++idx) sum += Vector3::Dot(vectors[idx], vectors[idx + 1]);
+            DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_Vector3Dot, 4096);
+
+    void BM_Vector3Cross(State& state)
+    {
+        const std::vector<Vector3> vectors{CreateVector3s(static_cast<size_t>(state.GetArgument()) + 1)};
+        std::vector<Vector3> results(vectors.size() - 1);
+        while (state.KeepRunning())
+        {
+            for (size_t idx{0}; idx < results.size(); ++idx) results[idx] = Vector3::Cross(vectors[idx], vectors[idx + 1]);
+            DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_Vector3Cross, 4096);
+
+    void BM_Vector3Normalized(State& state)
+    {
+        const std::vector<Vector3> vectors{CreateVector3s(static_cast<size_t>(state.GetArgument()))};
+        std::vector<Vector3> results(vectors.size());
+        while (state.KeepRunning())
+        {
+            for (size_t idx{0}; idx < results.size(); ++idx) results[idx] = vectors[idx].Normalized();
+            DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_Vector3Normalized, 4096);
+
+    void BM_Vector3Reflect(State& state)
+    {
+        std::vector<Vector3> normals{CreateVector3s(static_cast<size_t>(state.GetArgument()))};
+        for (Vector3& normal : normals) normal.Normalize();
+        const std::vector<Vector3> vectors{CreateVector3s(normals.size())};
+        std::vector<Vector3> results(vectors.size());
+
+        while (state.KeepRunning())
+        {
+            for (size_t idx{0}; idx < results.size(); ++idx) results[idx] = Vector3::Reflect(vectors[idx], normals[idx]);
+            DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_Vector3Reflect, 4096);
+
+    void BM_Vector4Dot(State& state)
+    {
+        const std::vector<Vector3> inputs{CreateVector3s(static_cast<size_t>(state.GetArgument()) + 1)};
+        std::vector<Vector4> vectors(inputs.size());
+        for (size_t idx{0}; idx < inputs.size(); ++idx) vectors[idx] = {inputs[idx], 1.0f};
+
+        while (state.KeepRunning())
+        {
+            float sum{0.0f};
+            for (size_t idx{0}; idx + 1 < vectors.size(); ++idx) sum += Vector4::Dot(vectors[idx], vectors[idx + 1]);
+            DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_Vector4Dot, 4096);
+#pragma endregion
+
+#pragma region Matrix
+    void BM_MatrixMultiply(State& state)
+    {
+        const std::vector<Matrix> matrices{CreateMatrices(static_cast<size_t>(state.GetArgument()) + 1)};
+        std::vector<Matrix> results(matrices.size() - 1);
+        while (state.KeepRunning())
+        {
+            for (size_t idx{0}; idx < results.size(); ++idx) results[idx] = matrices[idx] * matrices[idx + 1];
+            DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_MatrixMultiply, 1024);
+
+    // The per-vertex hot path of every transform variant
+    void BM_MatrixTransformPoint(State& state)
+    {
+        const Matrix matrix{CreateMatrices(1).front()};
+        const std::vector<Vector3> inputs{CreateVector3s(static_cast<size_t>(state.GetArgument()))};
+        std::vector<Vector4> points(inputs.size());
+        for (size_t idx{0}; idx < inputs.size(); ++idx) points[idx] = {inputs[idx], 1.0f};
+        std::vector<Vector4> results(points.size());
+
+        while (state.KeepRunning())
+        {
+            for (size_t idx{0}; idx < results.size(); ++idx) results[idx] = matrix.TransformPoint(points[idx]);
+            DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_MatrixTransformPoint, 4096, 65536);
+
+    void BM_MatrixTransformVector(State& state)
+    {
+        const Matrix matrix{CreateMatrices(1).front()};
+        const std::vector<Vector3> vectors{CreateVector3s(static_cast<size_t>(state.GetArgument()))};
+        std::vector<Vector3> results(vectors.size());
+
+        while (state.KeepRunning())
+        {
+            for (size_t idx{0}; idx < results.size(); ++idx) results[idx] = matrix.TransformVector(vectors[idx]);
+            DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_MatrixTransformVector, 4096, 65536);
+
+    void BM_MatrixInverse(State& state)
+    {
+        const std::vector<Matrix> matrices{CreateMatrices(static_cast<size_t>(state.GetArgument()))};
+        std::vector<Matrix> results(matrices.size());
+        while (state.KeepRunning())
+        {
+            for (size_t idx{0}; idx < results.size(); ++idx) results[idx] = Matrix::Inverse(matrices[idx]);
+            DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_MatrixInverse, 1024);
+
+    // The overload the camera uses, it also hands back the up and right axes
+    void BM_MatrixCreateLookAtLH(State& state)
+    {
+        const std::vector<Vector3> origins{CreateVector3s(static_cast<size_t>(state.GetArgument()))};
+        std::vector<Vector3> forwards{CreateVector3s(origins.size())};
+        for (Vector3& forward : forwards) forward.Normalize();
+        std::vector<Matrix> results(origins.size());
+        Vector3 up{};
+        Vector3 right{};
+
+        while (state.KeepRunning())
+        {
+            for (size_t idx{0}; idx < results.size(); ++idx) results[idx] = Matrix::CreateLookAtLH(origins[idx], forwards[idx], up, right);
+            DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * state.GetArgument());
+    }
+    DAE_BENCHMARK(BM_MatrixCreateLookAtLH, 1024);
+#pragma endregion
+}
@@ -0,0 +1,162 @@
+#include "MicroBenchmark.h"
+
+// Standard includes
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+namespace dae::bench
+{
+    namespace
+    {
+        struct Entry
+        {
+            std::string          name      {};
+            BenchmarkFunction    function  {nullptr};
+            std::vector<int64_t> arguments {};
+        };
+
+        struct Result
+        {
+            std::string name           {};
+            int64_t     iterations     {0};
+            double      nsPerIteration {0.0};
+            double      itemsPerSecond {0.0};
+        };
+
+        std::vector<Entry>& GetRegistry()
+        {
+            static std::vector<Entry> registry{};
+            return registry;
+        }
+
+        /**
+         * \brief Grows the iteration count until one run takes at least minTime
+         */
+        Result Run(const std::string& name, BenchmarkFunction function, int64_t argument, double minTimeSec)
+        {
+            const double minTimeNs{minTimeSec * 1e9};
+
+            int64_t iterations{1};
+            while (true)
+            {
+                State state{iterations, argument};
+                function(state);
+
+                const double elapsedNs{std::max(state.GetElapsedNs(), 1.0)};
+                if (elapsedNs >= minTimeNs or iterations >= 1'000'000'000)
+                {
+                    Result result{};
+                    result.name           = name;
+                    result.iterations     = iterations;
+                    result.nsPerIteration = elapsedNs / static_cast<double>(iterations);
+                    result.itemsPerSecond = static_cast<double>(state.GetItemsProcessed()) * 1e9 / elapsedNs;
+                    return result;
+                }
+
+                // Aim a bit past the minimum, but never grow more than 10x at once
+                const double scale{std::clamp(minTimeNs * 1.4 / elapsedNs, 2.0, 10.0)};
+                iterations = static_cast<int64_t>(static_cast<double>(iterations) * scale);
+            }
+        }
+
+        bool WriteJson(const std::string& path, const std::vector<Result>& results)
+        {
+            std::ofstream file(path);
+            if (not file) return false;
+
+            file << "{\n"
+                 << "  \"context\": {\n"
+                 << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+#if defined(NDEBUG)
+                 << "    \"library_build_type\": \"release\"\n"
+#else
+                 << "    \"library_build_type\": \"debug\"\n"
+#endif
+                 << "  },\n"
+                 << "  \"benchmarks\": [\n";
+            for (size_t idx{0}; idx < results.size(); ++idx)
+            {
+                const Result& result{results[idx]};
+                file << "    {\"name\": \"" << result.name << "\", \"iterations\": " << result.iterations
+                     << ", \"real_time\": " << std::setprecision(10) << result.nsPerIteration << ", \"time_unit\": \"ns\"";
+                if (result.itemsPerSecond > 0.0)
+                {
+                    file << ", \"items_per_second\": " << result.itemsPerSecond;
+                }
+                file << "}" << (idx + 1 < results.size() ? "," : "") << "\n";
+            }
+            file << "  ]\n}\n";
+            return file.good();
+        }
+    }
+
+    State::State(int64_t iterations, int64_t argument) :
+        m_Iterations{iterations},
+        m_Argument{argument}
+    {
+    }
+
+    Registration::Registration(const char* name, BenchmarkFunction function, std::vector<int64_t> arguments)
+    {
+        GetRegistry().push_back(Entry{name, function, std::move(arguments)});
+    }
+
+    int RunBenchmarks(int argc, char* argv[])
+    {
+        std::string filter{};
+        std::string outputPath{};
+        double      minTimeSec{0.5};
+
+        for (int idx{1}; idx < argc; ++idx)
+        {
+            const std::string argument{argv[idx]};
+            const auto value = [&argument](const char* flag) { return argument.substr(std::strlen(flag)); };
+
+            if (argument.rfind("--benchmark_filter=", 0) == 0)        filter     = value("--benchmark_filter=");
+            else if (argument.rfind("--benchmark_out=", 0) == 0)      outputPath = value("--benchmark_out=");
+            else if (argument.rfind("--benchmark_min_time=", 0) == 0) minTimeSec = std::stod(value("--benchmark_min_time="));
+            else
+            {
+                std::cout << "Unknown argument: " << argument << '\n'
+                          << "Usage: Benchmarks [--benchmark_filter=<substring>] [--benchmark_min_time=<seconds>] [--benchmark_out=<file.json>]" << std::endl;
+                return 1;
+            }
+        }
+
+        std::cout << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(16) << "Time (ns)"
+                  << std::setw(14) << "Iterations" << std::setw(18) << "Items/s" << '\n'
+                  << std::string(96, '-') << std::endl;
+
+        std::vector<Result> results{};
+        for (const Entry& entry : GetRegistry())
+        {
+            std::vector<int64_t> arguments{entry.arguments};
+            if (arguments.empty()) arguments.push_back(0);
+
+            for (const int64_t argument : arguments)
+            {
+                const std::string name{entry.arguments.empty() ? entry.name : entry.name + "/" + std::to_string(argument)};
+                if (not filter.empty() and name.find(filter) == std::string::npos) continue;
+
+                const Result result{Run(name, entry.function, argument, minTimeSec)};
+                results.push_back(result);
+
+                std::cout << std::left << std::setw(48) << result.name << std::right << std::setw(16) << std::fixed << std::setprecision(1)
+                          << result.nsPerIteration << std::setw(14) << result.iterations << std::setw(18) << std::setprecision(0);
+                if (result.itemsPerSecond > 0.0) std::cout << result.itemsPerSecond;
+                std::cout << std::endl;
+            }
+        }
+
+        if (not outputPath.empty() and not WriteJson(outputPath, results))
+        {
+            std::cout << "Something went wrong. Results not written to " << outputPath << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+}
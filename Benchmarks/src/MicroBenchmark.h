@@ -0,0 +1,95 @@
+#pragma once
+
+// Standard includes
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace dae::bench
+{
+    /**
+     * \brief Loop state handed to a benchmark, Google Benchmark style:
+     * \code
+     * void BM_Something(State& state)
+     * {
+     *     // setup
+     *     while (state.KeepRunning()) { DoNotOptimize(Something()); }
+     * }
+     * \endcode
+     * Only the iterations of the KeepRunning loop are timed.
+     */
+    class State final
+    {
+    public:
+        State(int64_t iterations, int64_t argument);
+
+        inline bool KeepRunning()
+        {
+            if (m_Iteration == 0)
+            {
+                m_Start = Clock::now();
+            }
+            if (m_Iteration < m_Iterations)
+            {
+                ++m_Iteration;
+                return true;
+            }
+            m_End = Clock::now();
+            return false;
+        }
+
+        inline int64_t GetArgument()   const { return m_Argument;   }
+        inline int64_t GetIterations() const { return m_Iterations; }
+        inline double  GetElapsedNs()  const { return std::chrono::duration<double, std::nano>(m_End - m_Start).count(); }
+        inline int64_t GetItemsProcessed() const { return m_ItemsProcessed; }
+
+        // Items per iteration * iterations, reported as throughput
+        inline void SetItemsProcessed(int64_t items) { m_ItemsProcessed = items; }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        int64_t           m_Iterations     {0};
+        int64_t           m_Iteration      {0};
+        int64_t           m_Argument       {0};
+        int64_t           m_ItemsProcessed {0};
+        Clock::time_point m_Start          {};
+        Clock::time_point m_End            {};
+    };
+
+    using BenchmarkFunction = void(*)(State&);
+
+    /**
+     * \brief Static registration, see DAE_BENCHMARK
+     */
+    struct Registration final
+    {
+        Registration(const char* name, BenchmarkFunction function, std::vector<int64_t> arguments = {});
+    };
+
+    /**
+     * \brief Keeps the compiler from optimizing away a result
+     */
+    template <typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+#if defined(_MSC_VER)
+        static_cast<void>(*static_cast<const volatile char*>(static_cast<const volatile void*>(&value)));
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    // Runs all registered benchmarks, flags: --benchmark_filter=<substring> --benchmark_min_time=<seconds> --benchmark_out=<file.json>
+    int RunBenchmarks(int argc, char* argv[]);
+}
+
+// Registers a benchmark, optionally once per argument: DAE_BENCHMARK(BM_Something, 64, 4096)
+#define DAE_BENCHMARK(function, ...) \
+    static const dae::bench::Registration function##_registration{#function, function, {__VA_ARGS__}}
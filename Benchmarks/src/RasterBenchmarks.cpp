@@ -0,0 +1,85 @@
+// Project includes
+#include "MicroBenchmark.h"
+#include "Maths.h"
+
+// Standard includes
+#include <vector>
+
+using namespace dae;
+using namespace dae::bench;
+
+namespace
+{
+    // Every pixel center of a size x size bounding box around one triangle, about half of them inside
+    struct PointInTriangleInput
+    {
+        Vector2 v0{};
+        Vector2 v1{};
+        Vector2 v2{};
+        std::vector<Vector2> points{};
+    };
+
+    PointInTriangleInput CreatePointInTriangleInput(int size)
+    {
+        PointInTriangleInput input{};
+        // Clockwise on screen (y down), the winding the renderer rasterizes
+        input.v0 = {0.0f, 0.0f};
+        input.v1 = {static_cast<float>(size), static_cast<float>(size) * 0.5f};
+        input.v2 = {static_cast<float>(size) * 0.25f, static_cast<float>(size)};
+
+        input.points.reserve(static_cast<size_t>(size) * size);
+        for (int y{0}; y < size; ++y)
+        {
+            for (int x{0}; x < size; ++x)
+            {
+                input.points.emplace_back(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+            }
+        }
+        return input;
+    }
+
+    // Argument: bounding box size in pixels
+    void BM_IsPointInTriangle(State& state)
+    {
+        const PointInTriangleInput input{CreatePointInTriangleInput(static_cast<int>(state.GetArgument()))};
+        while (state.KeepRunning())
+        {
+            int inside{0};
+            for (const Vector2& point : input.points) inside += IsPointInTriangle(point, input.v0, input.v1, input.v2);
+            DoNotOptimize(inside);
+        }
+        state.SetItemsProcessed(state.GetIterations() * static_cast<int64_t>(input.points.size()));
+    }
+    DAE_BENCHMARK(BM_IsPointInTriangle, 16, 128);
+
+    void BM_IsPointInTriangleWeights(State& state)
+    {
+        const PointInTriangleInput input{CreatePointInTriangleInput(static_cast<int>(state.GetArgument()))};
+        while (state.KeepRunning())
+        {
+            int inside{0};
+            std::array<float, 3> weights{};
+            for (const Vector2& point : input.points)
+            {
+                inside += IsPointInTriangle(point, input.v0, input.v1, input.v2, weights);
+                DoNotOptimize(weights);
+            }
+            DoNotOptimize(inside);
+        }
+        state.SetItemsProcessed(state.GetIterations() * static_cast<int64_t>(input.points.size()));
+    }
+    DAE_BENCHMARK(BM_IsPointInTriangleWeights, 16, 128);
+
+    void BM_IsPointInTriangleFast(State& state)
+    {
+        const PointInTriangleInput input{CreatePointInTriangleInput(static_cast<int>(state.GetArgument()))};
+        while (state.KeepRunning())
+        {
+            int inside{0};
+            for (const Vector2& point : input.points) inside += IsPointInTriangleFast(point, input.v0, input.v1, input.v2);
+            DoNotOptimize(inside);
+        }
+        state.SetItemsProcessed(state.GetIterations() * static_cast<int64_t>(input.points.size()));
+    }
+    DAE_BENCHMARK(BM_IsPointInTriangleFast, 16, 128);
+}
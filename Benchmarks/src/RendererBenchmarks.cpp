@@ -0,0 +1,179 @@
+// Project includes
+#include "MicroBenchmark.h"
+#include "Renderer.h"
+#include "DataTypes.h"
+#include "PngImageLoader.h"
+#include "Utils.h"
+
+// Standard includes
+#include <iostream>
+#include <vector>
+
+using namespace dae;
+using namespace dae::bench;
+
+namespace dae
+{
+    /**
+     * \brief Calls the private transform and shading variants of a renderer, friend of Renderer
+     */
+    struct RendererKernels final
+    {
+        static void TransformV1(const Renderer& renderer, const std::vector<Vertex>& in, std::vector<Vertex>& out)     { renderer.TransformFromWorldToScreenV1(in, out); }
+        static void TransformV2(const Renderer& renderer, const std::vector<Vertex>& in, std::vector<Vertex_Out>& out) { renderer.TransformFromWorldToScreenV2(in, out); }
+        static void TransformV3(const Renderer& renderer, const std::vector<Vertex>& in, std::vector<Vertex_Out>& out) { renderer.TransformFromWorldToScreenV3(in, out); }
+        static void TransformV4(const Renderer& renderer, const std::vector<Vertex>& in, std::vector<Vertex_Out>& out) { renderer.TransformFromWorldToScreenV4(in, out); }
+        static void TransformV5(const Renderer& renderer, const std::vector<Vertex>& in, std::vector<Vertex_Out>& out) { renderer.TransformFromWorldToScreenV5(in, out); }
+
+        static void ShadeV0(const Renderer& renderer, const Vertex_Out& vertex, ColorRGB& color) { renderer.ShadePixelV0(vertex, color); }
+        static void ShadeV1(const Renderer& renderer, const Vertex_Out& vertex, ColorRGB& color, const ColorRGB& diffuse) { renderer.ShadePixelV1(vertex, color, diffuse); }
+        static void ShadeV2(const Renderer& renderer, const Vertex_Out& vertex, ColorRGB& color, const ColorRGB& diffuse, const ColorRGB& specular, float glossiness) { renderer.ShadePixelV2(vertex, color, diffuse, specular, glossiness); }
+        static void ShadeV3(const Renderer& renderer, const Vertex_Out& vertex, ColorRGB& color, const ColorRGB& diffuse, const ColorRGB& specular, float glossiness) { renderer.ShadePixelV3(vertex, color, diffuse, specular, glossiness); }
+    };
+}
+
+namespace
+{
+    // Window size of the application, the camera and viewport match a real frame
+    constexpr int s_Width  {640};
+    constexpr int s_Height {480};
+
+    const Renderer& GetRenderer()
+    {
+        static Renderer renderer{s_Width, s_Height, PngImageLoader{}};
+        static const bool isInitialized{[]
+        {
+            // Camera matrices and the frame copies, like the first headless frame
+            renderer.UpdateHeadless(0.0f);
+            return true;
+        }()};
+        static_cast<void>(isInitialized);
+        return renderer;
+    }
+
+    // The vehicle in its starting pose, the input of the final render path
+    const std::vector<Vertex>& GetVehicleVertices()
+    {
+        static const std::vector<Vertex> vertices{[]
+        {
+            std::vector<Vertex>   result{};
+            std::vector<uint32_t> indices{};
+            if (not Utils::ParseOBJ("Resources/vehicle.obj", result, indices))
+            {
+                std::cerr << "RendererBenchmarks: Resources/vehicle.obj not found, run from the output directory\n";
+            }
+            return result;
+        }()};
+        return vertices;
+    }
+
+    // Shading inputs of every vehicle vertex that survived V5, stand-ins for the interpolated pixels
+    const std::vector<Vertex_Out>& GetShadingInputs()
+    {
+        static const std::vector<Vertex_Out> pixels{[]
+        {
+            const std::vector<Vertex>& vertices{GetVehicleVertices()};
+            std::vector<Vertex_Out> transformed(vertices.size());
+            RendererKernels::TransformV5(GetRenderer(), vertices, transformed);
+
+            std::vector<Vertex_Out> result{};
+            result.reserve(transformed.size());
+            for (const Vertex_Out& vertex : transformed)
+            {
+                if (not vertex.isFrustumCulled) result.push_back(vertex);
+            }
+            return result;
+        }()};
+        return pixels;
+    }
+
+#pragma region Transform
+    template <typename VertexOut, typename Transform>
+    void TransformVehicle(State& state, const Transform& transform)
+    {
+        const Renderer& renderer{GetRenderer()};
+        const std::vector<Vertex>& vertices{GetVehicleVertices()};
+        std::vector<VertexOut> transformed(vertices.size());
+
+        while (state.KeepRunning())
+        {
+            transform(renderer, vertices, transformed);
+            DoNotOptimize(transformed.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * static_cast<int64_t>(vertices.size()));
+    }
+
+    void BM_TransformFromWorldToScreenV1(State& state) { TransformVehicle<Vertex>(state, RendererKernels::TransformV1); }
+    DAE_BENCHMARK(BM_TransformFromWorldToScreenV1);
+
+    void BM_TransformFromWorldToScreenV2(State& state) { TransformVehicle<Vertex_Out>(state, RendererKernels::TransformV2); }
+    DAE_BENCHMARK(BM_TransformFromWorldToScreenV2);
+
+    void BM_TransformFromWorldToScreenV3(State& state) { TransformVehicle<Vertex_Out>(state, RendererKernels::TransformV3); }
+    DAE_BENCHMARK(BM_TransformFromWorldToScreenV3);
+
+    void BM_TransformFromWorldToScreenV4(State& state) { TransformVehicle<Vertex_Out>(state, RendererKernels::TransformV4); }
+    DAE_BENCHMARK(BM_TransformFromWorldToScreenV4);
+
+    void BM_TransformFromWorldToScreenV5(State& state) { TransformVehicle<Vertex_Out>(state, RendererKernels::TransformV5); }
+    DAE_BENCHMARK(BM_TransformFromWorldToScreenV5);
+#pragma endregion
+
+#pragma region Shading
+    template <typename Shade>
+    void ShadeVehicle(State& state, const Shade& shade)
+    {
+        const Renderer& renderer{GetRenderer()};
+        const std::vector<Vertex_Out>& pixels{GetShadingInputs()};
+        std::vector<ColorRGB> colors(pixels.size());
+
+        while (state.KeepRunning())
+        {
+            for (size_t idx{0}; idx < pixels.size(); ++idx) shade(renderer, pixels[idx], colors[idx]);
+            DoNotOptimize(colors.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * static_cast<int64_t>(pixels.size()));
+    }
+
+    // Roughly the vehicle's texel values
+    const ColorRGB s_Diffuse    {0.6f, 0.6f, 0.65f};
+    const ColorRGB s_Specular   {0.3f, 0.3f, 0.3f};
+    constexpr float s_Glossiness{0.5f};
+
+    void BM_ShadePixelV0(State& state)
+    {
+        ShadeVehicle(state, [](const Renderer& renderer, const Vertex_Out& pixel, ColorRGB& color)
+        {
+            RendererKernels::ShadeV0(renderer, pixel, color);
+        });
+    }
+    DAE_BENCHMARK(BM_ShadePixelV0);
+
+    void BM_ShadePixelV1(State& state)
+    {
+        ShadeVehicle(state, [](const Renderer& renderer, const Vertex_Out& pixel, ColorRGB& color)
+        {
+            RendererKernels::ShadeV1(renderer, pixel, color, s_Diffuse);
+        });
+    }
+    DAE_BENCHMARK(BM_ShadePixelV1);
+
+    void BM_ShadePixelV2(State& state)
+    {
+        ShadeVehicle(state, [](const Renderer& renderer, const Vertex_Out& pixel, ColorRGB& color)
+        {
+            RendererKernels::ShadeV2(renderer, pixel, color, s_Diffuse, s_Specular, s_Glossiness);
+        });
+    }
+    DAE_BENCHMARK(BM_ShadePixelV2);
+
+    void BM_ShadePixelV3(State& state)
+    {
+        ShadeVehicle(state, [](const Renderer& renderer, const Vertex_Out& pixel, ColorRGB& color)
+        {
+            RendererKernels::ShadeV3(renderer, pixel, color, s_Diffuse, s_Specular, s_Glossiness);
+        });
+    }
+    DAE_BENCHMARK(BM_ShadePixelV3);
+#pragma endregion
+}
@@ -0,0 +1,84 @@
+// Project includes
+#include "MicroBenchmark.h"
+#include "Maths.h"
+#include "Texture.h"
+
+// Standard includes
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace dae;
+using namespace dae::bench;
+
+namespace
+{
+    constexpr size_t s_SampleCount{65536};
+
+    // Square checkerboard, the texel values do not matter, only the memory footprint
+    std::unique_ptr<Texture> CreateTexture(int size)
+    {
+        std::vector<uint32_t> texels(static_cast<size_t>(size) * size);
+        for (int y{0}; y < size; ++y)
+        {
+            for (int x{0}; x < size; ++x)
+            {
+                texels[static_cast<size_t>(y) * size + x] = ((x ^ y) & 8) ? 0xFFFFFFFFu : 0xFF000000u;
+            }
+        }
+        return std::unique_ptr<Texture>{Texture::Create(size, size, std::move(texels))};
+    }
+
+    // Row by row over the whole texture, like a screen-filling triangle
+    std::vector<Vector2> CreateCoherentUVs()
+    {
+        const auto side{static_cast<size_t>(std::sqrt(static_cast<float>(s_SampleCount)))};
+        std::vector<Vector2> uvs(side * side);
+        for (size_t y{0}; y < side; ++y)
+        {
+            for (size_t x{0}; x < side; ++x)
+            {
+                uvs[y * side + x] = {static_cast<float>(x) / static_cast<float>(side), static_cast<float>(y) / static_cast<float>(side)};
+            }
+        }
+        return uvs;
+    }
+
+    // Worst case for the cache, like a heavily minified texture
+    std::vector<Vector2> CreateRandomUVs()
+    {
+        std::mt19937 generator{42};
+        std::uniform_real_distribution<float> distribution{0.0f, 1.0f};
+
+        std::vector<Vector2> uvs(s_SampleCount);
+        for (Vector2& uv : uvs) uv = {distribution(generator), distribution(generator)};
+        return uvs;
+    }
+
+    void SampleAll(State& state, const std::vector<Vector2>& uvs)
+    {
+        const std::unique_ptr<Texture> texturePtr{CreateTexture(static_cast<int>(state.GetArgument()))};
+        std::vector<ColorRGB> results(uvs.size());
+
+        while (state.KeepRunning())
+        {
+            for (size_t idx{0}; idx < uvs.size(); ++idx) results[idx] = texturePtr->Sample(uvs[idx]);
+            DoNotOptimize(results.data());
+        }
+        state.SetItemsProcessed(state.GetIterations() * static_cast<int64_t>(uvs.size()));
+    }
+
+    // Argument: texture size
+    void BM_TextureSampleCoherent(State& state)
+    {
+        SampleAll(state, CreateCoherentUVs());
+    }
+    DAE_BENCHMARK(BM_TextureSampleCoherent, 256, 1024, 2048);
+
+    void BM_TextureSampleRandom(State& state)
+    {
+        SampleAll(state, CreateRandomUVs());
+    }
+    DAE_BENCHMARK(BM_TextureSampleRandom, 256, 1024, 2048);
+}
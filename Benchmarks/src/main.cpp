@@ -0,0 +1,7 @@
+// Project includes
+#include "MicroBenchmark.h"
+
+int main(int argc, char* argv[])
+{
+    return dae::bench::RunBenchmarks(argc, argv);
+}
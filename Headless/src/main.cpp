@@ -0,0 +1,512 @@
+// Headless entry point: renders a fixed number of frames into a plain memory frame buffer,
+// no window, no vsync, no present - the measured time is pure rendering cost.
+
+//Standard includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+
+//Project includes
+#include "AllocationTracker.h"
+#include "Benchmark.h"
+#include "BenchmarkComparison.h"
+#include "FrameBuffer.h"
+#include "FrameCapture.h"
+#include "GoldenImageTest.h"
+#include "PngImageLoader.h"
+#include "Profiler.h"
+#include "Recording.h"
+#include "Renderer.h"
+
+using namespace dae;
+
+namespace
+{
+    enum class OutputFormat
+    {
+        None,
+        BMP,
+        PPM,
+        Raw
+    };
+
+    struct Options
+    {
+        int          frames       {100};
+        int          width        {640};
+        int          height       {480};
+        int          saveEvery    {0};    // 0 = only the last frame
+        float        deltaTime    {1.0f / 60.0f};
+        float        budgetMs     {0.0f}; // 0 = fixed resolution
+        MathPrecision precision   {MathPrecision::Exact};
+        ToneMapping  toneMapping  {ToneMapping::MaxToOne};
+        bool         encodeSRGB   {false};
+        int          warmUpFrames {30};
+        std::string  benchmarkReport {};  // Empty = no benchmark
+        std::string  tracePath    {};     // Empty = no Chrome trace
+        std::string  recordPath   {};     // Empty = no recording
+        std::string  replayPath   {};     // Empty = no replay
+        std::string  goldenDirectory {};  // Empty = no golden image test
+        std::string  goldenOutput {"GoldenImages_Failed"};
+        int          tolerance    {2};
+        bool         bless        {false};
+        bool         verifyNoAlloc {false};
+        std::string  baselineResults  {}; // Empty = no comparison
+        std::string  candidateResults {};
+        BenchmarkComparison::Settings comparison {};
+        OutputFormat format       {OutputFormat::PPM};
+        std::string  outputPrefix {"Rasterizer_Headless"};
+        std::string  streamPath   {};     // Empty = no stream
+        CaptureFormat streamFormat {CaptureFormat::Y4M};
+    };
+
+    void PrintUsage()
+    {
+        std::cout << "Usage: Headless [options]\n"
+                  << "  --frames <n>       Number of frames to render (default 100)\n"
+                  << "  --width <px>       Frame buffer width (default 640)\n"
+                  << "  --height <px>      Frame buffer height (default 480)\n"
+                  << "  --dt <sec>         Fixed animation step per frame (default 1/60)\n"
+                  << "  --budget <ms>      Dynamic resolution with this raster budget (default 0: off)\n"
+                  << "  --math <precision> exact | fast per pixel math, see FastMath.h (default exact)\n"
+                  << "  --tonemap <op>     max | clamp | reinhard | aces color resolve (default max)\n"
+                  << "  --srgb             sRGB encode the resolved color\n"
+                  << "  --benchmark <path> Fixed camera path, --frames measured frames, report written to path\n"
+                  << "                     (.json / .csv: per-frame results with the run's context instead of the text report)\n"
+                  << "  --warmup <n>       Frames rendered before a benchmark measures (default 30)\n"
+                  << "  --trace <path>     Write the profiler zones of every frame as a Chrome trace\n"
+                  << "  --record <path>    Record camera, animation step and settings of every rendered frame\n"
+                  << "  --replay <path>    Render the frames of a recording (F1 in the application records one) instead of --frames\n"
+                  << "  --golden <dir>     Compare every shading mode at fixed poses against the reference images in dir\n"
+                  << "                     (not in the repository: bless them on the machine that runs the test, a missing one fails)\n"
+                  << "  --golden-out <dir> Frames and diff images of the failed cases (default GoldenImages_Failed)\n"
+                  << "  --tolerance <n>    Per channel difference a golden image pixel may have (default 2)\n"
+                  << "  --bless            With --golden: write the reference images instead of comparing\n"
+                  << "  --verify-no-alloc  Exit code 1 when a frame after the warm-up allocates on the heap\n"
+                  << "  --compare <baseline> <candidate>\n"
+                  << "                     Compare two benchmark results (.json / .csv), exit code 1 on a significant regression\n"
+                  << "  --confidence <c>   With --compare: confidence level of the intervals (default 0.95)\n"
+                  << "  --min-effect <pct> With --compare: smallest delta that counts as a change (default 1)\n"
+                  << "  --resamples <n>    With --compare: bootstrap resamples (default 2000)\n"
+                  << "  --format <fmt>     none | bmp | ppm | raw (default ppm)\n"
+                  << "  --output <prefix>  Output file prefix (default Rasterizer_Headless)\n"
+                  << "  --save-every <n>   Also write every n-th frame (default 0: last frame only)\n"
+                  << "  --stream <path>    Write every frame to one file or named pipe on the capture thread, e.g. for ffmpeg\n"
+                  << "                     (frames of another size than the first, see --budget, are dropped)\n"
+                  << "  --stream-format <fmt> y4m | raw (rgba8) (default y4m)\n";
+    }
+
+    bool ParseOptions(int argc, char* args[], Options& options)
+    {
+        for (int idx{1}; idx < argc; ++idx)
+        {
+            const std::string arg{args[idx]};
+            const bool hasValue{idx + 1 < argc};
+
+            if (arg == "--help" or arg == "-h")
+            {
+                return false;
+            }
+            if (arg == "--bless")
+            {
+                options.bless = true;
+                continue;
+            }
+            if (arg == "--srgb")
+            {
+                options.encodeSRGB = true;
+                continue;
+            }
+            if (arg == "--verify-no-alloc")
+            {
+                options.verifyNoAlloc = true;
+                continue;
+            }
+            if (arg == "--compare")
+            {
+                if (idx + 2 >= argc)
+                {
+                    std::cout << "--compare needs a baseline and a candidate\n";
+                    return false;
+                }
+                options.baselineResults  = args[++idx];
+                options.candidateResults = args[++idx];
+                continue;
+            }
+            if (not hasValue)
+            {
+                std::cout << "Missing value for " << arg << '\n';
+                return false;
+            }
+
+            const char* value{args[++idx]};
+            if      (arg == "--frames")     options.frames       = std::atoi(value);
+            else if (arg == "--width")      options.width        = std::atoi(value);
+            else if (arg == "--height")     options.height       = std::atoi(value);
+            else if (arg == "--dt")         options.deltaTime    = static_cast<float>(std::atof(value));
+            else if (arg == "--budget")     options.budgetMs     = static_cast<float>(std::atof(value));
+            else if (arg == "--benchmark")  options.benchmarkReport = value;
+            else if (arg == "--warmup")     options.warmUpFrames = std::atoi(value);
+            else if (arg == "--trace")      options.tracePath    = value;
+            else if (arg == "--record")     options.recordPath   = value;
+            else if (arg == "--replay")     options.replayPath   = value;
+            else if (arg == "--golden")     options.goldenDirectory = value;
+            else if (arg == "--golden-out") options.goldenOutput = value;
+            else if (arg == "--tolerance")  options.tolerance    = std::atoi(value);
+            else if (arg == "--save-every") options.saveEvery    = std::atoi(value);
+            else if (arg == "--confidence") options.comparison.confidence       = std::atof(value);
+            else if (arg == "--min-effect") options.comparison.minEffectPercent = std::atof(value);
+            else if (arg == "--resamples")  options.comparison.resamples        = std::atoi(value);
+            else if (arg == "--output")     options.outputPrefix = value;
+            else if (arg == "--stream")     options.streamPath   = value;
+            else if (arg == "--math")
+            {
+                if      (std::strcmp(value, "exact") == 0) options.precision = MathPrecision::Exact;
+                else if (std::strcmp(value, "fast")  == 0) options.precision = MathPrecision::Fast;
+                else
+                {
+                    std::cout << "Unknown math precision: " << value << '\n';
+                    return false;
+                }
+            }
+            else if (arg == "--tonemap")
+            {
+                if      (std::strcmp(value, "max")      == 0) options.toneMapping = ToneMapping::MaxToOne;
+                else if (std::strcmp(value, "clamp")    == 0) options.toneMapping = ToneMapping::Clamp;
+                else if (std::strcmp(value, "reinhard") == 0) options.toneMapping = ToneMapping::Reinhard;
+                else if (std::strcmp(value, "aces")     == 0) options.toneMapping = ToneMapping::ACES;
+                else
+                {
+                    std::cout << "Unknown tone mapping: " << value << '\n';
+                    return false;
+                }
+            }
+            else if (arg == "--stream-format")
+            {
+                if      (std::strcmp(value, "y4m") == 0) options.streamFormat = CaptureFormat::Y4M;
+                else if (std::strcmp(value, "raw") == 0) options.streamFormat = CaptureFormat::Raw;
+                else
+                {
+                    std::cout << "Unknown stream format: " << value << '\n';
+                    return false;
+                }
+            }
+            else if (arg == "--format")
+            {
+                if      (std::strcmp(value, "none") == 0) options.format = OutputFormat::None;
+                else if (std::strcmp(value, "bmp")  == 0) options.format = OutputFormat::BMP;
+                else if (std::strcmp(value, "ppm")  == 0) options.format = OutputFormat::PPM;
+                else if (std::strcmp(value, "raw")  == 0) options.format = OutputFormat::Raw;
+                else
+                {
+                    std::cout << "Unknown format: " << value << '\n';
+                    return false;
+                }
+            }
+            else
+            {
+                std::cout << "Unknown option: " << arg << '\n';
+                return false;
+            }
+        }
+
+        if (not options.replayPath.empty() and not options.benchmarkReport.empty())
+        {
+            std::cout << "--replay and --benchmark both decide the frames, use one of them\n";
+            return false;
+        }
+
+        // These grow their own data every frame, that would be reported as the frame loop's
+        if (options.verifyNoAlloc and (not options.recordPath.empty() or not options.tracePath.empty() or options.saveEvery > 0 or not options.streamPath.empty()))
+        {
+            std::cout << "--verify-no-alloc can not be combined with --record, --trace, --save-every or --stream\n";
+            return false;
+        }
+        if (options.verifyNoAlloc and not AllocationTracker::IsEnabled())
+        {
+            std::cout << "--verify-no-alloc needs ENABLE_ALLOCATION_TRACKING\n";
+            return false;
+        }
+
+        return options.frames > 0 and options.width > 0 and options.height > 0 and options.tolerance >= 0 and options.tolerance <= 255
+           and options.comparison.confidence > 0.0 and options.comparison.confidence < 1.0 and options.comparison.resamples > 0;
+    }
+
+    bool SaveFrame(const FrameBuffer& frameBuffer, const Options& options, int frame)
+    {
+        const std::string path{options.outputPrefix + "_" + std::to_string(frame)};
+        switch (options.format)
+        {
+        case OutputFormat::BMP:
+            return frameBuffer.SaveToBMP(path + ".bmp");
+        case OutputFormat::PPM:
+            return frameBuffer.SaveToPPM(path + ".ppm");
+        case OutputFormat::Raw:
+            return frameBuffer.SaveColorRaw(path + "_color.raw") and frameBuffer.SaveDepthRaw(path + "_depth.raw");
+        case OutputFormat::None:
+            break;
+        }
+        return true;
+    }
+
+    void StartTrace(const Options& options)
+    {
+        if (options.tracePath.empty()) return;
+
+        PROFILE_THREAD("Main");
+        const int warmUpFrames{options.benchmarkReport.empty() ? 0 : options.warmUpFrames};
+        Profiler::Get().StartCapture(static_cast<uint32_t>(options.frames + warmUpFrames));
+    }
+
+    void SaveTrace(const Options& options)
+    {
+        if (options.tracePath.empty()) return;
+
+        if (not Profiler::Get().SaveChromeTrace(options.tracePath))
+        {
+            std::cout << "Something went wrong. Chrome trace not saved!" << std::endl;
+        }
+    }
+
+    // Names the tags of the first frame that allocated after the warm-up, later ones only count
+    void CheckAllocations(const Renderer& renderer, int frame, uint64_t& steadyStateAllocations)
+    {
+        const uint64_t allocations{renderer.GetSteadyStateHeapAllocations()};
+        if (allocations == steadyStateAllocations) return;
+
+        if (steadyStateAllocations == 0)
+        {
+            const AllocationFrame& allocationFrame{AllocationTracker::GetLastFrame()};
+            std::cout << "Frame " << frame << " allocated " << allocationFrame.total.allocations << " times (" << allocationFrame.total.bytes << " bytes):";
+            for (int idx{0}; idx < allocationFrame.tagCount; ++idx)
+            {
+                const TaggedAllocationCounts& tag{allocationFrame.tags[idx]};
+                if (tag.allocations > 0)
+                {
+                    std::cout << ' ' << tag.tag << ' ' << tag.allocations << " (" << tag.bytes << " bytes)";
+                }
+            }
+            std::cout << '\n';
+        }
+        steadyStateAllocations = allocations;
+    }
+
+    int RunGoldenImageTest(Renderer& renderer, const Options& options)
+    {
+        GoldenImageTest::Settings settings{};
+        settings.referenceDirectory = options.goldenDirectory;
+        settings.outputDirectory    = options.goldenOutput;
+        settings.tolerance          = static_cast<uint8_t>(options.tolerance);
+        settings.bless              = options.bless;
+
+        GoldenImageTest test{renderer, settings};
+        return test.Run() ? 0 : 1;
+    }
+
+    int RunComparison(const Options& options)
+    {
+        BenchmarkResults baseline{};
+        BenchmarkResults candidate{};
+        if (not BenchmarkResults::Load(options.baselineResults, baseline))
+        {
+            std::cout << "Could not read " << options.baselineResults << std::endl;
+            return 2;
+        }
+        if (not BenchmarkResults::Load(options.candidateResults, candidate))
+        {
+            std::cout << "Could not read " << options.candidateResults << std::endl;
+            return 2;
+        }
+
+        const std::vector<MetricComparison> comparisons{BenchmarkComparison::Compare(baseline, candidate, options.comparison)};
+        BenchmarkComparison::WriteReport(std::cout, baseline, candidate, comparisons, options.comparison);
+        return BenchmarkComparison::HasRegression(comparisons) ? 1 : 0;
+    }
+
+    int RunBenchmark(Renderer& renderer, Recording& recording, const Options& options)
+    {
+        Benchmark::Settings settings{};
+        settings.warmUpFrames   = options.warmUpFrames;
+        settings.measuredFrames = options.frames;
+        settings.deltaTime      = options.deltaTime;
+
+        Benchmark benchmark{renderer, settings};
+        benchmark.Start();
+
+        int frame{0};
+        uint64_t steadyStateAllocations{0};
+        while (benchmark.IsRunning())
+        {
+            const float elapsedSec{benchmark.BeginFrame()};
+            recording.RecordFrame(elapsedSec);
+            renderer.UpdateHeadless(elapsedSec);
+            renderer.Render();
+            renderer.EndFrame();
+            if (options.verifyNoAlloc) CheckAllocations(renderer, frame, steadyStateAllocations);
+            benchmark.EndFrame(renderer.GetFrameTimings());
+            ++frame;
+        }
+
+        if (not SaveFrame(renderer.GetFrameBuffer(), options, frame - 1))
+        {
+            std::cout << "Something went wrong. Frame " << frame - 1 << " not saved!" << std::endl;
+        }
+        if (not benchmark.SaveReport(options.benchmarkReport))
+        {
+            std::cout << "Something went wrong. Benchmark report not saved!" << std::endl;
+            return 1;
+        }
+        return options.verifyNoAlloc and steadyStateAllocations > 0 ? 1 : 0;
+    }
+}
+
+int main(int argc, char* args[])
+{
+    Options options{};
+    if (not ParseOptions(argc, args, options))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    // Only reads files, nothing is rendered
+    if (not options.baselineResults.empty())
+    {
+        return RunComparison(options);
+    }
+
+    const auto rendererPtr = new Renderer(options.width, options.height, PngImageLoader{});
+    // Every frame below is rendered on this thread
+    rendererPtr->InitializeRenderThread();
+    if (options.budgetMs > 0.0f)
+    {
+        rendererPtr->SetDynamicResolution(true, options.budgetMs);
+    }
+    rendererPtr->SetMathPrecision(options.precision);
+    rendererPtr->SetColorResolve(options.toneMapping, options.encodeSRGB);
+
+    if (not options.goldenDirectory.empty())
+    {
+        const int result{RunGoldenImageTest(*rendererPtr, options)};
+        delete rendererPtr;
+        return result;
+    }
+
+    // A replay decides the frames: how many, the camera and the animation step of each
+    Recording recording{*rendererPtr};
+    if (not options.replayPath.empty())
+    {
+        if (not recording.StartReplay(options.replayPath) or recording.GetFrameCount() == 0)
+        {
+            std::cout << "Something went wrong. Recording not loaded!" << std::endl;
+            delete rendererPtr;
+            return 1;
+        }
+        options.frames = static_cast<int>(recording.GetFrameCount());
+    }
+    else if (not options.recordPath.empty())
+    {
+        recording.StartRecording();
+    }
+
+    StartTrace(options);
+
+    if (not options.benchmarkReport.empty())
+    {
+        const int result{RunBenchmark(*rendererPtr, recording, options)};
+        SaveTrace(options);
+        if (recording.IsRecording() and not recording.StopRecording(options.recordPath))
+        {
+            std::cout << "Something went wrong. Recording not saved!" << std::endl;
+        }
+        delete rendererPtr;
+        return result;
+    }
+
+    using Clock = std::chrono::high_resolution_clock;
+    double totalMs{0.0};
+    double minMs{std::numeric_limits<double>::max()};
+    double maxMs{0.0};
+    uint64_t steadyStateAllocations{0};
+
+    // Offline: every frame has to end up in the stream, Submit waits for the writer instead of dropping
+    FrameCapture* capturePtr{nullptr};
+    if (not options.streamPath.empty())
+    {
+        FrameCapture::Settings settings{};
+        settings.format       = options.streamFormat;
+        settings.streamPath   = options.streamPath;
+        settings.frameRate    = std::max(1, static_cast<int>(std::lround(1.0f / options.deltaTime)));
+        settings.backpressure = FrameCapture::Backpressure::Wait;
+        capturePtr = new FrameCapture(options.width, options.height, settings);
+    }
+
+    for (int frame{0}; frame < options.frames; ++frame)
+    {
+        //--------- Update ---------
+        const float elapsedSec{recording.IsReplaying() ? recording.ReplayFrame() : options.deltaTime};
+        recording.RecordFrame(elapsedSec);
+        rendererPtr->UpdateHeadless(elapsedSec);
+
+        //--------- Render ---------
+        const auto start{Clock::now()};
+        rendererPtr->Render();
+        const double frameMs{std::chrono::duration<double, std::milli>(Clock::now() - start).count()};
+        rendererPtr->EndFrame();
+        if (options.verifyNoAlloc) CheckAllocations(*rendererPtr, frame, steadyStateAllocations);
+
+        totalMs += frameMs;
+        minMs = std::min(minMs, frameMs);
+        maxMs = std::max(maxMs, frameMs);
+
+        //--------- Output ---------
+        if (capturePtr) capturePtr->Submit(rendererPtr->GetFrameBuffer());
+
+        const bool isLastFrame{frame == options.frames - 1};
+        const bool isSaveFrame{options.saveEvery > 0 and frame % options.saveEvery == 0};
+        if (isLastFrame or isSaveFrame)
+        {
+            if (not SaveFrame(rendererPtr->GetFrameBuffer(), options, frame))
+            {
+                std::cout << "Something went wrong. Frame " << frame << " not saved!" << std::endl;
+            }
+        }
+    }
+
+    std::cout << "FRAMES = " << options.frames << '\n'
+              << "RESOLUTION = " << options.width << "x" << options.height << '\n'
+              << "RENDER RESOLUTION (last frame) = " << rendererPtr->GetResolutionStats().width << "x" << rendererPtr->GetResolutionStats().height << '\n'
+              << "MIN = " << minMs << " ms\n"
+              << "MAX = " << maxMs << " ms\n"
+              << "AVG = " << totalMs / options.frames << " ms\n"
+              << "ARENA ALLOCATIONS (after warm-up) = " << rendererPtr->GetSteadyStateArenaAllocations() << '\n'
+              << "HEAP ALLOCATIONS (after warm-up) = " << rendererPtr->GetSteadyStateHeapAllocations() << std::endl;
+    SaveTrace(options);
+
+    if (capturePtr)
+    {
+        capturePtr->Flush();
+        std::cout << "STREAM = " << options.streamPath << " (" << FrameCapture::GetFormatName(options.streamFormat) << ")\n"
+                  << "STREAM FRAMES WRITTEN = " << capturePtr->GetFramesWritten() << '\n'
+                  << "STREAM FRAMES DROPPED = " << capturePtr->GetFramesDropped() << std::endl;
+        if (capturePtr->GetFramesFailed() > 0)
+        {
+            std::cout << "Something went wrong. " << capturePtr->GetFramesFailed() << " frames not written to the stream!" << std::endl;
+        }
+    }
+
+    if (recording.IsRecording() and not recording.StopRecording(options.recordPath))
+    {
+        std::cout << "Something went wrong. Recording not saved!" << std::endl;
+    }
+
+    //Shutdown "framework"
+    delete capturePtr;
+    delete rendererPtr;
+    return options.verifyNoAlloc and steadyStateAllocations > 0 ? 1 : 0;
+}
@@ -0,0 +1,254 @@
+#include "AllocationTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace dae
+{
+    namespace
+    {
+        constexpr int s_MaxTags{AllocationFrame::s_MaxTags};
+
+        // Constant initialized: operator new can run before any constructor of this file
+        struct TagSlot
+        {
+            std::atomic<const char*> name        {nullptr};
+            std::atomic<uint64_t>    allocations {0};
+            std::atomic<uint64_t>    bytes       {0};
+        };
+
+        TagSlot               s_Tags[s_MaxTags] {};
+        std::atomic<int>      s_TagCount        {1};
+        std::mutex            s_TagMutex        {}; // Guards registration, lookups only read
+        std::atomic<uint64_t> s_Allocations     {0};
+        std::atomic<uint64_t> s_Bytes           {0};
+        std::atomic<uint64_t> s_Frees           {0};
+
+        thread_local int t_CurrentTagIndex{0};
+
+        // Cumulative counts at the previous EndFrame
+        AllocationCounts s_FrameStart                   {};
+        uint64_t         s_FrameStartTags[s_MaxTags][2] {}; // Allocations, bytes
+        AllocationFrame  s_LastFrame                    {};
+
+        constexpr const char* s_UntaggedName{"Untagged"};
+
+        void* AllocateRaw(size_t bytes, size_t alignment)
+        {
+            if (bytes == 0) bytes = 1;
+            if (alignment <= alignof(std::max_align_t)) return std::malloc(bytes);
+#if defined(_MSC_VER)
+            return _aligned_malloc(bytes, alignment);
+#else
+            // aligned_alloc wants a multiple of the alignment
+            return std::aligned_alloc(alignment, (bytes + alignment - 1) & ~(alignment - 1));
+#endif
+        }
+
+        void FreeRaw(void* ptr, size_t alignment)
+        {
+#if defined(_MSC_VER)
+            if (alignment > alignof(std::max_align_t))
+            {
+                _aligned_free(ptr);
+                return;
+            }
+#else
+            (void)alignment;
+#endif
+            std::free(ptr);
+        }
+    }
+
+    void* AllocationTracker::Allocate(size_t bytes, size_t alignment, const char* tag)
+    {
+        void* ptr{AllocateRaw(bytes, alignment)};
+        if (not ptr) throw std::bad_alloc{};
+
+        OnAllocate(bytes, GetTagIndex(tag));
+        return ptr;
+    }
+
+    void AllocationTracker::Free(void* ptr, size_t alignment)
+    {
+        if (not ptr) return;
+
+        OnFree();
+        FreeRaw(ptr, alignment);
+    }
+
+    int AllocationTracker::GetTagIndex(const char* tag)
+    {
+        if (not tag) return 0;
+
+        const auto findTag = [tag](int tagCount)
+        {
+            for (int idx{1}; idx < tagCount; ++idx)
+            {
+                const char* name{s_Tags[idx].name.load(std::memory_order_acquire)};
+                if (name == tag or (name and std::strcmp(name, tag) == 0)) return idx;
+            }
+            return -1;
+        };
+
+        const int tagIndex{findTag(s_TagCount.load(std::memory_order_acquire))};
+        if (tagIndex >= 0) return tagIndex;
+
+        const std::lock_guard lock{s_TagMutex};
+        const int tagCount{s_TagCount.load(std::memory_order_relaxed)};
+        if (const int registeredIndex{findTag(tagCount)}; registeredIndex >= 0) return registeredIndex;
+
+        // Full: booked as untagged rather than dropped
+        if (tagCount == s_MaxTags) return 0;
+
+        s_Tags[tagCount].name.store(tag, std::memory_order_release);
+        s_TagCount.store(tagCount + 1, std::memory_order_release);
+        return tagCount;
+    }
+
+    int AllocationTracker::GetCurrentTagIndex()
+    {
+        return t_CurrentTagIndex;
+    }
+
+    void AllocationTracker::SetCurrentTagIndex(int tagIndex)
+    {
+        t_CurrentTagIndex = tagIndex;
+    }
+
+    void AllocationTracker::OnAllocate(size_t bytes, int tagIndex)
+    {
+        s_Allocations.fetch_add(1, std::memory_order_relaxed);
+        s_Bytes.fetch_add(bytes, std::memory_order_relaxed);
+        s_Tags[tagIndex].allocations.fetch_add(1, std::memory_order_relaxed);
+        s_Tags[tagIndex].bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void AllocationTracker::OnFree()
+    {
+        s_Frees.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void AllocationTracker::EndFrame()
+    {
+        const AllocationCounts total{GetTotal()};
+        s_LastFrame.total.allocations = total.allocations - s_FrameStart.allocations;
+        s_LastFrame.total.bytes       = total.bytes - s_FrameStart.bytes;
+        s_LastFrame.total.frees       = total.frees - s_FrameStart.frees;
+        s_FrameStart = total;
+
+        s_LastFrame.tagCount = s_TagCount.load(std::memory_order_acquire);
+        for (int idx{0}; idx < s_LastFrame.tagCount; ++idx)
+        {
+            const uint64_t allocations{s_Tags[idx].allocations.load(std::memory_order_relaxed)};
+            const uint64_t bytes{s_Tags[idx].bytes.load(std::memory_order_relaxed)};
+
+            TaggedAllocationCounts& tag{s_LastFrame.tags[idx]};
+            tag.tag         = idx == 0 ? s_UntaggedName : s_Tags[idx].name.load(std::memory_order_relaxed);
+            tag.allocations = allocations - s_FrameStartTags[idx][0];
+            tag.bytes       = bytes - s_FrameStartTags[idx][1];
+
+            s_FrameStartTags[idx][0] = allocations;
+            s_FrameStartTags[idx][1] = bytes;
+        }
+    }
+
+    AllocationCounts AllocationTracker::GetTotal()
+    {
+        AllocationCounts total{};
+        total.allocations = s_Allocations.load(std::memory_order_relaxed);
+        total.bytes       = s_Bytes.load(std::memory_order_relaxed);
+        total.frees       = s_Frees.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    const AllocationFrame& AllocationTracker::GetLastFrame()
+    {
+        return s_LastFrame;
+    }
+
+    uint64_t AllocationTracker::GetLiveAllocations()
+    {
+        const AllocationCounts total{GetTotal()};
+        return total.allocations - total.frees;
+    }
+}
+
+#if ENABLE_ALLOCATION_TRACKING
+#pragma region Global operator new/delete
+namespace
+{
+    void* TrackedNew(size_t bytes, size_t alignment)
+    {
+        for (;;)
+        {
+            if (void* ptr{dae::AllocateRaw(bytes, alignment)})
+            {
+                dae::AllocationTracker::OnAllocate(bytes, dae::AllocationTracker::GetCurrentTagIndex());
+                return ptr;
+            }
+
+            const std::new_handler handler{std::get_new_handler()};
+            if (not handler) throw std::bad_alloc{};
+            handler();
+        }
+    }
+
+    void* TrackedNewNoThrow(size_t bytes, size_t alignment) noexcept
+    {
+        try
+        {
+            return TrackedNew(bytes, alignment);
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+
+    void TrackedDelete(void* ptr, size_t alignment) noexcept
+    {
+        dae::AllocationTracker::Free(ptr, alignment);
+    }
+
+    constexpr size_t s_DefaultAlignment{alignof(std::max_align_t)};
+}
+
+void* operator new(size_t bytes)                                                    { return TrackedNew(bytes, s_DefaultAlignment); }
+void* operator new[](size_t bytes)                                                  { return TrackedNew(bytes, s_DefaultAlignment); }
+void* operator new(size_t bytes, std::align_val_t alignment)                        { return TrackedNew(bytes, static_cast<size_t>(alignment)); }
+void* operator new[](size_t bytes, std::align_val_t alignment)                      { return TrackedNew(bytes, static_cast<size_t>(alignment)); }
+void* operator new(size_t bytes, const std::nothrow_t&) noexcept                    { return TrackedNewNoThrow(bytes, s_DefaultAlignment); }
+void* operator new[](size_t bytes, const std::nothrow_t&) noexcept                  { return TrackedNewNoThrow(bytes, s_DefaultAlignment); }
+void* operator new(size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return TrackedNewNoThrow(bytes, static_cast<size_t>(alignment));
+}
+void* operator new[](size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return TrackedNewNoThrow(bytes, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept                                            { TrackedDelete(ptr, s_DefaultAlignment); }
+void operator delete[](void* ptr) noexcept                                          { TrackedDelete(ptr, s_DefaultAlignment); }
+void operator delete(void* ptr, size_t) noexcept                                    { TrackedDelete(ptr, s_DefaultAlignment); }
+void operator delete[](void* ptr, size_t) noexcept                                  { TrackedDelete(ptr, s_DefaultAlignment); }
+void operator delete(void* ptr, std::align_val_t alignment) noexcept                { TrackedDelete(ptr, static_cast<size_t>(alignment)); }
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept              { TrackedDelete(ptr, static_cast<size_t>(alignment)); }
+void operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept        { TrackedDelete(ptr, static_cast<size_t>(alignment)); }
+void operator delete[](void* ptr, size_t, std::align_val_t alignment) noexcept      { TrackedDelete(ptr, static_cast<size_t>(alignment)); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept                     { TrackedDelete(ptr, s_DefaultAlignment); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept                   { TrackedDelete(ptr, s_DefaultAlignment); }
+void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    TrackedDelete(ptr, static_cast<size_t>(alignment));
+}
+void operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    TrackedDelete(ptr, static_cast<size_t>(alignment));
+}
+#pragma endregion
+#endif
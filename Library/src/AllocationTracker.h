@@ -0,0 +1,132 @@
+#pragma once
+
+// Standard includes
+#include <cstddef>
+#include <cstdint>
+
+// Replaces the global operator new/delete to count every heap allocation of the process.
+// Set to 0 (e.g. in the project's preprocessor definitions) to keep the default operators, only TaggedAllocator is counted then
+#ifndef ENABLE_ALLOCATION_TRACKING
+#define ENABLE_ALLOCATION_TRACKING 1
+#endif
+
+namespace dae
+{
+    struct AllocationCounts
+    {
+        uint64_t allocations {0};
+        uint64_t bytes       {0}; // Requested, without the allocator's overhead
+        uint64_t frees       {0};
+    };
+
+    // operator delete does not know where the memory was booked, frees are only counted in total
+    struct TaggedAllocationCounts
+    {
+        const char* tag         {nullptr}; // String literal, only the pointer is stored
+        uint64_t    allocations {0};
+        uint64_t    bytes       {0};
+    };
+
+    // Everything allocated between two EndFrame calls, on every thread
+    struct AllocationFrame
+    {
+        static constexpr int s_MaxTags{32};
+
+        AllocationCounts       total           {};
+        TaggedAllocationCounts tags[s_MaxTags] {}; // tags[0] is everything outside of an ALLOCATION_SCOPE
+        int                    tagCount        {0};
+    };
+
+    /**
+     * \brief Counts heap allocations per frame and per tag (a stage, a subsystem).
+     * Every operator new of the process goes through it, an allocation is booked on the innermost ALLOCATION_SCOPE
+     * of the allocating thread - jobs on the workers are untagged unless they open a scope themselves.
+     * The counters are atomics and the tag table never allocates, so the tracker can run inside operator new
+     * and before main. A frame loop that is warmed up should not allocate at all, see Headless --verify-no-alloc.
+     */
+    class AllocationTracker final
+    {
+    public:
+        static constexpr bool IsEnabled() { return ENABLE_ALLOCATION_TRACKING != 0; }
+
+        // Tagged allocator API: booked on tag, whatever scope the calling thread is in. Release with Free
+        static void* Allocate(size_t bytes, size_t alignment, const char* tag);
+        static void  Free(void* ptr, size_t alignment);
+
+        // Slot of the tag, registered on first use. Names are compared by content, at most AllocationFrame::s_MaxTags - 1
+        static int  GetTagIndex(const char* tag);
+        static int  GetCurrentTagIndex();
+        static void SetCurrentTagIndex(int tagIndex);
+
+        // Called by the operator new/delete replacements (and by Allocate/Free)
+        static void OnAllocate(size_t bytes, int tagIndex);
+        static void OnFree();
+
+        // Frame boundary, call it while nothing else is allocating (Renderer::EndFrame)
+        static void EndFrame();
+
+        static AllocationCounts       GetTotal(); // Since the start of the process
+        static const AllocationFrame& GetLastFrame();
+        static uint64_t               GetLiveAllocations();
+    };
+
+    /**
+     * \brief RAII tag, see ALLOCATION_SCOPE
+     */
+    class AllocationScope final
+    {
+    public:
+        explicit AllocationScope(const char* tag) :
+            m_PreviousTagIndex{AllocationTracker::GetCurrentTagIndex()}
+        {
+            AllocationTracker::SetCurrentTagIndex(AllocationTracker::GetTagIndex(tag));
+        }
+        ~AllocationScope() { AllocationTracker::SetCurrentTagIndex(m_PreviousTagIndex); }
+
+        AllocationScope(const AllocationScope&)                = delete;
+        AllocationScope(AllocationScope&&) noexcept            = delete;
+        AllocationScope& operator=(const AllocationScope&)     = delete;
+        AllocationScope& operator=(AllocationScope&&) noexcept = delete;
+
+    private:
+        int m_PreviousTagIndex;
+    };
+
+    /**
+     * \brief Standard allocator that books everything on its tag, e.g. std::vector<int, TaggedAllocator<int>> values{TaggedAllocator<int>{"Meshes"}}
+     */
+    template <typename T>
+    class TaggedAllocator
+    {
+    public:
+        using value_type = T;
+
+        explicit TaggedAllocator(const char* tag) noexcept : m_Tag{tag} {}
+        template <typename U>
+        TaggedAllocator(const TaggedAllocator<U>& other) noexcept : m_Tag{other.GetTag()} {}
+
+        T* allocate(size_t count)
+        {
+            return static_cast<T*>(AllocationTracker::Allocate(count * sizeof(T), alignof(T), m_Tag));
+        }
+        void deallocate(T* ptr, size_t) noexcept { AllocationTracker::Free(ptr, alignof(T)); }
+
+        inline const char* GetTag() const { return m_Tag; }
+
+        template <typename U>
+        bool operator==(const TaggedAllocator<U>&) const noexcept { return true; } // Any instance can free the memory of another
+
+    private:
+        const char* m_Tag;
+    };
+}
+
+#define ALLOCATION_CONCAT_INNER(a, b) a##b
+#define ALLOCATION_CONCAT(a, b) ALLOCATION_CONCAT_INNER(a, b)
+
+#if ENABLE_ALLOCATION_TRACKING
+// tag must be a string literal
+#define ALLOCATION_SCOPE(tag) const dae::AllocationScope ALLOCATION_CONCAT(allocationScope, __LINE__){tag}
+#else
+#define ALLOCATION_SCOPE(tag) ((void)0)
+#endif
@@ -0,0 +1,184 @@
+#include "BenchmarkComparison.h"
+#include "FrameStatistics.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <random>
+#include <sstream>
+
+namespace dae
+{
+    namespace
+    {
+        // Reorders the samples
+        double Median(std::vector<double>& samples)
+        {
+            if (samples.empty()) return 0.0;
+
+            const size_t middle{samples.size() / 2};
+            std::nth_element(samples.begin(), samples.begin() + static_cast<ptrdiff_t>(middle), samples.end());
+            const double upper{samples[middle]};
+            if (samples.size() % 2 == 1) return upper;
+
+            const double lower{*std::max_element(samples.begin(), samples.begin() + static_cast<ptrdiff_t>(middle))};
+            return (lower + upper) * 0.5;
+        }
+
+        double RelativeDelta(double baseline, double candidate)
+        {
+            return baseline != 0.0 ? (candidate - baseline) / baseline * 100.0 : 0.0;
+        }
+
+        void Resample(const std::vector<double>& samples, std::vector<double>& resampled, std::mt19937& generator)
+        {
+            std::uniform_int_distribution<size_t> distribution{0, samples.size() - 1};
+            resampled.resize(samples.size());
+            for (double& sample : resampled)
+            {
+                sample = samples[distribution(generator)];
+            }
+        }
+
+        // Frame i of both runs shows the same view, drawing the same frames keeps the camera path out of the interval
+        void ResamplePaired(const std::vector<double>& first, const std::vector<double>& second,
+                            std::vector<double>& firstResampled, std::vector<double>& secondResampled, std::mt19937& generator)
+        {
+            std::uniform_int_distribution<size_t> distribution{0, first.size() - 1};
+            firstResampled.resize(first.size());
+            secondResampled.resize(second.size());
+            for (size_t idx{0}; idx < first.size(); ++idx)
+            {
+                const size_t frame{distribution(generator)};
+                firstResampled[idx]  = first[frame];
+                secondResampled[idx] = second[frame];
+            }
+        }
+
+        // Context that has to match for the numbers to mean anything
+        const char* const s_ContextKeys[]
+        {
+            "scene", "resolution", "render_path", "threads", "cpu", "compiler", "build_flags", "step"
+        };
+    }
+
+    std::vector<MetricComparison> BenchmarkComparison::Compare(const BenchmarkResults& baseline, const BenchmarkResults& candidate, const Settings& settings)
+    {
+        std::vector<MetricComparison> comparisons{};
+        std::mt19937 generator{settings.seed};
+
+        std::vector<double> baselineResampled{};
+        std::vector<double> candidateResampled{};
+        std::vector<double> deltas(static_cast<size_t>(std::max(settings.resamples, 1)));
+
+        for (const std::string& name : baseline.GetMetricNames())
+        {
+            std::vector<double> baselineSamples{baseline.GetSamples(name)};
+            std::vector<double> candidateSamples{candidate.GetSamples(name)};
+            if (baselineSamples.empty() or candidateSamples.empty()) continue;
+
+            MetricComparison comparison{};
+            comparison.name = name;
+
+            const bool isPaired{baselineSamples.size() == candidateSamples.size()};
+            for (double& delta : deltas)
+            {
+                if (isPaired)
+                {
+                    ResamplePaired(baselineSamples, candidateSamples, baselineResampled, candidateResampled, generator);
+                }
+                else
+                {
+                    Resample(baselineSamples, baselineResampled, generator);
+                    Resample(candidateSamples, candidateResampled, generator);
+                }
+                delta = RelativeDelta(Median(baselineResampled), Median(candidateResampled));
+            }
+            std::sort(deltas.begin(), deltas.end());
+
+            const double tail{(1.0 - settings.confidence) * 0.5 * 100.0};
+            comparison.lowerPercent = Percentile(deltas, tail);
+            comparison.upperPercent = Percentile(deltas, 100.0 - tail);
+
+            comparison.baselineMedian  = Median(baselineSamples);
+            comparison.candidateMedian = Median(candidateSamples);
+            comparison.deltaPercent    = RelativeDelta(comparison.baselineMedian, comparison.candidateMedian);
+
+            if (comparison.lowerPercent > 0.0 and comparison.deltaPercent >= settings.minEffectPercent)
+            {
+                comparison.verdict = MetricComparison::Verdict::Regression;
+            }
+            else if (comparison.upperPercent < 0.0 and comparison.deltaPercent <= -settings.minEffectPercent)
+            {
+                comparison.verdict = MetricComparison::Verdict::Improvement;
+            }
+
+            comparisons.push_back(comparison);
+        }
+
+        return comparisons;
+    }
+
+    void BenchmarkComparison::WriteReport(std::ostream& stream, const BenchmarkResults& baseline, const BenchmarkResults& candidate,
+                                          const std::vector<MetricComparison>& comparisons, const Settings& settings)
+    {
+        const std::ios_base::fmtflags flags{stream.flags()};
+        const std::streamsize precision{stream.precision()};
+
+        stream << "BASELINE  = " << baseline.GetFrameCount() << " frames\n"
+               << "CANDIDATE = " << candidate.GetFrameCount() << " frames\n";
+        for (const char* key : s_ContextKeys)
+        {
+            const std::string& baselineValue{baseline.GetMetadata(key)};
+            const std::string& candidateValue{candidate.GetMetadata(key)};
+            if (baselineValue == candidateValue)
+            {
+                stream << key << " = " << baselineValue << '\n';
+            }
+            else
+            {
+                stream << "WARNING: " << key << " differs (" << baselineValue << " -> " << candidateValue << ")\n";
+            }
+        }
+
+        stream << std::fixed << std::setprecision(0) << settings.confidence * 100.0 << "% confidence, "
+               << settings.resamples << " bootstrap resamples, minimum effect " << std::setprecision(1) << settings.minEffectPercent << "%\n"
+               << std::left << std::setw(10) << "MEDIAN" << std::right
+               << std::setw(12) << "BASELINE" << std::setw(12) << "CANDIDATE" << std::setw(10) << "DELTA"
+               << std::setw(22) << "CONFIDENCE INTERVAL" << "  VERDICT\n";
+
+        for (const MetricComparison& comparison : comparisons)
+        {
+            std::ostringstream interval{};
+            interval << std::fixed << std::setprecision(1) << std::showpos
+                     << '[' << comparison.lowerPercent << "%, " << comparison.upperPercent << "%]";
+
+            stream << std::left << std::setw(10) << comparison.name << std::right << std::setprecision(3)
+                   << std::setw(12) << comparison.baselineMedian << std::setw(12) << comparison.candidateMedian
+                   << std::setprecision(1) << std::showpos << std::setw(9) << comparison.deltaPercent << '%' << std::noshowpos
+                   << std::setw(22) << interval.str() << "  " << GetVerdictName(comparison.verdict) << '\n';
+        }
+
+        stream << (HasRegression(comparisons) ? "RESULT = REGRESSION\n" : "RESULT = OK\n");
+        stream.precision(precision);
+        stream.flags(flags);
+    }
+
+    bool BenchmarkComparison::HasRegression(const std::vector<MetricComparison>& comparisons)
+    {
+        return std::any_of(comparisons.begin(), comparisons.end(), [](const MetricComparison& comparison)
+        {
+            return comparison.verdict == MetricComparison::Verdict::Regression;
+        });
+    }
+
+    const char* BenchmarkComparison::GetVerdictName(MetricComparison::Verdict verdict)
+    {
+        switch (verdict)
+        {
+        case MetricComparison::Verdict::Regression:  return "REGRESSION";
+        case MetricComparison::Verdict::Improvement: return "improvement";
+        default:                                     return "-";
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+// Project includes
+#include "BenchmarkResults.h"
+
+// Standard includes
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace dae
+{
+    struct MetricComparison
+    {
+        enum class Verdict
+        {
+            Unchanged,   // Within the noise or below the minimum effect
+            Regression,  // Significantly slower
+            Improvement, // Significantly faster
+        };
+
+        std::string name            {};
+        double      baselineMedian  {0.0};
+        double      candidateMedian {0.0};
+        double      deltaPercent    {0.0}; // Candidate against baseline, positive is slower
+        double      lowerPercent    {0.0}; // Confidence interval of the delta
+        double      upperPercent    {0.0};
+        Verdict     verdict         {Verdict::Unchanged};
+    };
+
+    /**
+     * \brief A/B comparison of two benchmark runs, metric by metric.
+     * The statistic is the relative difference of the medians (frame times are skewed, a single hitch moves the mean),
+     * its confidence interval comes from a percentile bootstrap: both runs are resampled with replacement
+     * and the difference is recomputed every time. Runs with the same frame count followed the same camera path,
+     * they are resampled in pairs (the same frames from both). A metric is only flagged when the whole interval lies on
+     * one side of zero and the delta is at least the minimum effect, so noise alone does not fail a change.
+     * Every metric is a time, lower is better.
+     */
+    class BenchmarkComparison final
+    {
+    public:
+        struct Settings
+        {
+            int      resamples        {2000};
+            double   confidence       {0.95};
+            double   minEffectPercent {1.0};
+            uint32_t seed             {5489}; // Fixed, the same files always give the same report
+        };
+
+        // Metrics present in both runs, in the order of the baseline
+        static std::vector<MetricComparison> Compare(const BenchmarkResults& baseline, const BenchmarkResults& candidate, const Settings& settings);
+        static void WriteReport(std::ostream& stream, const BenchmarkResults& baseline, const BenchmarkResults& candidate,
+                                const std::vector<MetricComparison>& comparisons, const Settings& settings);
+
+        static bool HasRegression(const std::vector<MetricComparison>& comparisons);
+        static const char* GetVerdictName(MetricComparison::Verdict verdict);
+    };
+}
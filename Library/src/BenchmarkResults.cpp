@@ -0,0 +1,490 @@
+#include "BenchmarkResults.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace dae
+{
+    namespace
+    {
+        // Just enough JSON for the files WriteJSON writes (and hand edited copies of them)
+        struct JsonValue
+        {
+            enum class Type
+            {
+                Null,
+                Bool,
+                Number,
+                String,
+                Array,
+                Object
+            };
+
+            Type                                           type    {Type::Null};
+            double                                         number  {0.0};
+            std::string                                    string  {};
+            std::vector<JsonValue>                         array   {};
+            std::vector<std::pair<std::string, JsonValue>> members {};
+
+            const JsonValue* Find(const std::string& key) const
+            {
+                for (const auto& [name, value] : members)
+                {
+                    if (name == key) return &value;
+                }
+                return nullptr;
+            }
+        };
+
+        class JsonReader final
+        {
+        public:
+            explicit JsonReader(const std::string& text) : m_Text{text} {}
+
+            bool ReadDocument(JsonValue& value)
+            {
+                if (not ReadValue(value, 0)) return false;
+                SkipWhitespace();
+                return m_Position == m_Text.size();
+            }
+
+        private:
+            // Nothing WriteJSON produces comes close, deeper is a broken or hostile file
+            static constexpr int s_MaxDepth{32};
+
+            void SkipWhitespace()
+            {
+                while (m_Position < m_Text.size() and std::isspace(static_cast<unsigned char>(m_Text[m_Position]))) ++m_Position;
+            }
+
+            bool Consume(char character)
+            {
+                SkipWhitespace();
+                if (m_Position >= m_Text.size() or m_Text[m_Position] != character) return false;
+                ++m_Position;
+                return true;
+            }
+
+            bool ConsumeWord(const char* word)
+            {
+                const size_t length{std::char_traits<char>::length(word)};
+                if (m_Text.compare(m_Position, length, word) != 0) return false;
+                m_Position += length;
+                return true;
+            }
+
+            bool ReadValue(JsonValue& value, int depth)
+            {
+                if (depth > s_MaxDepth) return false;
+
+                SkipWhitespace();
+                if (m_Position >= m_Text.size()) return false;
+
+                switch (m_Text[m_Position])
+                {
+                case '{':
+                    value.type = JsonValue::Type::Object;
+                    return ReadObject(value, depth);
+                case '[':
+                    value.type = JsonValue::Type::Array;
+                    return ReadArray(value, depth);
+                case '"':
+                    value.type = JsonValue::Type::String;
+                    return ReadString(value.string);
+                case 't':
+                    value.type   = JsonValue::Type::Bool;
+                    value.number = 1.0;
+                    return ConsumeWord("true");
+                case 'f':
+                    value.type = JsonValue::Type::Bool;
+                    return ConsumeWord("false");
+                case 'n':
+                    value.type = JsonValue::Type::Null;
+                    return ConsumeWord("null");
+                default:
+                    value.type = JsonValue::Type::Number;
+                    return ReadNumber(value.number);
+                }
+            }
+
+            bool ReadObject(JsonValue& value, int depth)
+            {
+                ++m_Position;
+                if (Consume('}')) return true;
+
+                do
+                {
+                    std::string key{};
+                    SkipWhitespace();
+                    if (not ReadString(key) or not Consume(':')) return false;
+
+                    value.members.emplace_back(std::move(key), JsonValue{});
+                    if (not ReadValue(value.members.back().second, depth + 1)) return false;
+                }
+                while (Consume(','));
+
+                return Consume('}');
+            }
+
+            bool ReadArray(JsonValue& value, int depth)
+            {
+                ++m_Position;
+                if (Consume(']')) return true;
+
+                do
+                {
+                    value.array.emplace_back();
+                    if (not ReadValue(value.array.back(), depth + 1)) return false;
+                }
+                while (Consume(','));
+
+                return Consume(']');
+            }
+
+            bool ReadString(std::string& string)
+            {
+                if (m_Position >= m_Text.size() or m_Text[m_Position] != '"') return false;
+                ++m_Position;
+
+                while (m_Position < m_Text.size())
+                {
+                    const char character{m_Text[m_Position++]};
+                    if (character == '"') return true;
+                    if (character != '\\')
+                    {
+                        string += character;
+                        continue;
+                    }
+
+                    if (m_Position >= m_Text.size()) return false;
+                    switch (const char escaped{m_Text[m_Position++]})
+                    {
+                    case 'n': string += '\n'; break;
+                    case 't': string += '\t'; break;
+                    case 'r': string += '\r'; break;
+                    case 'b': string += '\b'; break;
+                    case 'f': string += '\f'; break;
+                    case 'u':
+                    {
+                        // Only what WriteJSON escapes: control characters, kept as they are below 0x80
+                        if (m_Position + 4 > m_Text.size()) return false;
+                        const long code{std::strtol(m_Text.substr(m_Position, 4).c_str(), nullptr, 16)};
+                        m_Position += 4;
+                        string += code < 0x80 ? static_cast<char>(code) : '?';
+                        break;
+                    }
+                    default: string += escaped; break;
+                    }
+                }
+                return false;
+            }
+
+            bool ReadNumber(double& number)
+            {
+                const char* beginPtr{m_Text.c_str() + m_Position};
+                char* endPtr{nullptr};
+                number = std::strtod(beginPtr, &endPtr);
+                if (endPtr == beginPtr) return false;
+
+                m_Position += static_cast<size_t>(endPtr - beginPtr);
+                return true;
+            }
+
+            const std::string& m_Text;
+            size_t             m_Position {0};
+        };
+
+        void WriteJsonString(std::ostream& stream, const std::string& string)
+        {
+            stream << '"';
+            for (const char character : string)
+            {
+                switch (character)
+                {
+                case '"':  stream << "\\\""; break;
+                case '\\': stream << "\\\\"; break;
+                case '\n': stream << "\\n";  break;
+                case '\t': stream << "\\t";  break;
+                case '\r': stream << "\\r";  break;
+                default:
+                    if (static_cast<unsigned char>(character) < 0x20)
+                    {
+                        stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character) << std::dec << std::setfill(' ');
+                    }
+                    else
+                    {
+                        stream << character;
+                    }
+                    break;
+                }
+            }
+            stream << '"';
+        }
+
+        std::string Trim(const std::string& string)
+        {
+            const size_t begin{string.find_first_not_of(" \t\r")};
+            if (begin == std::string::npos) return {};
+            const size_t end{string.find_last_not_of(" \t\r")};
+            return string.substr(begin, end - begin + 1);
+        }
+
+        std::vector<std::string> SplitCSV(const std::string& line)
+        {
+            std::vector<std::string> fields{};
+            std::stringstream stream{line};
+            std::string field{};
+            while (std::getline(stream, field, ','))
+            {
+                fields.push_back(Trim(field));
+            }
+            return fields;
+        }
+    }
+
+    BenchmarkResults::BenchmarkResults(std::vector<std::string> metricNames) :
+        m_MetricNames{std::move(metricNames)}
+    {
+    }
+
+    void BenchmarkResults::SetMetadata(const std::string& key, const std::string& value)
+    {
+        for (auto& [name, existingValue] : m_Metadata)
+        {
+            if (name == key)
+            {
+                existingValue = value;
+                return;
+            }
+        }
+        m_Metadata.emplace_back(key, value);
+    }
+
+    const std::string& BenchmarkResults::GetMetadata(const std::string& key) const
+    {
+        static const std::string empty{};
+        for (const auto& [name, value] : m_Metadata)
+        {
+            if (name == key) return value;
+        }
+        return empty;
+    }
+
+    void BenchmarkResults::AddFrame(const std::vector<double>& values)
+    {
+        assert(values.size() == m_MetricNames.size() and "BenchmarkResults::AddFrame: One value per metric");
+        m_Frames.push_back(values);
+    }
+
+    std::vector<double> BenchmarkResults::GetSamples(const std::string& metricName) const
+    {
+        const auto it{std::find(m_MetricNames.begin(), m_MetricNames.end(), metricName)};
+        if (it == m_MetricNames.end()) return {};
+
+        const auto metric{static_cast<size_t>(it - m_MetricNames.begin())};
+        std::vector<double> samples{};
+        samples.reserve(m_Frames.size());
+        for (const std::vector<double>& frame : m_Frames)
+        {
+            samples.push_back(frame[metric]);
+        }
+        return samples;
+    }
+
+    void BenchmarkResults::WriteJSON(std::ostream& stream) const
+    {
+        const std::ios_base::fmtflags flags{stream.flags()};
+        const std::streamsize precision{stream.precision(9)};
+
+        stream << "{\n  \"metadata\": {";
+        for (size_t idx{0}; idx < m_Metadata.size(); ++idx)
+        {
+            stream << (idx > 0 ? ",\n    " : "\n    ");
+            WriteJsonString(stream, m_Metadata[idx].first);
+            stream << ": ";
+            WriteJsonString(stream, m_Metadata[idx].second);
+        }
+        stream << "\n  },\n  \"metrics\": [";
+        for (size_t idx{0}; idx < m_MetricNames.size(); ++idx)
+        {
+            if (idx > 0) stream << ", ";
+            WriteJsonString(stream, m_MetricNames[idx]);
+        }
+        // One line per frame keeps big runs readable and diffable
+        stream << "],\n  \"frames\": [";
+        for (size_t frame{0}; frame < m_Frames.size(); ++frame)
+        {
+            stream << (frame > 0 ? ",\n    [" : "\n    [");
+            for (size_t idx{0}; idx < m_Frames[frame].size(); ++idx)
+            {
+                if (idx > 0) stream << ", ";
+                stream << m_Frames[frame][idx];
+            }
+            stream << ']';
+        }
+        stream << "\n  ]\n}\n";
+
+        stream.precision(precision);
+        stream.flags(flags);
+    }
+
+    void BenchmarkResults::WriteCSV(std::ostream& stream) const
+    {
+        const std::ios_base::fmtflags flags{stream.flags()};
+        const std::streamsize precision{stream.precision(9)};
+
+        for (const auto& [key, value] : m_Metadata)
+        {
+            stream << "# " << key << " = " << value << '\n';
+        }
+        for (size_t idx{0}; idx < m_MetricNames.size(); ++idx)
+        {
+            stream << (idx > 0 ? "," : "") << m_MetricNames[idx];
+        }
+        stream << '\n';
+        for (const std::vector<double>& frame : m_Frames)
+        {
+            for (size_t idx{0}; idx < frame.size(); ++idx)
+            {
+                if (idx > 0) stream << ',';
+                stream << frame[idx];
+            }
+            stream << '\n';
+        }
+
+        stream.precision(precision);
+        stream.flags(flags);
+    }
+
+    bool BenchmarkResults::Save(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if (not file) return false;
+
+        const bool isJSON{path.size() >= 5 and path.compare(path.size() - 5, 5, ".json") == 0};
+        if (isJSON) WriteJSON(file);
+        else        WriteCSV(file);
+        return file.good();
+    }
+
+    bool BenchmarkResults::Load(const std::string& path, BenchmarkResults& results)
+    {
+        std::ifstream file(path);
+        if (not file) return false;
+
+        file >> std::ws;
+        if (file.peek() == '{') return ReadJSON(file, results);
+        return ReadCSV(file, results);
+    }
+
+    /**
+     * \brief Reads what WriteJSON writes
+     * \param stream
+     * \param results Left untouched on failure
+     * \return true on success
+     */
+    bool BenchmarkResults::ReadJSON(std::istream& stream, BenchmarkResults& results)
+    {
+        std::stringstream buffer{};
+        buffer << stream.rdbuf();
+        const std::string text{buffer.str()};
+
+        JsonValue document{};
+        if (not JsonReader{text}.ReadDocument(document) or document.type != JsonValue::Type::Object) return false;
+
+        const JsonValue* metricsPtr{document.Find("metrics")};
+        const JsonValue* framesPtr{document.Find("frames")};
+        if (not metricsPtr or metricsPtr->type != JsonValue::Type::Array) return false;
+        if (not framesPtr or framesPtr->type != JsonValue::Type::Array) return false;
+
+        BenchmarkResults result{};
+        for (const JsonValue& metric : metricsPtr->array)
+        {
+            if (metric.type != JsonValue::Type::String) return false;
+            result.m_MetricNames.push_back(metric.string);
+        }
+
+        for (const JsonValue& frame : framesPtr->array)
+        {
+            if (frame.type != JsonValue::Type::Array or frame.array.size() != result.m_MetricNames.size()) return false;
+
+            std::vector<double>& values{result.m_Frames.emplace_back()};
+            for (const JsonValue& value : frame.array)
+            {
+                if (value.type != JsonValue::Type::Number) return false;
+                values.push_back(value.number);
+            }
+        }
+
+        if (const JsonValue* metadataPtr{document.Find("metadata")}; metadataPtr and metadataPtr->type == JsonValue::Type::Object)
+        {
+            for (const auto& [key, value] : metadataPtr->members)
+            {
+                std::ostringstream text{};
+                if      (value.type == JsonValue::Type::String) text << value.string;
+                else if (value.type == JsonValue::Type::Number) text << value.number;
+                else if (value.type == JsonValue::Type::Bool)   text << (value.number != 0.0 ? "true" : "false");
+                result.SetMetadata(key, text.str());
+            }
+        }
+
+        results = std::move(result);
+        return true;
+    }
+
+    /**
+     * \brief Reads what WriteCSV writes: "# key = value" lines, a header with the metric names, one row per frame
+     * \param stream
+     * \param results Left untouched on failure
+     * \return true on success
+     */
+    bool BenchmarkResults::ReadCSV(std::istream& stream, BenchmarkResults& results)
+    {
+        BenchmarkResults result{};
+        bool hasHeader{false};
+
+        std::string line{};
+        while (std::getline(stream, line))
+        {
+            if (Trim(line).empty()) continue;
+
+            if (line[0] == '#')
+            {
+                const size_t separator{line.find('=')};
+                if (separator != std::string::npos)
+                {
+                    result.SetMetadata(Trim(line.substr(1, separator - 1)), Trim(line.substr(separator + 1)));
+                }
+                continue;
+            }
+
+            std::vector<std::string> fields{SplitCSV(line)};
+            if (not hasHeader)
+            {
+                result.m_MetricNames = std::move(fields);
+                hasHeader = true;
+                continue;
+            }
+
+            if (fields.size() != result.m_MetricNames.size()) return false;
+
+            std::vector<double>& values{result.m_Frames.emplace_back()};
+            for (const std::string& field : fields)
+            {
+                char* endPtr{nullptr};
+                values.push_back(std::strtod(field.c_str(), &endPtr));
+                if (endPtr == field.c_str()) return false;
+            }
+        }
+
+        if (not hasHeader) return false;
+
+        results = std::move(result);
+        return true;
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+// Standard includes
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dae
+{
+    /**
+     * \brief Per-frame measurements of one benchmark run and the context they were taken in (scene, resolution, CPU, ...).
+     * Every frame has one value per metric, in the order of the metric names.
+     * Stored as JSON or CSV (the metadata becomes "# key = value" comment lines), Load reads both.
+     */
+    class BenchmarkResults final
+    {
+    public:
+        using Metadata = std::vector<std::pair<std::string, std::string>>;
+
+        BenchmarkResults() = default;
+        explicit BenchmarkResults(std::vector<std::string> metricNames);
+        ~BenchmarkResults() = default;
+
+        BenchmarkResults(const BenchmarkResults&)                = default;
+        BenchmarkResults(BenchmarkResults&&) noexcept            = default;
+        BenchmarkResults& operator=(const BenchmarkResults&)     = default;
+        BenchmarkResults& operator=(BenchmarkResults&&) noexcept = default;
+
+        // Replaces the value of an existing key, keeps the insertion order otherwise
+        void SetMetadata(const std::string& key, const std::string& value);
+        // Empty when the key is missing
+        const std::string& GetMetadata(const std::string& key) const;
+
+        // One value per metric
+        void AddFrame(const std::vector<double>& values);
+
+        inline const Metadata& GetAllMetadata() const { return m_Metadata; }
+        inline const std::vector<std::string>& GetMetricNames() const { return m_MetricNames; }
+        inline size_t GetFrameCount() const { return m_Frames.size(); }
+        inline const std::vector<double>& GetFrame(size_t frame) const { return m_Frames[frame]; }
+        // Values of one metric over all frames, empty when the run has no such metric
+        std::vector<double> GetSamples(const std::string& metricName) const;
+
+        void WriteJSON(std::ostream& stream) const;
+        void WriteCSV(std::ostream& stream) const;
+        // Format from the extension: .json, anything else is CSV
+        bool Save(const std::string& path) const;
+        // Format from the content
+        static bool Load(const std::string& path, BenchmarkResults& results);
+        static bool ReadJSON(std::istream& stream, BenchmarkResults& results);
+        static bool ReadCSV(std::istream& stream, BenchmarkResults& results);
+
+    private:
+        Metadata                         m_Metadata    {};
+        std::vector<std::string>         m_MetricNames {};
+        std::vector<std::vector<double>> m_Frames      {};
+    };
+}
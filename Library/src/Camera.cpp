@@ -1,13 +1,11 @@
 #include "Camera.h"
 
-
-#include "ImGui/imgui.h"
-
 namespace dae
 {
     Camera::Camera(const Vector3& _origin, float _fovAngle)
         : m_Origin{_origin}
           , m_FOVAngle{_fovAngle}
+          , m_FOV{CalculateFOV(_fovAngle)}
     {
     }
 
@@ -19,46 +17,38 @@ namespace dae
         m_Origin = _origin;
         m_NearPlane = _nearPlane;
         m_FarPlane = _farPlane;
-    }
-
-    void Camera::Update(Timer* pTimer)
-    {
-        const float deltaTime = pTimer->GetElapsed();
-
-        //Camera Update Logic
 
-        //Keyboard Input
-        const uint8_t* pKeyboardState = SDL_GetKeyboardState(nullptr);
-        MoveCamera(pKeyboardState, deltaTime);
-        RotateCamera(deltaTime);
-
-        //Update Matrices
-        CalculateViewMatrix();
-        CalculateProjectionMatrix();
-        //Try to optimize this - should only be called once or when fov/aspectRatio changes
+        m_IsViewDirty       = true;
+        m_IsProjectionDirty = true;
     }
 
-    float Camera::GetFOV() const
+    /**
+     * \brief A camera that did not move keeps its matrices: the look-at and its inverse only follow the pose,
+     * the projection only the FOV, aspect ratio and planes. The combination and the frustum follow either
+     */
+    void Camera::UpdateMatrices()
     {
-        return CalculateFOV(m_FOVAngle);
-    }
+        if (not m_IsViewDirty and not m_IsProjectionDirty) return;
 
-    void Camera::Scroll(SDL_MouseWheelEvent wheel)
-    {
-        // Check whether the mouse is over the ImGui window
-        if (ImGui::GetIO().WantCaptureMouse)
+        if (m_IsViewDirty)
         {
-            return;
+            CalculateViewMatrix();
         }
-        
-        if (wheel.y > 0) // scroll up
+        if (m_IsProjectionDirty)
         {
-            m_Origin += m_Forward * m_ScrollSpeed;
-        }
-        else if (wheel.y < 0) // scroll down
-        {
-            m_Origin -= m_Forward * m_ScrollSpeed;
+            CalculateProjectionMatrix();
         }
+        m_ViewProjectionMatrix = m_InverseViewMatrix * m_ProjectionMatrix;
+        m_Frustum              = Frustum::FromViewProjection(m_ViewProjectionMatrix);
+
+        m_IsViewDirty       = false;
+        m_IsProjectionDirty = false;
+    }
+
+    void Camera::SetAspectRatio(float aspectRatio)
+    {
+        m_AspectRatio       = aspectRatio;
+        m_IsProjectionDirty = true;
     }
 
     void Camera::IncreaseFOV()
@@ -73,14 +63,36 @@ namespace dae
         CalculateFOV();
     }
 
+    void Camera::SetFOVAngle(float fovAngle)
+    {
+        m_FOVAngle = fovAngle;
+        CalculateFOV();
+    }
+
+    // Through SetPose: the forward vector and the view matrix follow the angles
     void Camera::SetTotalPitch(float pitch)
     {
-        m_TotalPitch = pitch;
+        SetPose(m_Origin, pitch, m_TotalYaw);
     }
 
     void Camera::SetTotalYaw(float yaw)
     {
-        m_TotalYaw = yaw;
+        SetPose(m_Origin, m_TotalPitch, yaw);
+    }
+
+    /**
+     * \brief Places the camera without input, e.g. along a scripted path
+     * \param origin 
+     * \param pitch degrees
+     * \param yaw degrees
+     */
+    void Camera::SetPose(const Vector3& origin, float pitch, float yaw)
+    {
+        m_Origin     = origin;
+        m_TotalPitch = pitch;
+        m_TotalYaw   = yaw;
+        m_Forward    = Matrix::CreateRotation(m_TotalPitch * TO_RADIANS, m_TotalYaw * TO_RADIANS, 0.0f).TransformVector(Vector3::UnitZ);
+        m_IsViewDirty = true;
     }
 
     float Camera::CalculateFOV(float angle) const
@@ -92,68 +104,7 @@ namespace dae
     void Camera::CalculateFOV()
     {
         m_FOV = CalculateFOV(m_FOVAngle);
-    }
-
-    void Camera::MoveCamera(const uint8_t* pKeyboardState, float deltaTime)
-    {
-        if (pKeyboardState[SDL_SCANCODE_A])
-        {
-            m_Origin -= m_Right * deltaTime * m_Speed;
-        }
-        else if (pKeyboardState[SDL_SCANCODE_D])
-        {
-            m_Origin += m_Right * deltaTime * m_Speed;
-        }
-        if (pKeyboardState[SDL_SCANCODE_W])
-        {
-            m_Origin += m_Forward * deltaTime * m_Speed;
-        }
-        else if (pKeyboardState[SDL_SCANCODE_S])
-        {
-            m_Origin -= m_Forward * deltaTime * m_Speed;
-        }
-    }
-
-    void Camera::RotateCamera(float deltaTime)
-    {
-        // Check whether the mouse is over the ImGui window
-        if (ImGui::GetIO().WantCaptureMouse)
-        {
-            return;
-        }
-        
-        int mouseX{}, mouseY{};
-        const int threshold{1};
-        
-        const uint32_t mouseState = SDL_GetRelativeMouseState(&mouseX, &mouseY);
-        
-        mouseX = mouseX > threshold ? 1 : mouseX < -threshold ? -1 : 0;
-        mouseY = mouseY > threshold ? 1 : mouseY < -threshold ? -1 : 0;
-        
-        const bool leftMouseButtonDown  = mouseState & SDL_BUTTON(SDL_BUTTON_LEFT);
-        const bool rightMouseButtonDown = mouseState & SDL_BUTTON(SDL_BUTTON_RIGHT);
-        
-        if (leftMouseButtonDown and rightMouseButtonDown)
-        {
-            m_Origin += m_Up * static_cast<float>(mouseY * -1) * deltaTime * m_Speed;
-        }
-        else if (leftMouseButtonDown)
-        {
-            m_Origin += m_Forward * static_cast<float>(mouseY * -1) * deltaTime * m_Speed;
-            m_TotalYaw += static_cast<float>(mouseX) * m_RotationSpeed * deltaTime;
-        }
-        else if (rightMouseButtonDown)
-        {
-            m_TotalYaw += static_cast<float>(mouseX) * m_RotationSpeed * deltaTime;
-            m_TotalPitch += static_cast<float>(mouseY * -1) * m_RotationSpeed * deltaTime;
-        }
-        if (mouseX or mouseY)
-        {
-            m_Forward = Matrix::CreateRotation(m_TotalPitch * TO_RADIANS, m_TotalYaw * TO_RADIANS, 0.0f).TransformVector(
-                Vector3::UnitZ);
-            // TODO: verify if this is needed
-            //forward.Normalize();
-        }
+        m_IsProjectionDirty = true;
     }
 
     void Camera::CalculateViewMatrix()
@@ -1,11 +1,13 @@
 #pragma once
-#include <SDL_events.h>
-
+#include "Frustum.h"
 #include "Maths.h"
-#include "Timer.h"
 
 namespace dae
 {
+    /**
+     * \brief Pose, projection and the cached matrices. Knows nothing about input,
+     * the application moves it through SetPose / SetFOVAngle (see CameraController in the Rasterizer)
+     */
     class Camera
     {
     public:
@@ -13,33 +15,57 @@ namespace dae
         Camera(const Vector3& _origin, float _fovAngle);
         
         void Initialize(float _fovAngle = 90.0f, Vector3 _origin = {0.0f, 0.0f, 0.0f}, float nearPlane = 10.0f, float farPlane = 20.0f);
-        void Update(Timer* pTimer);
 
-        float GetFOV() const;
-        void Scroll(SDL_MouseWheelEvent wheel);
+        inline float GetFOV()        const { return m_FOV;        }
+        inline float GetFOVAngle()   const { return m_FOVAngle;   }
+        inline float GetTotalPitch() const { return m_TotalPitch; }
+        inline float GetTotalYaw()   const { return m_TotalYaw;   }
+        void SetFOVAngle(float fovAngle);
         void IncreaseFOV();
         void DecreaseFOV();
         void SetTotalPitch(float pitch);
         void SetTotalYaw(float yaw);
+        void SetPose(const Vector3& origin, float pitch, float yaw);
         
-        void CalculateViewMatrix();
-        void CalculateProjectionMatrix();
+        // Only recomputes what the setters flagged since the last call
+        void UpdateMatrices();
         inline float GetAspectRatio() const { return m_AspectRatio; }
-        inline void SetAspectRatio(float aspect_ratio) { m_AspectRatio = aspect_ratio; }
+        void SetAspectRatio(float aspectRatio);
         inline Vector3 GetPosition() const { return m_Origin; }
+        inline const Vector3& GetForward() const { return m_Forward; }
+        // Valid after UpdateMatrices, like the matrices
+        inline const Vector3& GetRight()   const { return m_Right;   }
+        inline const Vector3& GetUp()      const { return m_Up;      }
+        inline float GetNearPlane() const { return m_NearPlane; }
+        inline float GetFarPlane() const { return m_FarPlane; }
+
+        // Valid after UpdateMatrices
+        inline const Matrix& GetViewMatrix()           const { return m_ViewMatrix;           } // Camera to world (ONB)
+        inline const Matrix& GetInverseViewMatrix()    const { return m_InverseViewMatrix;    } // World to camera
+        inline const Matrix& GetProjectionMatrix()     const { return m_ProjectionMatrix;     }
+        inline const Matrix& GetViewProjectionMatrix() const { return m_ViewProjectionMatrix; } // World to clip
+        inline const Frustum& GetFrustum()             const { return m_Frustum;              } // World space
+
+        // World space culling against the cached frustum, false = surely not visible
+        inline bool IsSphereVisible(const Vector3& center, float radius) const { return m_Frustum.IsSphereVisible(center, radius); }
+        inline bool IsBoxVisible(const BoundingBox& box)                  const { return m_Frustum.IsBoxVisible(box); }
 
     private:
         float CalculateFOV(float angle) const;
         void CalculateFOV();
-        void MoveCamera(const uint8_t* pKeyboardState, float deltaTime);
-        void RotateCamera(float deltaTime);
+        void CalculateViewMatrix();
+        void CalculateProjectionMatrix();
 
-    public:
-        Matrix m_InverseViewMatrix    {};
-        Matrix m_ViewMatrix       {};
-        Matrix m_ProjectionMatrix {};
+        Matrix  m_InverseViewMatrix    {};
+        Matrix  m_ViewMatrix           {};
+        Matrix  m_ProjectionMatrix     {};
+        Matrix  m_ViewProjectionMatrix {};
+        Frustum m_Frustum              {};
+
+        // Pose vs FOV / aspect ratio / planes, set by the setters, cleared by UpdateMatrices
+        bool m_IsViewDirty       {true};
+        bool m_IsProjectionDirty {true};
 
-    private:
         Vector3 m_Origin      {};
         float   m_FOVAngle    {0.0f};
         float   m_FOV         {0.0f};
@@ -51,11 +77,7 @@ namespace dae
         Vector3 m_Up      {Vector3::UnitY};
         Vector3 m_Forward {Vector3::UnitZ};
 
-        float  m_TotalPitch    {0.0f};
-        float  m_TotalYaw      {0.0f};
-        Matrix m_CameraToWorld {};
-        float  m_Speed         {20.0f};
-        float  m_RotationSpeed {100.0f};
-        float  m_ScrollSpeed   {5.0f};
+        float m_TotalPitch {0.0f};
+        float m_TotalYaw   {0.0f};
     };
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include "MathHelpers.h"
 
 namespace dae
@@ -7,9 +9,9 @@ namespace dae
     struct ColorRGB
     {
         ColorRGB() = default;
-        ColorRGB(float _r, float _g, float _b) : r(_r), g(_g), b(_b) { }
-        ColorRGB(float c) : r(c), g(c), b(c) { }
-        ColorRGB(const float (&c)[3]) : r(c[0]), g(c[1]), b(c[2]) { }
+        constexpr ColorRGB(float _r, float _g, float _b) : r(_r), g(_g), b(_b) { }
+        constexpr ColorRGB(float c) : r(c), g(c), b(c) { }
+        constexpr ColorRGB(const float (&c)[3]) : r(c[0]), g(c[1]), b(c[2]) { }
         
         ColorRGB(const ColorRGB& other)                = default;
         ColorRGB(ColorRGB&& other) noexcept            = default;
@@ -22,20 +24,20 @@ namespace dae
         float g{};
         float b{};
 
-        void MaxToOne()
+        constexpr void MaxToOne()
         {
             const float maxValue = std::max(r, std::max(g, b));
             if (maxValue > 1.f)
                 *this /= maxValue;
         }
 
-        static ColorRGB Lerp(const ColorRGB& c1, const ColorRGB& c2, float factor)
+        static constexpr ColorRGB Lerp(const ColorRGB& c1, const ColorRGB& c2, float factor)
         {
             return {Lerpf(c1.r, c2.r, factor), Lerpf(c1.g, c2.g, factor), Lerpf(c1.b, c2.b, factor)};
         }
 
 #pragma region ColorRGB (Member) Operators
-        ColorRGB& operator+=(const ColorRGB& c)
+        constexpr ColorRGB& operator+=(const ColorRGB& c)
         {
             r += c.r;
             g += c.g;
@@ -43,7 +45,7 @@ namespace dae
             return *this;
         }
 
-        ColorRGB& operator-=(const ColorRGB& c)
+        constexpr ColorRGB& operator-=(const ColorRGB& c)
         {
             r -= c.r;
             g -= c.g;
@@ -51,7 +53,7 @@ namespace dae
             return *this;
         }
 
-        ColorRGB& operator*=(const ColorRGB& c)
+        constexpr ColorRGB& operator*=(const ColorRGB& c)
         {
             r *= c.r;
             g *= c.g;
@@ -59,7 +61,7 @@ namespace dae
             return *this;
         }
 
-        ColorRGB& operator/=(const ColorRGB& c)
+        constexpr ColorRGB& operator/=(const ColorRGB& c)
         {
             r /= c.r;
             g /= c.g;
@@ -70,22 +72,22 @@ namespace dae
     };
 
 #pragma region ColorRGB (Global) Operators
-    inline ColorRGB operator+(const ColorRGB& lhs, const ColorRGB& rhs)
+    constexpr ColorRGB operator+(const ColorRGB& lhs, const ColorRGB& rhs)
     {
         return {lhs.r + rhs.r, lhs.g + rhs.g, lhs.b + rhs.b};
     }
 
-    inline ColorRGB operator-(const ColorRGB& lhs, const ColorRGB& rhs)
+    constexpr ColorRGB operator-(const ColorRGB& lhs, const ColorRGB& rhs)
     {
         return {lhs.r - rhs.r, lhs.g - rhs.g, lhs.b - rhs.b};
     }
 
-    inline ColorRGB operator*(const ColorRGB& lhs, const ColorRGB& rhs)
+    constexpr ColorRGB operator*(const ColorRGB& lhs, const ColorRGB& rhs)
     {
         return {lhs.r * rhs.r, lhs.g * rhs.g, lhs.b * rhs.b};
     }
 
-    inline ColorRGB operator/(const ColorRGB& lhs, const ColorRGB& rhs)
+    constexpr ColorRGB operator/(const ColorRGB& lhs, const ColorRGB& rhs)
     {
         return {lhs.r / rhs.r, lhs.g / rhs.g, lhs.b / rhs.b};
     }
@@ -93,15 +95,15 @@ namespace dae
 
     namespace colors
     {
-        static ColorRGB Red{1, 0, 0};
-        static ColorRGB Blue{0, 0, 1};
-        static ColorRGB Green{0, 1, 0};
-        static ColorRGB Yellow{1, 1, 0};
-        static ColorRGB Cyan{0, 1, 1};
-        static ColorRGB Magenta{1, 0, 1};
-        static ColorRGB White{1, 1, 1};
-        static ColorRGB Black{0, 0, 0};
-        static ColorRGB Gray{0.5f, 0.5f, 0.5f};
-        static ColorRGB Dielectric{0.04f, 0.04f, 0.04f};
+        inline constexpr ColorRGB Red{1, 0, 0};
+        inline constexpr ColorRGB Blue{0, 0, 1};
+        inline constexpr ColorRGB Green{0, 1, 0};
+        inline constexpr ColorRGB Yellow{1, 1, 0};
+        inline constexpr ColorRGB Cyan{0, 1, 1};
+        inline constexpr ColorRGB Magenta{1, 0, 1};
+        inline constexpr ColorRGB White{1, 1, 1};
+        inline constexpr ColorRGB Black{0, 0, 0};
+        inline constexpr ColorRGB Gray{0.5f, 0.5f, 0.5f};
+        inline constexpr ColorRGB Dielectric{0.04f, 0.04f, 0.04f};
     }
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include "Frustum.h"
 #include "Maths.h"
 #include "vector"
 
@@ -40,6 +41,7 @@ namespace dae
 
         std::vector<Vertex_Out> vertices_out{};
         Matrix worldMatrix{};
+        BoundingBox bounds{}; // Object space, for culling the whole mesh against the camera's frustum
     };
 #pragma endregion
     
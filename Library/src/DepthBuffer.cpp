@@ -0,0 +1,114 @@
+#include "DepthBuffer.h"
+
+#include <cassert>
+
+namespace dae
+{
+    DepthBuffer::DepthBuffer(int width, int height, DepthFormat format) :
+        m_Width{width},
+        m_Height{height},
+        m_TileMask{width, height}
+    {
+        assert(width > 0 and height > 0 and "DepthBuffer::DepthBuffer: Invalid dimensions");
+
+        SetDepthRange(m_NearPlane, m_FarPlane);
+        SetFormat(format);
+    }
+
+    /**
+     * \brief Switches the storage, only the buffer of the active format is kept around
+     * \param format 
+     */
+    void DepthBuffer::SetFormat(DepthFormat format)
+    {
+        m_Format = format;
+
+        const size_t pixelCount{static_cast<size_t>(m_Width) * m_Height};
+        if (m_Format == DepthFormat::Float32ReversedZ)
+        {
+            m_Float32Buffer.resize(pixelCount);
+            std::vector<uint16_t>{}.swap(m_Unorm16Buffer);
+        }
+        else
+        {
+            m_Unorm16Buffer.resize(pixelCount);
+            std::vector<float>{}.swap(m_Float32Buffer);
+        }
+        Clear();
+    }
+
+    /**
+     * \brief Reversed depth = 1 - z_ndc, rewritten so it never subtracts two values close to 1:
+     * zn * (zf / w - 1) / (zf - zn), which is linear in 1/w
+     * \param nearPlane 
+     * \param farPlane 
+     */
+    void DepthBuffer::SetDepthRange(float nearPlane, float farPlane)
+    {
+        assert(farPlane > nearPlane and nearPlane > 0.0f and "DepthBuffer::SetDepthRange: Invalid range");
+
+        m_NearPlane   = nearPlane;
+        m_FarPlane    = farPlane;
+        m_DepthScale  = nearPlane * farPlane / (farPlane - nearPlane);
+        m_DepthBias   = -nearPlane / (farPlane - nearPlane);
+        m_LinearScale = 65535.0f / (farPlane - nearPlane);
+    }
+
+    void DepthBuffer::Clear()
+    {
+        m_TileMask.SetAll();
+    }
+
+    /**
+     * \brief Materializes the cleared tiles overlapping the given pixel rectangle (inclusive)
+     */
+    void DepthBuffer::PrepareTiles(int minX, int minY, int maxX, int maxY)
+    {
+        m_TileMask.Prepare(minX, minY, maxX, maxY, [this](int beginX, int beginY, int endX, int endY)
+        {
+            FillTile(beginX, beginY, endX, endY);
+        });
+    }
+
+    float DepthBuffer::GetViewDepth(int x, int y) const
+    {
+        if (m_TileMask.IsPixelCleared(x, y)) return m_FarPlane;
+
+        const int index{x + y * m_Width};
+        if (m_Format == DepthFormat::Float32ReversedZ)
+        {
+            const float depth{m_Float32Buffer[index]};
+            return depth <= 0.0f ? m_FarPlane : m_DepthScale / (depth - m_DepthBias);
+        }
+        return m_NearPlane + static_cast<float>(m_Unorm16Buffer[index]) / m_LinearScale;
+    }
+
+    const char* DepthBuffer::GetFormatName(DepthFormat format)
+    {
+        switch (format)
+        {
+        case DepthFormat::Float32ReversedZ:
+            return "FLOAT32 REVERSED-Z";
+        case DepthFormat::Unorm16Linear:
+            return "UNORM16 LINEAR";
+        default:
+            return "UNKNOWN";
+        }
+    }
+
+    void DepthBuffer::FillTile(int beginX, int beginY, int endX, int endY)
+    {
+        for (int y{beginY}; y < endY; ++y)
+        {
+            const size_t rowBegin{static_cast<size_t>(beginX) + static_cast<size_t>(y) * m_Width};
+            if (m_Format == DepthFormat::Float32ReversedZ)
+            {
+                std::fill_n(m_Float32Buffer.begin() + rowBegin, endX - beginX, 0.0f);
+            }
+            else
+            {
+                std::fill_n(m_Unorm16Buffer.begin() + rowBegin, endX - beginX, uint16_t{65535});
+            }
+        }
+    }
+}
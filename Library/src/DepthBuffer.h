@@ -0,0 +1,100 @@
+#pragma once
+
+// Project includes
+#include "TileClearMask.h"
+
+// Standard includes
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace dae
+{
+    enum class DepthFormat
+    {
+        Float32ReversedZ, // 4 bytes, 1 = near plane, 0 = far plane: float precision where depth values are small
+        Unorm16Linear,    // 2 bytes, linear view depth between the near and far plane (W-buffer)
+
+        COUNT
+    };
+
+    /**
+     * \brief Depth buffer with a selectable storage format and per-tile fast clears.
+     * Clear only flags the tiles, a tile is filled with the clear value the first time
+     * a triangle's bounding box touches it (PrepareTiles), so untouched tiles cost nothing.
+     * Depth goes in as the perspective-correct 1/w, which is linear in screen space.
+     */
+    class DepthBuffer final
+    {
+    public:
+        static constexpr int s_TileSize{TileClearMask::s_TileSize};
+
+        DepthBuffer(int width, int height, DepthFormat format = DepthFormat::Float32ReversedZ);
+        ~DepthBuffer() = default;
+
+        DepthBuffer(const DepthBuffer&)                = delete;
+        DepthBuffer(DepthBuffer&&) noexcept            = delete;
+        DepthBuffer& operator=(const DepthBuffer&)     = delete;
+        DepthBuffer& operator=(DepthBuffer&&) noexcept = delete;
+
+        void SetFormat(DepthFormat format);
+        void SetDepthRange(float nearPlane, float farPlane);
+
+        void Clear();
+        void PrepareTiles(int minX, int minY, int maxX, int maxY);
+
+        // [0, 1] inside the frustum, 1 = near plane
+        inline float GetReversedDepth(float invW) const { return m_DepthScale * invW + m_DepthBias; }
+
+        /**
+         * \brief Depth test + write, the pixel's tile must have been prepared
+         * \param index pixel index
+         * \param invW interpolated 1/w of the pixel
+         * \return true if the pixel is closer than what is stored
+         */
+        inline bool TestAndWrite(int index, float invW)
+        {
+            if (m_Format == DepthFormat::Float32ReversedZ)
+            {
+                const float depth{GetReversedDepth(invW)};
+                float& stored{m_Float32Buffer[index]};
+                if (depth <= stored) return false;
+                stored = depth;
+                return true;
+            }
+
+            const auto depth{static_cast<uint16_t>(std::clamp((1.0f / invW - m_NearPlane) * m_LinearScale, 0.0f, 65535.0f))};
+            uint16_t& stored{m_Unorm16Buffer[index]};
+            if (depth >= stored) return false;
+            stored = depth;
+            return true;
+        }
+
+        // Linear view depth, also for tiles that were never touched (far plane)
+        float GetViewDepth(int x, int y) const;
+
+        inline DepthFormat GetFormat()        const { return m_Format; }
+        inline int         GetWidth()         const { return m_Width;  }
+        inline int         GetHeight()        const { return m_Height; }
+        inline int         GetBytesPerPixel() const { return m_Format == DepthFormat::Float32ReversedZ ? 4 : 2; }
+        static const char* GetFormatName(DepthFormat format);
+
+    private:
+        void FillTile(int beginX, int beginY, int endX, int endY);
+
+        int         m_Width  {0};
+        int         m_Height {0};
+        DepthFormat m_Format {DepthFormat::Float32ReversedZ};
+
+        std::vector<float>    m_Float32Buffer {};
+        std::vector<uint16_t> m_Unorm16Buffer {};
+
+        TileClearMask m_TileMask;
+
+        float m_NearPlane   {0.1f};
+        float m_FarPlane    {100.0f};
+        float m_DepthScale  {0.0f};
+        float m_DepthBias   {0.0f};
+        float m_LinearScale {0.0f};
+    };
+}
@@ -0,0 +1,93 @@
+#include "DynamicResolution.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace dae
+{
+    DynamicResolution::DynamicResolution(int maxWidth, int maxHeight) :
+        m_MaxWidth{maxWidth},
+        m_MaxHeight{maxHeight}
+    {
+        assert(maxWidth > 0 and maxHeight > 0 and "DynamicResolution::DynamicResolution: Invalid dimensions");
+
+        ApplyScale(m_MaxScale);
+    }
+
+    void DynamicResolution::SetBudget(float budgetMs)
+    {
+        assert(budgetMs > 0.0f and "DynamicResolution::SetBudget: Budget must be positive");
+
+        m_BudgetMs = budgetMs;
+    }
+
+    void DynamicResolution::SetScaleRange(float minScale, float maxScale)
+    {
+        assert(minScale > 0.0f and minScale <= maxScale and maxScale <= 1.0f and "DynamicResolution::SetScaleRange: Invalid range");
+
+        m_MinScale = minScale;
+        m_MaxScale = maxScale;
+        ApplyScale(std::clamp(m_Scale, m_MinScale, m_MaxScale));
+    }
+
+    /**
+     * \brief Feeds the raster time of the frame that was rendered at the current resolution
+     * \param rasterMs
+     * \return true if the next frame should use a different resolution
+     */
+    bool DynamicResolution::Update(float rasterMs)
+    {
+        if (not m_HasSample)
+        {
+            m_SmoothedMs = rasterMs;
+            m_HasSample  = true;
+        }
+        else
+        {
+            m_SmoothedMs += (rasterMs - m_SmoothedMs) * s_Smoothing;
+        }
+
+        if (m_SmoothedMs <= 0.0f) return false;
+
+        // Inside the band below the budget nothing changes
+        if (m_SmoothedMs <= m_BudgetMs and m_SmoothedMs >= m_BudgetMs * s_LowerBound) return false;
+
+        float scale{m_Scale * std::sqrt(m_BudgetMs * s_Target / m_SmoothedMs)};
+        scale = std::clamp(scale, m_Scale * (1.0f - s_MaxStep), m_Scale * (1.0f + s_MaxStep));
+        scale = std::clamp(scale, m_MinScale, m_MaxScale);
+
+        const int previousPixels{m_Width * m_Height};
+        if (not ApplyScale(scale)) return false;
+
+        // The smoothed time was measured at the old resolution
+        m_SmoothedMs *= static_cast<float>(m_Width * m_Height) / static_cast<float>(previousPixels);
+        return true;
+    }
+
+    void DynamicResolution::Reset()
+    {
+        m_HasSample  = false;
+        m_SmoothedMs = 0.0f;
+        ApplyScale(m_MaxScale);
+    }
+
+    bool DynamicResolution::ApplyScale(float scale)
+    {
+        m_Scale = scale;
+
+        int width{m_MaxWidth};
+        if (scale < 1.0f)
+        {
+            width = static_cast<int>(std::lround(static_cast<float>(m_MaxWidth) * scale / 8.0f)) * 8;
+            width = std::clamp(width, std::min(8, m_MaxWidth), m_MaxWidth);
+        }
+        // Same aspect ratio as the output, so the camera doesn't change
+        const int height{std::clamp(static_cast<int>(std::lround(static_cast<float>(m_MaxHeight) * width / m_MaxWidth)), 1, m_MaxHeight)};
+
+        const bool hasChanged{width != m_Width or height != m_Height};
+        m_Width  = width;
+        m_Height = height;
+        return hasChanged;
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+namespace dae
+{
+    /**
+     * \brief Picks the internal render resolution from the measured raster time.
+     * The pixel count is assumed to drive the cost, so the scale (per axis) follows sqrt(budget / time).
+     * The time is smoothed and the scale changes at most s_MaxStep per frame so it doesn't oscillate,
+     * and the width stays a multiple of 8 so the tiles of the render targets line up.
+     */
+    class DynamicResolution final
+    {
+    public:
+        DynamicResolution(int maxWidth, int maxHeight);
+        ~DynamicResolution() = default;
+
+        DynamicResolution(const DynamicResolution&)                = default;
+        DynamicResolution(DynamicResolution&&) noexcept            = default;
+        DynamicResolution& operator=(const DynamicResolution&)     = default;
+        DynamicResolution& operator=(DynamicResolution&&) noexcept = default;
+
+        void SetBudget(float budgetMs);
+        void SetScaleRange(float minScale, float maxScale);
+
+        // Returns true if the resolution changed
+        bool Update(float rasterMs);
+        void Reset();
+
+        inline float GetScale()      const { return m_Scale;  }
+        inline int   GetWidth()      const { return m_Width;  }
+        inline int   GetHeight()     const { return m_Height; }
+        inline float GetBudget()     const { return m_BudgetMs; }
+        inline float GetSmoothedMs() const { return m_SmoothedMs; }
+
+    private:
+        static constexpr float s_Smoothing  {0.2f};  // Weight of the newest sample
+        static constexpr float s_MaxStep    {0.1f};  // Relative scale change per frame
+        static constexpr float s_LowerBound {0.85f}; // Only scale up below this fraction of the budget
+        static constexpr float s_Target     {0.92f}; // Fraction of the budget a change aims for
+
+        bool ApplyScale(float scale);
+
+        int   m_MaxWidth  {0};
+        int   m_MaxHeight {0};
+        int   m_Width     {0};
+        int   m_Height    {0};
+
+        float m_BudgetMs   {16.6f};
+        float m_MinScale   {0.5f};
+        float m_MaxScale   {1.0f};
+        float m_Scale      {1.0f};
+        float m_SmoothedMs {0.0f};
+        bool  m_HasSample  {false};
+    };
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+// Standard includes
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include "SIMD.h"
+#include "Vector3.h"
+
+namespace dae
+{
+    /**
+     * \brief Exact uses the library functions and plain divides, Fast the approximations below.
+     * Exact renders the same image as before, Fast trades the last bits for speed, compare both with the golden image test.
+     */
+    enum class MathPrecision : uint8_t
+    {
+        Exact,
+        Fast
+    };
+
+    inline const char* GetMathPrecisionName(MathPrecision precision)
+    {
+        return precision == MathPrecision::Fast ? "fast" : "exact";
+    }
+
+#pragma region Approximations
+    /**
+     * \brief 1 / sqrt(x) for x > 0, hardware estimate + Newton step. Max relative error 3e-7 (SSE / NEON), exact without SIMD
+     */
+    inline float FastRsqrt(float x)
+    {
+#if SIMD_SSE
+        const float estimate{_mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)))};
+        return estimate * (1.5f - 0.5f * x * estimate * estimate);
+#elif SIMD_NEON
+        float estimate{vrsqrtes_f32(x)};
+        estimate *= vrsqrtss_f32(x * estimate, estimate);
+        return estimate * vrsqrtss_f32(x * estimate, estimate);
+#else
+        return 1.0f / std::sqrt(x);
+#endif
+    }
+
+    /**
+     * \brief 1 / x for x != 0, hardware estimate + Newton step. Max relative error 2e-7 (SSE / NEON), exact without SIMD
+     */
+    inline float FastReciprocal(float x)
+    {
+#if SIMD_SSE
+        const float estimate{_mm_cvtss_f32(_mm_rcp_ss(_mm_set_ss(x)))};
+        return estimate * (2.0f - x * estimate);
+#elif SIMD_NEON
+        float estimate{vrecpes_f32(x)};
+        estimate *= vrecpss_f32(x, estimate);
+        return estimate * vrecpss_f32(x, estimate);
+#else
+        return 1.0f / x;
+#endif
+    }
+
+    /**
+     * \brief 2^x, exponent bits + polynomial on [-0.5, 0.5] (Cephes exp2f). Max relative error 1e-7,
+     * below -126 it is 0 (no denormals), above 127 it stays at 2^127 (no infinity)
+     */
+    inline float FastExp2(float x)
+    {
+        if (x < -126.0f) return 0.0f;
+        x = x > 127.0f ? 127.0f : x;
+
+        // Round to nearest without a library call: adding 1.5 * 2^23 pushes the fraction out of the mantissa
+        const float whole{(x + 12582912.0f) - 12582912.0f};
+        const float f{x - whole};
+        const float p{((((((1.535336188319500e-4f * f + 1.339887440266574e-3f) * f + 9.618437357674640e-3f) * f
+            + 5.550332471162809e-2f) * f + 2.402264791363012e-1f) * f + 6.931472028550421e-1f) * f + 1.0f)};
+
+        const uint32_t exponentBits{static_cast<uint32_t>(static_cast<int32_t>(whole) + 127) << 23};
+        float scale;
+        std::memcpy(&scale, &exponentBits, sizeof(scale));
+        return p * scale;
+    }
+
+    /**
+     * \brief log2(x) for normal x > 0, exponent bits + polynomial on [sqrt(0.5), sqrt(2)) (Cephes logf).
+     * Max absolute error 1e-7 in [0.5, 2], further out the rounding of the result dominates (1e-6 at |log2(x)| = 20)
+     */
+    inline float FastLog2(float x)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        int exponent{static_cast<int>((bits >> 23) & 0xFF) - 127};
+
+        // Mantissa in [1, 2), moved to [sqrt(0.5), sqrt(2)) where the polynomial is centered around 1
+        bits = (bits & 0x007FFFFF) | 0x3F800000;
+        float m;
+        std::memcpy(&m, &bits, sizeof(m));
+        if (m > 1.41421356f)
+        {
+            m *= 0.5f;
+            ++exponent;
+        }
+
+        const float t{m - 1.0f};
+        const float t2{t * t};
+        float p{7.0376836292e-2f};
+        p = p * t - 1.1514610310e-1f;
+        p = p * t + 1.1676998740e-1f;
+        p = p * t - 1.2420140846e-1f;
+        p = p * t + 1.4249322787e-1f;
+        p = p * t - 1.6668057665e-1f;
+        p = p * t + 2.0000714765e-1f;
+        p = p * t - 2.4999993993e-1f;
+        p = p * t + 3.3333331174e-1f;
+        const float ln{t + (p * t * t2 - 0.5f * t2)};
+
+        return ln * 1.44269504088896341f + static_cast<float>(exponent);
+    }
+
+    /**
+     * \brief x^y for x >= 0 as 2^(y * log2(x)), the log error is scaled by y.
+     * Max relative error 7e-6 for x in (0, 1] and y up to 25 (a Phong lobe), 0^0 = 1, results below 2^-126 are 0
+     */
+    inline float FastPow(float x, float y)
+    {
+        if (x <= 0.0f)
+        {
+            return y == 0.0f ? 1.0f : 0.0f;
+        }
+        return FastExp2(y * FastLog2(x));
+    }
+#pragma endregion
+
+#pragma region Precision Dispatch
+    // The precision is the same for a whole frame, the branch predicts perfectly
+
+    inline float Reciprocal(float x, MathPrecision precision)
+    {
+        return precision == MathPrecision::Fast ? FastReciprocal(x) : 1.0f / x;
+    }
+
+    inline float Pow(float x, float y, MathPrecision precision)
+    {
+        return precision == MathPrecision::Fast ? FastPow(x, y) : static_cast<float>(pow(x, y));
+    }
+
+    inline Vector3 Normalized(const Vector3& v, MathPrecision precision)
+    {
+        return precision == MathPrecision::Fast ? v * FastRsqrt(v.SqrMagnitude()) : v.Normalized();
+    }
+#pragma endregion
+}
@@ -0,0 +1,126 @@
+#include "FrameArena.h"
+#include "AllocationTracker.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace dae
+{
+#pragma region LinearArena
+    LinearArena::LinearArena(size_t initialCapacity)
+    {
+        if (initialCapacity > 0)
+        {
+            AddBlock(initialCapacity);
+        }
+    }
+
+    void* LinearArena::Allocate(size_t bytes, size_t alignment)
+    {
+        assert(alignment > 0 and (alignment & (alignment - 1)) == 0 and "LinearArena::Allocate: Alignment must be a power of two");
+
+        if (not m_Blocks.empty())
+        {
+            Block& block{m_Blocks.back()};
+            const auto base{reinterpret_cast<uintptr_t>(block.dataPtr.get())};
+            const size_t alignedOffset{((base + m_Offset + alignment - 1) & ~(alignment - 1)) - base};
+            if (alignedOffset + bytes <= block.size)
+            {
+                m_UsedBytes += alignedOffset + bytes - m_Offset;
+                m_Offset     = alignedOffset + bytes;
+                m_PeakBytes  = std::max(m_PeakBytes, m_UsedBytes);
+                return block.dataPtr.get() + alignedOffset;
+            }
+        }
+
+        // Doesn't fit, chain a new block (merged on the next Reset)
+        AddBlock(std::max(bytes + alignment, m_Capacity));
+
+        Block& block{m_Blocks.back()};
+        const auto base{reinterpret_cast<uintptr_t>(block.dataPtr.get())};
+        const size_t alignedOffset{((base + alignment - 1) & ~(alignment - 1)) - base};
+        m_UsedBytes += alignedOffset + bytes;
+        m_Offset     = alignedOffset + bytes;
+        m_PeakBytes  = std::max(m_PeakBytes, m_UsedBytes);
+        return block.dataPtr.get() + alignedOffset;
+    }
+
+    void LinearArena::Reset()
+    {
+        // Several blocks means the last frame overflowed: replace them with one block that fits the peak
+        // (plus some headroom, alignment padding depends on where the new block lands)
+        if (m_Blocks.size() > 1)
+        {
+            m_Blocks.clear();
+            m_Capacity = 0;
+            AddBlock(m_PeakBytes + m_PeakBytes / 4);
+        }
+
+        m_Offset    = 0;
+        m_UsedBytes = 0;
+    }
+
+    void LinearArena::AddBlock(size_t minimumSize)
+    {
+        ALLOCATION_SCOPE("FrameArena");
+
+        Block block{};
+        block.size    = minimumSize;
+        block.dataPtr = std::make_unique_for_overwrite<std::byte[]>(minimumSize);
+
+        m_Capacity += block.size;
+        m_Offset    = 0;
+        ++m_UpstreamAllocations;
+
+        m_Blocks.push_back(std::move(block));
+    }
+#pragma endregion
+
+#pragma region FrameArena
+    FrameArena::FrameArena(uint32_t workerCount, size_t mainCapacity, size_t workerCapacity) :
+        m_MainPtr{std::make_unique<LinearArena>(mainCapacity)}
+    {
+        m_WorkerPtrs.reserve(workerCount);
+        for (uint32_t idx{0}; idx < workerCount; ++idx)
+        {
+            m_WorkerPtrs.push_back(std::make_unique<LinearArena>(workerCapacity));
+        }
+        m_UpstreamAllocationsAtReset = GetUpstreamAllocations();
+    }
+
+    void FrameArena::Reset()
+    {
+        const uint64_t upstreamAllocations{GetUpstreamAllocations()};
+        m_LastFrameUpstreamAllocations = upstreamAllocations - m_UpstreamAllocationsAtReset;
+
+        m_MainPtr->Reset();
+        for (auto& workerPtr : m_WorkerPtrs)
+        {
+            workerPtr->Reset();
+        }
+
+        // Merging overflow blocks allocates as well, keep that out of the next frame's count
+        m_UpstreamAllocationsAtReset = GetUpstreamAllocations();
+    }
+
+    uint64_t FrameArena::GetUpstreamAllocations() const
+    {
+        uint64_t upstreamAllocations{m_MainPtr->GetUpstreamAllocations()};
+        for (const auto& workerPtr : m_WorkerPtrs)
+        {
+            upstreamAllocations += workerPtr->GetUpstreamAllocations();
+        }
+        return upstreamAllocations;
+    }
+
+    size_t FrameArena::GetUsedBytes() const
+    {
+        size_t usedBytes{m_MainPtr->GetUsedBytes()};
+        for (const auto& workerPtr : m_WorkerPtrs)
+        {
+            usedBytes += workerPtr->GetUsedBytes();
+        }
+        return usedBytes;
+    }
+#pragma endregion
+}
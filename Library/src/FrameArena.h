@@ -0,0 +1,105 @@
+#pragma once
+
+// Standard includes
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace dae
+{
+    /**
+     * \brief Bump allocator for data that lives for one frame only.
+     * Allocating is a pointer increment, Reset rewinds everything at once (no destructors are run).
+     * When a frame needs more than the current block, extra blocks are chained in; on the next Reset
+     * they are merged into one block big enough for the peak, so a steady frame loop stops allocating.
+     */
+    class LinearArena final
+    {
+    public:
+        explicit LinearArena(size_t initialCapacity = 0);
+        ~LinearArena() = default;
+
+        LinearArena(const LinearArena&)                = delete;
+        LinearArena(LinearArena&&) noexcept            = delete;
+        LinearArena& operator=(const LinearArena&)     = delete;
+        LinearArena& operator=(LinearArena&&) noexcept = delete;
+
+        void* Allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+        // Default-constructed array, T must not need a destructor since Reset never runs one
+        template <typename T>
+        T* Allocate(size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "LinearArena::Allocate: Type needs a destructor");
+
+            T* dataPtr = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+            for (size_t idx{0}; idx < count; ++idx)
+            {
+                ::new (static_cast<void*>(dataPtr + idx)) T{};
+            }
+            return dataPtr;
+        }
+
+        void Reset();
+
+        inline size_t   GetUsedBytes()          const { return m_UsedBytes; }
+        inline size_t   GetPeakBytes()          const { return m_PeakBytes; }
+        inline size_t   GetCapacity()           const { return m_Capacity; }
+        // Number of times this arena went to the heap, stays constant once the frame loop is warmed up
+        inline uint64_t GetUpstreamAllocations() const { return m_UpstreamAllocations; }
+
+    private:
+        struct Block
+        {
+            std::unique_ptr<std::byte[]> dataPtr {};
+            size_t                       size    {0};
+        };
+
+        void AddBlock(size_t minimumSize);
+
+        std::vector<Block> m_Blocks {};
+        size_t m_Offset    {0}; // Into the last block
+        size_t m_UsedBytes {0};
+        size_t m_PeakBytes {0};
+        size_t m_Capacity  {0};
+
+        uint64_t m_UpstreamAllocations {0};
+    };
+
+    /**
+     * \brief One arena for the frame (main) plus one sub-arena per worker thread,
+     * so parallel stages can allocate without locking. Everything is reset together at the start of a frame.
+     */
+    class FrameArena final
+    {
+    public:
+        FrameArena(uint32_t workerCount, size_t mainCapacity, size_t workerCapacity);
+        ~FrameArena() = default;
+
+        FrameArena(const FrameArena&)                = delete;
+        FrameArena(FrameArena&&) noexcept            = delete;
+        FrameArena& operator=(const FrameArena&)     = delete;
+        FrameArena& operator=(FrameArena&&) noexcept = delete;
+
+        void Reset();
+
+        inline LinearArena& GetMain()                         { return *m_MainPtr; }
+        inline LinearArena& GetWorker(uint32_t workerIndex)    { return *m_WorkerPtrs[workerIndex]; }
+        inline uint32_t     GetWorkerCount()             const { return static_cast<uint32_t>(m_WorkerPtrs.size()); }
+
+        // Heap allocations of all arenas during the last finished frame (between the last two Resets)
+        inline uint64_t GetLastFrameUpstreamAllocations() const { return m_LastFrameUpstreamAllocations; }
+        uint64_t        GetUpstreamAllocations()          const;
+        size_t          GetUsedBytes()                    const;
+
+    private:
+        std::unique_ptr<LinearArena>              m_MainPtr    {};
+        std::vector<std::unique_ptr<LinearArena>> m_WorkerPtrs {};
+
+        uint64_t m_UpstreamAllocationsAtReset    {0};
+        uint64_t m_LastFrameUpstreamAllocations  {0};
+    };
+}
@@ -0,0 +1,148 @@
+#include "FrameBuffer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+
+namespace dae
+{
+    FrameBuffer::FrameBuffer(int width, int height) :
+        m_Width{width},
+        m_Height{height},
+        m_ViewportWidth{width},
+        m_ViewportHeight{height}
+    {
+        assert(width > 0 and height > 0 and "FrameBuffer::FrameBuffer: Invalid dimensions");
+
+        m_ColorBuffer.resize(static_cast<size_t>(width) * height);
+        m_DepthBuffer.resize(static_cast<size_t>(width) * height);
+    }
+
+    void FrameBuffer::ClearColor(uint32_t color)
+    {
+        std::fill_n(m_ColorBuffer.begin(), m_ColorBuffer.size(), color);
+    }
+
+    void FrameBuffer::ClearDepth(float depth)
+    {
+        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), depth);
+    }
+
+    void FrameBuffer::SetViewport(int width, int height)
+    {
+        assert(width > 0 and width <= m_Width and height > 0 and height <= m_Height and "FrameBuffer::SetViewport: Invalid viewport");
+
+        m_ViewportWidth  = width;
+        m_ViewportHeight = height;
+    }
+
+    /**
+     * \brief Writes the viewport of the color buffer as an uncompressed 32-bit BMP
+     * \param path
+     * \return true on success
+     */
+    bool FrameBuffer::SaveToBMP(const std::string& path) const
+    {
+        std::ofstream file(path, std::ios::binary);
+        if (not file) return false;
+
+        const uint32_t pixelBytes{static_cast<uint32_t>(static_cast<size_t>(m_ViewportWidth) * m_ViewportHeight * sizeof(uint32_t))};
+        const uint32_t headerBytes{14 + 40};
+        const uint32_t fileBytes{headerBytes + pixelBytes};
+
+        const auto write16 = [&file](uint16_t value) { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+        const auto write32 = [&file](uint32_t value) { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+        // File header
+        file.write("BM", 2);
+        write32(fileBytes);
+        write32(0);
+        write32(headerBytes);
+
+        // Info header
+        write32(40);
+        write32(static_cast<uint32_t>(m_ViewportWidth));
+        write32(static_cast<uint32_t>(m_ViewportHeight));
+        write16(1);  // planes
+        write16(32); // bits per pixel
+        write32(0);  // BI_RGB
+        write32(pixelBytes);
+        write32(2835); // 72 DPI
+        write32(2835);
+        write32(0);
+        write32(0);
+
+        // Bottom-up rows, BMP wants B, G, R, X per pixel
+        std::vector<uint8_t> row(static_cast<size_t>(m_ViewportWidth) * 4);
+        for (int y{m_ViewportHeight - 1}; y >= 0; --y)
+        {
+            for (int x{0}; x < m_ViewportWidth; ++x)
+            {
+                const uint32_t pixel{m_ColorBuffer[x + (static_cast<size_t>(y) * m_Width)]};
+                row[x * 4]     = UnpackB(pixel);
+                row[x * 4 + 1] = UnpackG(pixel);
+                row[x * 4 + 2] = UnpackR(pixel);
+                row[x * 4 + 3] = 0;
+            }
+            file.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+        }
+
+        return file.good();
+    }
+
+    /**
+     * \brief Writes the viewport of the color buffer as a binary (P6) PPM
+     * \param path
+     * \return true on success
+     */
+    bool FrameBuffer::SaveToPPM(const std::string& path) const
+    {
+        std::ofstream file(path, std::ios::binary);
+        if (not file) return false;
+
+        file << "P6\n" << m_ViewportWidth << " " << m_ViewportHeight << "\n255\n";
+
+        std::vector<uint8_t> row(static_cast<size_t>(m_ViewportWidth) * 3);
+        for (int y{0}; y < m_ViewportHeight; ++y)
+        {
+            for (int x{0}; x < m_ViewportWidth; ++x)
+            {
+                const uint32_t pixel{m_ColorBuffer[x + (static_cast<size_t>(y) * m_Width)]};
+                row[x * 3]     = UnpackR(pixel);
+                row[x * 3 + 1] = UnpackG(pixel);
+                row[x * 3 + 2] = UnpackB(pixel);
+            }
+            file.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+        }
+
+        return file.good();
+    }
+
+    /**
+     * \brief Dumps the color buffer as-is (width * height * RGBA8, row-major, no header)
+     * \param path
+     * \return true on success
+     */
+    bool FrameBuffer::SaveColorRaw(const std::string& path) const
+    {
+        std::ofstream file(path, std::ios::binary);
+        if (not file) return false;
+
+        file.write(reinterpret_cast<const char*>(m_ColorBuffer.data()), static_cast<std::streamsize>(m_ColorBuffer.size() * sizeof(uint32_t)));
+        return file.good();
+    }
+
+    /**
+     * \brief Dumps the depth buffer as-is (width * height * float, row-major, no header)
+     * \param path
+     * \return true on success
+     */
+    bool FrameBuffer::SaveDepthRaw(const std::string& path) const
+    {
+        std::ofstream file(path, std::ios::binary);
+        if (not file) return false;
+
+        file.write(reinterpret_cast<const char*>(m_DepthBuffer.data()), static_cast<std::streamsize>(m_DepthBuffer.size() * sizeof(float)));
+        return file.good();
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+// Standard includes
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dae
+{
+    /**
+     * \brief Plain memory color + depth target the rasterizer renders into.
+     * Has no knowledge of SDL, so it can be used without a window (headless rendering).
+     * Color pixels are RGBA8 in byte order (R, G, B, A in memory, SDL_PIXELFORMAT_RGBA32),
+     * so the shading loop can store packed values and the presenter can upload them as-is.
+     */
+    class FrameBuffer final
+    {
+    public:
+        FrameBuffer(int width, int height);
+        ~FrameBuffer() = default;
+
+        FrameBuffer(const FrameBuffer&)                = delete;
+        FrameBuffer(FrameBuffer&&) noexcept            = delete;
+        FrameBuffer& operator=(const FrameBuffer&)     = delete;
+        FrameBuffer& operator=(FrameBuffer&&) noexcept = delete;
+
+        void ClearColor(uint32_t color);
+        void ClearDepth(float depth);
+
+        // Region at the top-left that is rendered (dynamic resolution), the rest of the buffer is left alone
+        void SetViewport(int width, int height);
+
+        bool SaveToBMP(const std::string& path) const;
+        bool SaveToPPM(const std::string& path) const;
+        bool SaveColorRaw(const std::string& path) const;
+        bool SaveDepthRaw(const std::string& path) const;
+
+        inline int GetWidth()  const { return m_Width;  }
+        inline int GetHeight() const { return m_Height; }
+        inline int GetViewportWidth()  const { return m_ViewportWidth;  }
+        inline int GetViewportHeight() const { return m_ViewportHeight; }
+
+        inline uint32_t*       GetColorBuffer()       { return m_ColorBuffer.data(); }
+        inline const uint32_t* GetColorBuffer() const { return m_ColorBuffer.data(); }
+        inline float*          GetDepthBuffer()       { return m_DepthBuffer.data(); }
+        inline const float*    GetDepthBuffer() const { return m_DepthBuffer.data(); }
+
+#pragma region Pixel packing
+        static constexpr uint32_t PackColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255)
+        {
+            if constexpr (std::endian::native == std::endian::little)
+                return static_cast<uint32_t>(r) | (static_cast<uint32_t>(g) << 8) | (static_cast<uint32_t>(b) << 16) | (static_cast<uint32_t>(a) << 24);
+            else
+                return (static_cast<uint32_t>(r) << 24) | (static_cast<uint32_t>(g) << 16) | (static_cast<uint32_t>(b) << 8) | static_cast<uint32_t>(a);
+        }
+
+        static constexpr uint8_t UnpackR(uint32_t pixel) { return static_cast<uint8_t>(std::endian::native == std::endian::little ? pixel       : pixel >> 24); }
+        static constexpr uint8_t UnpackG(uint32_t pixel) { return static_cast<uint8_t>(std::endian::native == std::endian::little ? pixel >> 8  : pixel >> 16); }
+        static constexpr uint8_t UnpackB(uint32_t pixel) { return static_cast<uint8_t>(std::endian::native == std::endian::little ? pixel >> 16 : pixel >> 8);  }
+#pragma endregion
+
+    private:
+        int m_Width          {0};
+        int m_Height         {0};
+        int m_ViewportWidth  {0};
+        int m_ViewportHeight {0};
+
+        std::vector<uint32_t> m_ColorBuffer {};
+        std::vector<float>    m_DepthBuffer {};
+    };
+}
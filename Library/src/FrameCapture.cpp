@@ -0,0 +1,386 @@
+#include "FrameCapture.h"
+#include "FrameBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+namespace dae
+{
+    namespace
+    {
+        const std::array<uint32_t, 256>& GetCrcTable()
+        {
+            static const std::array<uint32_t, 256> table{[]
+            {
+                std::array<uint32_t, 256> entries{};
+                for (uint32_t idx{0}; idx < 256; ++idx)
+                {
+                    uint32_t crc{idx};
+                    for (int bit{0}; bit < 8; ++bit)
+                    {
+                        crc = crc & 1 ? 0xEDB88320u ^ (crc >> 1) : crc >> 1;
+                    }
+                    entries[idx] = crc;
+                }
+                return entries;
+            }()};
+            return table;
+        }
+
+        // Running CRC-32 of a PNG chunk, start with ~0 and invert at the end
+        uint32_t UpdateCrc(uint32_t crc, const uint8_t* dataPtr, size_t size)
+        {
+            const auto& table{GetCrcTable()};
+            for (size_t idx{0}; idx < size; ++idx)
+            {
+                crc = table[(crc ^ dataPtr[idx]) & 0xFF] ^ (crc >> 8);
+            }
+            return crc;
+        }
+
+        uint32_t Adler32(const uint8_t* dataPtr, size_t size)
+        {
+            uint32_t a{1}, b{0};
+            for (size_t idx{0}; idx < size; ++idx)
+            {
+                a = (a + dataPtr[idx]) % 65521;
+                b = (b + a) % 65521;
+            }
+            return (b << 16) | a;
+        }
+
+        void WriteBigEndian(uint8_t* outPtr, uint32_t value)
+        {
+            outPtr[0] = static_cast<uint8_t>(value >> 24);
+            outPtr[1] = static_cast<uint8_t>(value >> 16);
+            outPtr[2] = static_cast<uint8_t>(value >> 8);
+            outPtr[3] = static_cast<uint8_t>(value);
+        }
+
+        // Length, type, data, CRC of type + data
+        void WriteChunk(std::ofstream& file, const char* type, const uint8_t* dataPtr, uint32_t size)
+        {
+            uint8_t header[8];
+            WriteBigEndian(header, size);
+            std::memcpy(header + 4, type, 4);
+            file.write(reinterpret_cast<const char*>(header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(dataPtr), size);
+
+            uint8_t crc[4];
+            WriteBigEndian(crc, ~UpdateCrc(UpdateCrc(~0u, header + 4, 4), dataPtr, size));
+            file.write(reinterpret_cast<const char*>(crc), sizeof(crc));
+        }
+
+        /**
+         * \brief RGB8 PNG whose zlib stream only has stored blocks. rows holds height rows of filter byte 0 + width * RGB.
+         * The IDAT is streamed: the CRC runs over the block headers and the rows as they are written
+         */
+        bool WritePNG(std::ofstream& file, int width, int height, const uint8_t* rowsPtr)
+        {
+            constexpr uint8_t signature[]{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+            file.write(reinterpret_cast<const char*>(signature), sizeof(signature));
+
+            uint8_t header[13]{};
+            WriteBigEndian(header, static_cast<uint32_t>(width));
+            WriteBigEndian(header + 4, static_cast<uint32_t>(height));
+            header[8] = 8; // Bits per channel
+            header[9] = 2; // RGB
+            WriteChunk(file, "IHDR", header, sizeof(header));
+
+            constexpr size_t maxBlockSize{65535};
+            const size_t rawSize{static_cast<size_t>(height) * (1 + static_cast<size_t>(width) * 3)};
+            const size_t blockCount{(rawSize + maxBlockSize - 1) / maxBlockSize};
+            const uint32_t dataSize{static_cast<uint32_t>(2 + blockCount * 5 + rawSize + 4)};
+
+            uint8_t chunkHeader[8];
+            WriteBigEndian(chunkHeader, dataSize);
+            std::memcpy(chunkHeader + 4, "IDAT", 4);
+            file.write(reinterpret_cast<const char*>(chunkHeader), sizeof(chunkHeader));
+            uint32_t crc{UpdateCrc(~0u, chunkHeader + 4, 4)};
+
+            const auto write = [&file, &crc](const uint8_t* dataPtr, size_t size)
+            {
+                file.write(reinterpret_cast<const char*>(dataPtr), static_cast<std::streamsize>(size));
+                crc = UpdateCrc(crc, dataPtr, size);
+            };
+
+            // zlib header: deflate, 32K window, no preset dictionary, check bits
+            constexpr uint8_t zlibHeader[]{0x78, 0x01};
+            write(zlibHeader, sizeof(zlibHeader));
+            for (size_t offset{0}; offset < rawSize; offset += maxBlockSize)
+            {
+                const uint16_t size{static_cast<uint16_t>(std::min(maxBlockSize, rawSize - offset))};
+                const uint8_t blockHeader[5]{static_cast<uint8_t>(offset + size == rawSize ? 1 : 0),
+                                             static_cast<uint8_t>(size), static_cast<uint8_t>(size >> 8),
+                                             static_cast<uint8_t>(~size), static_cast<uint8_t>(~size >> 8)};
+                write(blockHeader, sizeof(blockHeader));
+                write(rowsPtr + offset, size);
+            }
+            uint8_t adler[4];
+            WriteBigEndian(adler, Adler32(rowsPtr, rawSize));
+            write(adler, sizeof(adler));
+
+            uint8_t crcBytes[4];
+            WriteBigEndian(crcBytes, ~crc);
+            file.write(reinterpret_cast<const char*>(crcBytes), sizeof(crcBytes));
+
+            WriteChunk(file, "IEND", nullptr, 0);
+            return file.good();
+        }
+    }
+
+#pragma region Constructor/Destructor
+    FrameCapture::FrameCapture(int maxWidth, int maxHeight, const Settings& settings) :
+        m_Settings{settings},
+        m_MaxWidth{maxWidth},
+        m_MaxHeight{maxHeight}
+    {
+        assert(maxWidth > 0 and maxHeight > 0 and "FrameCapture::FrameCapture: Invalid dimensions");
+        assert(settings.bufferCount > 0 and "FrameCapture::FrameCapture: Needs at least one buffer");
+        assert((not IsStream(settings.format) or not settings.streamPath.empty()) and "FrameCapture::FrameCapture: Stream formats need a stream path");
+
+        m_Buffers.resize(settings.bufferCount);
+        m_Queue.resize(settings.bufferCount);
+        m_FreeBuffers.reserve(settings.bufferCount);
+        for (int idx{settings.bufferCount - 1}; idx >= 0; --idx)
+        {
+            m_Buffers[idx].pixels.resize(static_cast<size_t>(maxWidth) * maxHeight);
+            m_FreeBuffers.push_back(idx);
+        }
+        // PNG rows with their filter byte, or the three Y4M planes
+        m_Scratch.resize(static_cast<size_t>(maxWidth) * maxHeight * 3 + maxHeight);
+
+        m_Thread = std::thread{&FrameCapture::Run, this};
+    }
+
+    FrameCapture::~FrameCapture()
+    {
+        {
+            std::lock_guard lock{m_Mutex};
+            m_IsRunning = false;
+        }
+        m_WorkCondition.notify_one();
+        m_Thread.join();
+    }
+#pragma endregion
+
+#pragma region Submit
+    /**
+     * \brief Copies the viewport, the only work the submitting thread does. Never touches a file
+     * \param frameBuffer
+     * \return false when the frame was dropped
+     */
+    bool FrameCapture::Submit(const FrameBuffer& frameBuffer)
+    {
+        const int width{frameBuffer.GetViewportWidth()};
+        const int height{frameBuffer.GetViewportHeight()};
+        assert(width <= m_MaxWidth and height <= m_MaxHeight and "FrameCapture::Submit: Frame larger than the buffers");
+
+        ++m_FramesSubmitted;
+        int bufferIdx;
+        {
+            std::unique_lock lock{m_Mutex};
+            if (m_FreeBuffers.empty())
+            {
+                if (m_Settings.backpressure == Backpressure::Drop)
+                {
+                    ++m_FramesDropped;
+                    return false;
+                }
+                m_FreeCondition.wait(lock, [this] { return not m_FreeBuffers.empty(); });
+            }
+            bufferIdx = m_FreeBuffers.back();
+            m_FreeBuffers.pop_back();
+        }
+
+        // The buffer belongs to this thread until it is queued
+        Buffer& buffer{m_Buffers[bufferIdx]};
+        buffer.width       = width;
+        buffer.height      = height;
+        buffer.frameNumber = m_FramesSubmitted;
+        const uint32_t* sourcePtr{frameBuffer.GetColorBuffer()};
+        for (int y{0}; y < height; ++y)
+        {
+            std::memcpy(buffer.pixels.data() + static_cast<size_t>(y) * width, sourcePtr + static_cast<size_t>(y) * frameBuffer.GetWidth(),
+                        width * sizeof(uint32_t));
+        }
+
+        {
+            std::lock_guard lock{m_Mutex};
+            m_Queue[(m_QueueHead + m_QueueSize) % m_Queue.size()] = bufferIdx;
+            ++m_QueueSize;
+        }
+        m_WorkCondition.notify_one();
+        return true;
+    }
+
+    void FrameCapture::Flush()
+    {
+        std::unique_lock lock{m_Mutex};
+        m_FreeCondition.wait(lock, [this] { return m_QueueSize == 0 and not m_IsWriting; });
+    }
+
+    uint64_t FrameCapture::GetFramesWritten() const
+    {
+        std::lock_guard lock{m_Mutex};
+        return m_FramesWritten;
+    }
+
+    uint64_t FrameCapture::GetFramesDropped() const
+    {
+        std::lock_guard lock{m_Mutex};
+        return m_FramesDropped;
+    }
+
+    uint64_t FrameCapture::GetFramesFailed() const
+    {
+        std::lock_guard lock{m_Mutex};
+        return m_FramesFailed;
+    }
+
+    const char* FrameCapture::GetFormatName(CaptureFormat format)
+    {
+        switch (format)
+        {
+        case CaptureFormat::PNG:
+            return "PNG";
+        case CaptureFormat::PPM:
+            return "PPM";
+        case CaptureFormat::Raw:
+            return "RAW";
+        case CaptureFormat::Y4M:
+            return "Y4M";
+        default:
+            return "UNKNOWN";
+        }
+    }
+
+    bool FrameCapture::IsStream(CaptureFormat format)
+    {
+        return format == CaptureFormat::Raw or format == CaptureFormat::Y4M;
+    }
+#pragma endregion
+
+#pragma region Writer
+    // Drains the queue before it stops, frames submitted before the destructor are all written
+    void FrameCapture::Run()
+    {
+        while (true)
+        {
+            int bufferIdx;
+            {
+                std::unique_lock lock{m_Mutex};
+                m_WorkCondition.wait(lock, [this] { return m_QueueSize > 0 or not m_IsRunning; });
+                if (m_QueueSize == 0) return;
+
+                bufferIdx = m_Queue[m_QueueHead];
+                m_QueueHead = (m_QueueHead + 1) % static_cast<int>(m_Queue.size());
+                --m_QueueSize;
+                m_IsWriting = true;
+            }
+
+            const Buffer& buffer{m_Buffers[bufferIdx]};
+            // A stream can not change its frame size, such a frame is dropped like one without a free buffer
+            const bool isResized{IsStream(m_Settings.format) and m_StreamWidth > 0
+                and (buffer.width != m_StreamWidth or buffer.height != m_StreamHeight)};
+            const bool isWritten{not isResized and Write(buffer)};
+
+            {
+                std::lock_guard lock{m_Mutex};
+                if (isResized)      ++m_FramesDropped;
+                else if (isWritten) ++m_FramesWritten;
+                else                ++m_FramesFailed;
+                m_FreeBuffers.push_back(bufferIdx);
+                m_IsWriting = false;
+            }
+            m_FreeCondition.notify_all();
+        }
+    }
+
+    bool FrameCapture::Write(const Buffer& buffer)
+    {
+        return IsStream(m_Settings.format) ? WriteStream(buffer) : WriteImage(buffer);
+    }
+
+    bool FrameCapture::WriteImage(const Buffer& buffer)
+    {
+        char number[32];
+        std::snprintf(number, sizeof(number), "_%06llu", static_cast<unsigned long long>(buffer.frameNumber));
+        const bool isPNG{m_Settings.format == CaptureFormat::PNG};
+        std::ofstream file(m_Settings.outputPrefix + number + (isPNG ? ".png" : ".ppm"), std::ios::binary);
+        if (not file) return false;
+
+        // Rows of RGB8, PNG rows start with their filter type (0, none)
+        const size_t rowSize{static_cast<size_t>(buffer.width) * 3 + (isPNG ? 1 : 0)};
+        for (int y{0}; y < buffer.height; ++y)
+        {
+            uint8_t* rowPtr{m_Scratch.data() + y * rowSize};
+            if (isPNG) *rowPtr++ = 0;
+            const uint32_t* pixelsPtr{buffer.pixels.data() + static_cast<size_t>(y) * buffer.width};
+            for (int x{0}; x < buffer.width; ++x)
+            {
+                rowPtr[x * 3]     = FrameBuffer::UnpackR(pixelsPtr[x]);
+                rowPtr[x * 3 + 1] = FrameBuffer::UnpackG(pixelsPtr[x]);
+                rowPtr[x * 3 + 2] = FrameBuffer::UnpackB(pixelsPtr[x]);
+            }
+        }
+
+        if (isPNG)
+        {
+            return WritePNG(file, buffer.width, buffer.height, m_Scratch.data());
+        }
+        file << "P6\n" << buffer.width << " " << buffer.height << "\n255\n";
+        file.write(reinterpret_cast<const char*>(m_Scratch.data()), static_cast<std::streamsize>(rowSize * buffer.height));
+        return file.good();
+    }
+
+    /**
+     * \brief The stream is opened by the first frame, on this thread: opening a named pipe waits for its reader
+     */
+    bool FrameCapture::WriteStream(const Buffer& buffer)
+    {
+        const size_t pixelCount{static_cast<size_t>(buffer.width) * buffer.height};
+        if (not m_Stream.is_open())
+        {
+            m_Stream.open(m_Settings.streamPath, std::ios::binary);
+            if (not m_Stream) return false;
+
+            m_StreamWidth  = buffer.width;
+            m_StreamHeight = buffer.height;
+            if (m_Settings.format == CaptureFormat::Y4M)
+            {
+                m_Stream << "YUV4MPEG2 W" << buffer.width << " H" << buffer.height << " F" << m_Settings.frameRate << ":1 Ip A1:1 C444\n";
+            }
+        }
+
+        if (m_Settings.format == CaptureFormat::Raw)
+        {
+            m_Stream.write(reinterpret_cast<const char*>(buffer.pixels.data()), static_cast<std::streamsize>(pixelCount * sizeof(uint32_t)));
+            // A reader on the other end of a pipe gets whole frames right away
+            m_Stream.flush();
+            return m_Stream.good();
+        }
+
+        // BT.601 studio range in integers, the usual RGB -> YCbCr of video tools
+        uint8_t* yPtr{m_Scratch.data()};
+        uint8_t* uPtr{yPtr + pixelCount};
+        uint8_t* vPtr{uPtr + pixelCount};
+        for (size_t idx{0}; idx < pixelCount; ++idx)
+        {
+            const int r{FrameBuffer::UnpackR(buffer.pixels[idx])};
+            const int g{FrameBuffer::UnpackG(buffer.pixels[idx])};
+            const int b{FrameBuffer::UnpackB(buffer.pixels[idx])};
+            yPtr[idx] = static_cast<uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+            uPtr[idx] = static_cast<uint8_t>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+            vPtr[idx] = static_cast<uint8_t>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+        }
+        m_Stream.write("FRAME\n", 6);
+        m_Stream.write(reinterpret_cast<const char*>(m_Scratch.data()), static_cast<std::streamsize>(pixelCount * 3));
+        m_Stream.flush();
+        return m_Stream.good();
+    }
+#pragma endregion
+}
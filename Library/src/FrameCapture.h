@@ -0,0 +1,118 @@
+#pragma once
+
+// Standard includes
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dae
+{
+    // Forward Declarations
+    class FrameBuffer;
+
+    enum class CaptureFormat : uint8_t
+    {
+        PNG, // Numbered files, RGB8 in stored (uncompressed) deflate blocks: no zlib needed, any viewer reads it
+        PPM, // Numbered files, binary P6 like FrameBuffer::SaveToPPM
+        Raw, // One stream, RGBA8 frames back to back (ffmpeg -f rawvideo -pix_fmt rgba -s WxH)
+        Y4M, // One stream, YUV4MPEG2 4:4:4 (ffmpeg / ffplay / mpv read it without any options)
+        COUNT
+    };
+
+    /**
+     * \brief Writes frames on its own thread so the render loop never waits for the disk.
+     * Submit copies the viewport into a pooled buffer and queues it, the writer encodes the queue in order.
+     * When every buffer is still queued the frame is dropped (Backpressure::Drop) or Submit waits for one (Backpressure::Wait, offline rendering).
+     * Streams take the size of their first frame, a frame of another size (dynamic resolution) is dropped.
+     */
+    class FrameCapture final
+    {
+    public:
+        enum class Backpressure : uint8_t
+        {
+            Drop,
+            Wait
+        };
+
+        struct Settings
+        {
+            CaptureFormat format       {CaptureFormat::PNG};
+            std::string   outputPrefix {"Rasterizer_Capture"}; // Numbered files: <prefix>_000001.png
+            std::string   streamPath   {};                     // Raw / Y4M: a file or a named pipe
+            int           bufferCount  {4};
+            int           frameRate    {60};                   // Y4M header only
+            Backpressure  backpressure {Backpressure::Drop};
+        };
+
+        // Buffers fit frames up to maxWidth x maxHeight, they are all allocated here
+        FrameCapture(int maxWidth, int maxHeight, const Settings& settings);
+        // Writes what is still queued
+        ~FrameCapture();
+
+        FrameCapture(const FrameCapture&)                = delete;
+        FrameCapture(FrameCapture&&) noexcept            = delete;
+        FrameCapture& operator=(const FrameCapture&)     = delete;
+        FrameCapture& operator=(FrameCapture&&) noexcept = delete;
+
+        // Any thread that may read the frame buffer, false = dropped
+        bool Submit(const FrameBuffer& frameBuffer);
+        // Blocks until the queue is written, e.g. before reporting the counters
+        void Flush();
+
+        inline uint64_t GetFramesSubmitted() const { return m_FramesSubmitted; }
+        uint64_t GetFramesWritten() const;
+        uint64_t GetFramesDropped() const;
+        uint64_t GetFramesFailed()  const;
+        inline const Settings& GetSettings() const { return m_Settings; }
+
+        static const char* GetFormatName(CaptureFormat format);
+        static bool IsStream(CaptureFormat format);
+
+    private:
+        struct Buffer
+        {
+            std::vector<uint32_t> pixels      {};
+            int                   width       {0};
+            int                   height      {0};
+            uint64_t              frameNumber {0};
+        };
+
+        void Run();
+        bool Write(const Buffer& buffer);
+        bool WriteImage(const Buffer& buffer);
+        bool WriteStream(const Buffer& buffer);
+
+        Settings m_Settings;
+        int      m_MaxWidth  {0};
+        int      m_MaxHeight {0};
+
+        std::vector<Buffer> m_Buffers {};
+        // Ring of queued buffer indices in submit order, and the stack of free ones. Both hold every index at most once
+        std::vector<int>    m_Queue     {};
+        int                 m_QueueHead {0};
+        int                 m_QueueSize {0};
+        std::vector<int>    m_FreeBuffers {};
+
+        uint64_t m_FramesSubmitted {0}; // Submitting thread only
+        uint64_t m_FramesWritten   {0};
+        uint64_t m_FramesDropped   {0};
+        uint64_t m_FramesFailed    {0};
+
+        // Writer thread only
+        std::ofstream        m_Stream       {};
+        int                  m_StreamWidth  {0};
+        int                  m_StreamHeight {0};
+        std::vector<uint8_t> m_Scratch      {};
+
+        std::thread             m_Thread         {};
+        mutable std::mutex      m_Mutex          {};
+        std::condition_variable m_WorkCondition  {};
+        std::condition_variable m_FreeCondition  {}; // Buffer returned or queue written
+        bool                    m_IsWriting      {false};
+        bool                    m_IsRunning      {true};
+    };
+}
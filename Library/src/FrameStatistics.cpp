@@ -0,0 +1,39 @@
+#include "FrameStatistics.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+namespace dae
+{
+    double Percentile(const std::vector<double>& sortedSamples, double percentile)
+    {
+        assert(std::is_sorted(sortedSamples.begin(), sortedSamples.end()) and "Percentile: Samples must be sorted");
+        assert(percentile >= 0.0 and percentile <= 100.0 and "Percentile: Out of range");
+
+        if (sortedSamples.empty()) return 0.0;
+
+        const double rank{percentile / 100.0 * static_cast<double>(sortedSamples.size() - 1)};
+        const size_t lower{static_cast<size_t>(rank)};
+        const size_t upper{std::min(lower + 1, sortedSamples.size() - 1)};
+        const double fraction{rank - static_cast<double>(lower)};
+        return sortedSamples[lower] + (sortedSamples[upper] - sortedSamples[lower]) * fraction;
+    }
+
+    SampleSummary Summarize(std::vector<double> samples)
+    {
+        SampleSummary summary{};
+        if (samples.empty()) return summary;
+
+        std::sort(samples.begin(), samples.end());
+
+        summary.count = samples.size();
+        summary.min   = samples.front();
+        summary.max   = samples.back();
+        summary.mean  = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+        summary.p50   = Percentile(samples, 50.0);
+        summary.p95   = Percentile(samples, 95.0);
+        summary.p99   = Percentile(samples, 99.0);
+        return summary;
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+// Standard includes
+#include <cstddef>
+#include <vector>
+
+namespace dae
+{
+    /**
+     * \brief Distribution of a series of timings (ms). Percentiles show stutter that an average hides.
+     */
+    struct SampleSummary
+    {
+        size_t count {0};
+        double min   {0.0};
+        double mean  {0.0};
+        double p50   {0.0};
+        double p95   {0.0};
+        double p99   {0.0};
+        double max   {0.0};
+    };
+
+    // Linear interpolation between the closest ranks, percentile in [0, 100]
+    double Percentile(const std::vector<double>& sortedSamples, double percentile);
+    SampleSummary Summarize(std::vector<double> samples);
+}
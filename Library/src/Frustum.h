@@ -0,0 +1,141 @@
+#pragma once
+
+// Standard includes
+#include <cassert>
+
+#include "Matrix.h"
+#include "StridedSpan.h"
+#include "Vector3.h"
+#include "Vector4.h"
+
+namespace dae
+{
+    /**
+     * \brief Axis aligned box, e.g. the bounds of a mesh in object space
+     */
+    struct BoundingBox
+    {
+        Vector3 min {};
+        Vector3 max {};
+
+        static BoundingBox FromPoints(StridedSpan<const Vector3> points)
+        {
+            assert(not points.empty() and "BoundingBox::FromPoints: No points");
+
+            BoundingBox box{points[0], points[0]};
+            for (size_t idx{1}; idx < points.size(); ++idx)
+            {
+                const Vector3& point{points[idx]};
+                box.min = {point.x < box.min.x ? point.x : box.min.x, point.y < box.min.y ? point.y : box.min.y, point.z < box.min.z ? point.z : box.min.z};
+                box.max = {point.x > box.max.x ? point.x : box.max.x, point.y > box.max.y ? point.y : box.max.y, point.z > box.max.z ? point.z : box.max.z};
+            }
+            return box;
+        }
+
+        constexpr Vector3 GetCenter()  const { return (min + max) * 0.5f; }
+        constexpr Vector3 GetExtents() const { return (max - min) * 0.5f; }
+
+        /**
+         * \brief Box around this box after an affine transform (Arvo): the center is transformed,
+         * the extents are projected onto the absolute axes. Exact for translations and axis swaps, looser for rotations
+         */
+        constexpr BoundingBox Transformed(const Matrix& transform) const
+        {
+            const auto absolute = [](float value) { return value < 0.0f ? -value : value; };
+            const Vector3 center{transform.TransformPoint(GetCenter())};
+            const Vector3 extents{GetExtents()};
+
+            Vector3 transformedExtents{};
+            for (int axis{0}; axis < 3; ++axis)
+            {
+                transformedExtents[axis] = absolute(transform[0][axis]) * extents.x
+                                         + absolute(transform[1][axis]) * extents.y
+                                         + absolute(transform[2][axis]) * extents.z;
+            }
+            return {center - transformedExtents, center + transformedExtents};
+        }
+    };
+
+    /**
+     * \brief Six planes (xyz = unit normal pointing inside, w = distance) taken from a view-projection matrix (Gribb/Hartmann).
+     * With a world to clip matrix the planes are in world space. Clip z is in [0, w] like CreatePerspectiveFovLH.
+     * The tests are conservative: false means surely outside, true can still be outside near a corner of the frustum.
+     */
+    class Frustum final
+    {
+    public:
+        enum class Plane
+        {
+            Left,
+            Right,
+            Bottom,
+            Top,
+            Near,
+            Far,
+            COUNT
+        };
+
+        Frustum() = default;
+
+        static Frustum FromViewProjection(const Matrix& viewProjection)
+        {
+            // Points are row vectors (p * M), clip.x is p dotted with the first column etc.
+            const Matrix columns{Matrix::Transpose(viewProjection)};
+
+            Frustum frustum{};
+            frustum.m_Planes[static_cast<int>(Plane::Left)]   = columns[3] + columns[0];
+            frustum.m_Planes[static_cast<int>(Plane::Right)]  = columns[3] - columns[0];
+            frustum.m_Planes[static_cast<int>(Plane::Bottom)] = columns[3] + columns[1];
+            frustum.m_Planes[static_cast<int>(Plane::Top)]    = columns[3] - columns[1];
+            frustum.m_Planes[static_cast<int>(Plane::Near)]   = columns[2];
+            frustum.m_Planes[static_cast<int>(Plane::Far)]    = columns[3] - columns[2];
+
+            for (Vector4& plane : frustum.m_Planes)
+            {
+                plane = plane * (1.0f / plane.GetXYZ().Magnitude());
+            }
+            return frustum;
+        }
+
+        // Signed distance, positive on the inside
+        inline float GetDistance(Plane plane, const Vector3& point) const
+        {
+            const Vector4& planeEquation{m_Planes[static_cast<int>(plane)]};
+            return planeEquation.x * point.x + planeEquation.y * point.y + planeEquation.z * point.z + planeEquation.w;
+        }
+
+        inline bool IsPointVisible(const Vector3& point) const
+        {
+            return IsSphereVisible(point, 0.0f);
+        }
+
+        inline bool IsSphereVisible(const Vector3& center, float radius) const
+        {
+            for (const Vector4& plane : m_Planes)
+            {
+                if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) return false;
+            }
+            return true;
+        }
+
+        // The box's extent along each plane normal is its radius for that plane
+        inline bool IsBoxVisible(const BoundingBox& box) const
+        {
+            const Vector3 center{box.GetCenter()};
+            const Vector3 extents{box.GetExtents()};
+            for (const Vector4& plane : m_Planes)
+            {
+                const float radius{extents.x * (plane.x < 0.0f ? -plane.x : plane.x)
+                                 + extents.y * (plane.y < 0.0f ? -plane.y : plane.y)
+                                 + extents.z * (plane.z < 0.0f ? -plane.z : plane.z)};
+                if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) return false;
+            }
+            return true;
+        }
+
+        inline const Vector4& GetPlane(Plane plane) const { return m_Planes[static_cast<int>(plane)]; }
+
+    private:
+        Vector4 m_Planes[static_cast<int>(Plane::COUNT)] {};
+    };
+}
@@ -0,0 +1,134 @@
+#include "HardwareCounters.h"
+
+#if ENABLE_HARDWARE_COUNTERS
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace dae
+{
+#if ENABLE_HARDWARE_COUNTERS
+    namespace
+    {
+        constexpr uint64_t CacheConfig(uint64_t cache, uint64_t operation, uint64_t result)
+        {
+            return cache | (operation << 8) | (result << 16);
+        }
+
+        struct EventConfig
+        {
+            uint32_t type;
+            uint64_t config;
+        };
+
+        // Same order as HardwareEvent
+        constexpr EventConfig s_EventConfigs[]
+        {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, CacheConfig(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        };
+
+        int OpenEvent(const EventConfig& event, int groupFd)
+        {
+            perf_event_attr attributes{};
+            attributes.size           = sizeof(perf_event_attr);
+            attributes.type           = event.type;
+            attributes.config         = event.config;
+            attributes.disabled       = groupFd == -1 ? 1 : 0; // The leader starts the whole group once it is complete
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv     = 1;
+            attributes.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            // This thread, any CPU
+            return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, groupFd, 0));
+        }
+    }
+#endif
+
+    HardwareCounters::HardwareCounters()
+    {
+#if ENABLE_HARDWARE_COUNTERS
+        for (int idx{0}; idx < s_EventCount; ++idx)
+        {
+            const int fd{OpenEvent(s_EventConfigs[idx], m_GroupFd)};
+            if (fd == -1)
+            {
+                // Usually ENOENT (no such event, e.g. in a VM) or EACCES (perf_event_paranoid above 2)
+                if (not m_Status.empty()) m_Status += ", ";
+                m_Status += std::string{GetName(static_cast<HardwareEvent>(idx))} + ": " + std::strerror(errno);
+                continue;
+            }
+
+            if (m_GroupFd == -1) m_GroupFd = fd;
+            m_Fds[idx]   = fd;
+            m_Slots[idx] = m_AvailableEvents++;
+        }
+
+        if (m_GroupFd != -1)
+        {
+            ioctl(m_GroupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(m_GroupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#else
+        m_Status = "perf_event_open is Linux only";
+#endif
+    }
+
+    HardwareCounters::~HardwareCounters()
+    {
+#if ENABLE_HARDWARE_COUNTERS
+        for (const int fd : m_Fds)
+        {
+            if (fd != -1) close(fd);
+        }
+#endif
+    }
+
+    HardwareCounterValues HardwareCounters::Read() const
+    {
+        HardwareCounterValues values{};
+#if ENABLE_HARDWARE_COUNTERS
+        if (m_GroupFd == -1) return values;
+
+        // {nr, time_enabled, time_running, value per open event}
+        uint64_t buffer[3 + s_EventCount]{};
+        if (read(m_GroupFd, buffer, sizeof(buffer)) <= 0 or buffer[0] != static_cast<uint64_t>(m_AvailableEvents)) return values;
+
+        // The kernel multiplexes the group when the PMU is shared, the counts are extrapolated to the enabled time
+        const uint64_t timeEnabled{buffer[1]};
+        const uint64_t timeRunning{buffer[2]};
+        if (timeRunning == 0) return values;
+        const double scale{static_cast<double>(timeEnabled) / static_cast<double>(timeRunning)};
+
+        for (int idx{0}; idx < s_EventCount; ++idx)
+        {
+            if (m_Slots[idx] < 0) continue;
+
+            const uint64_t count{buffer[3 + m_Slots[idx]]};
+            values.counts[idx] = timeEnabled == timeRunning ? count : static_cast<uint64_t>(static_cast<double>(count) * scale);
+        }
+#endif
+        return values;
+    }
+
+    const char* HardwareCounters::GetName(HardwareEvent event)
+    {
+        switch (event)
+        {
+        case HardwareEvent::Cycles:       return "Cycles";
+        case HardwareEvent::Instructions: return "Instructions";
+        case HardwareEvent::L1DMisses:    return "L1D misses";
+        case HardwareEvent::LLCMisses:    return "LLC misses";
+        case HardwareEvent::BranchMisses: return "Branch misses";
+        default:                          return "";
+        }
+    }
+}
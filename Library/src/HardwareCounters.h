@@ -0,0 +1,109 @@
+#pragma once
+
+// Standard includes
+#include <cstdint>
+#include <string>
+
+// perf_event_open only exists on Linux, elsewhere the counters are never available
+// Set to 0 (e.g. in the project's preprocessor definitions) to compile the counters out on Linux too
+#ifndef ENABLE_HARDWARE_COUNTERS
+#if defined(__linux__)
+#define ENABLE_HARDWARE_COUNTERS 1
+#else
+#define ENABLE_HARDWARE_COUNTERS 0
+#endif
+#endif
+
+namespace dae
+{
+    enum class HardwareEvent : uint8_t
+    {
+        Cycles,
+        Instructions,
+        L1DMisses,    // Level 1 data cache read misses
+        LLCMisses,    // Last level cache misses
+        BranchMisses,
+
+        COUNT
+    };
+
+    // Counts of every event, an event the CPU (or the VM) does not have stays 0
+    struct HardwareCounterValues
+    {
+        static constexpr int s_EventCount{static_cast<int>(HardwareEvent::COUNT)};
+
+        uint64_t counts[s_EventCount] {};
+
+        inline uint64_t operator[](HardwareEvent event) const { return counts[static_cast<int>(event)]; }
+
+        HardwareCounterValues& operator+=(const HardwareCounterValues& other)
+        {
+            for (int idx{0}; idx < s_EventCount; ++idx)
+            {
+                counts[idx] += other.counts[idx];
+            }
+            return *this;
+        }
+
+        // Counts between two reads, the counters only go up
+        HardwareCounterValues operator-(const HardwareCounterValues& start) const
+        {
+            HardwareCounterValues result{};
+            for (int idx{0}; idx < s_EventCount; ++idx)
+            {
+                result.counts[idx] = counts[idx] >= start.counts[idx] ? counts[idx] - start.counts[idx] : 0;
+            }
+            return result;
+        }
+
+        // Instructions per cycle
+        inline float GetIPC() const
+        {
+            const uint64_t cycles{(*this)[HardwareEvent::Cycles]};
+            return cycles > 0 ? static_cast<float>((*this)[HardwareEvent::Instructions]) / static_cast<float>(cycles) : 0.0f;
+        }
+    };
+
+    /**
+     * \brief CPU performance counters of the thread that creates it, read with perf_event_open on Linux.
+     * All events are opened as one group so they count over exactly the same instructions and one read returns all of them.
+     * User space only, so it works with the default perf_event_paranoid of 2. When the kernel refuses, the CPU lacks the event
+     * or the platform is not Linux the event is simply missing: IsAvailable tells which and GetStatus why, Read leaves it 0.
+     */
+    class HardwareCounters final
+    {
+    public:
+        HardwareCounters();
+        ~HardwareCounters();
+
+        HardwareCounters(const HardwareCounters&)                = delete;
+        HardwareCounters(HardwareCounters&&) noexcept            = delete;
+        HardwareCounters& operator=(const HardwareCounters&)     = delete;
+        HardwareCounters& operator=(HardwareCounters&&) noexcept = delete;
+
+        // Running totals since construction, take the difference of two reads for a range
+        HardwareCounterValues Read() const;
+
+        inline bool IsAvailable() const { return m_AvailableEvents > 0; }
+        inline bool IsAvailable(HardwareEvent event) const { return m_Slots[static_cast<int>(event)] >= 0; }
+        inline const std::string& GetStatus() const { return m_Status; }
+
+        static const char* GetName(HardwareEvent event);
+
+    private:
+        static constexpr int s_EventCount{HardwareCounterValues::s_EventCount};
+
+        int m_GroupFd         {-1};
+        int m_Fds[s_EventCount]
+        {
+            -1, -1, -1, -1, -1
+        };
+        int m_Slots[s_EventCount] // Position of every event in a group read, -1 when it is not open
+        {
+            -1, -1, -1, -1, -1
+        };
+        int m_AvailableEvents {0};
+
+        std::string m_Status {};
+    };
+}
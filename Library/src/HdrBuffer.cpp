@@ -0,0 +1,350 @@
+#include "HdrBuffer.h"
+#include "FrameBuffer.h"
+#include "SIMD.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+
+namespace dae
+{
+    namespace
+    {
+        constexpr int s_SRGBTableSize{4096};
+
+        const std::array<uint8_t, s_SRGBTableSize>& GetSRGBTable()
+        {
+            static const std::array<uint8_t, s_SRGBTableSize> table{[]
+            {
+                std::array<uint8_t, s_SRGBTableSize> entries{};
+                for (int idx{0}; idx < s_SRGBTableSize; ++idx)
+                {
+                    const double linear{static_cast<double>(idx) / (s_SRGBTableSize - 1)};
+                    const double encoded{linear <= 0.0031308 ? linear * 12.92 : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055};
+                    entries[idx] = static_cast<uint8_t>(encoded * 255.0 + 0.5);
+                }
+                return entries;
+            }()};
+            return table;
+        }
+
+        // Same semantics as simd::Max / simd::Min, the scalar path has to give the same bits
+        inline float MaxLane(float a, float b) { return a > b ? a : b; }
+        inline float MinLane(float a, float b) { return a < b ? a : b; }
+
+        // Negative input is clamped first, the curves are only defined for c >= 0
+        template <ToneMapping Mapping>
+        void ToneMap(float& r, float& g, float& b)
+        {
+            r = MaxLane(r, 0.0f);
+            g = MaxLane(g, 0.0f);
+            b = MaxLane(b, 0.0f);
+
+            if constexpr (Mapping == ToneMapping::MaxToOne)
+            {
+                // x / 1 is x, no branch needed for the colors that are in range
+                const float divisor{MaxLane(MaxLane(r, MaxLane(g, b)), 1.0f)};
+                r /= divisor;
+                g /= divisor;
+                b /= divisor;
+            }
+            else if constexpr (Mapping == ToneMapping::Reinhard)
+            {
+                r /= 1.0f + r;
+                g /= 1.0f + g;
+                b /= 1.0f + b;
+            }
+            else if constexpr (Mapping == ToneMapping::ACES)
+            {
+                const auto aces = [](float c) { return (c * (2.51f * c + 0.03f)) / (c * (2.43f * c + 0.59f) + 0.14f); };
+                r = aces(r);
+                g = aces(g);
+                b = aces(b);
+            }
+
+            r = MinLane(r, 1.0f);
+            g = MinLane(g, 1.0f);
+            b = MinLane(b, 1.0f);
+        }
+
+        template <bool EncodeSRGB>
+        uint8_t Quantize(float c)
+        {
+            if constexpr (EncodeSRGB)
+            {
+                return GetSRGBTable()[static_cast<int>(c * (s_SRGBTableSize - 1) + 0.5f)];
+            }
+            return static_cast<uint8_t>(static_cast<int>(c * 255.0f));
+        }
+
+        template <ToneMapping Mapping, bool EncodeSRGB>
+        uint32_t ResolvePixel(float r, float g, float b)
+        {
+            ToneMap<Mapping>(r, g, b);
+            return FrameBuffer::PackColor(Quantize<EncodeSRGB>(r), Quantize<EncodeSRGB>(g), Quantize<EncodeSRGB>(b));
+        }
+
+        template <ToneMapping Mapping>
+        void ToneMap(simd::Float4& r, simd::Float4& g, simd::Float4& b)
+        {
+            using namespace simd;
+            const Float4 zero{Splat(0.0f)};
+            const Float4 one{Splat(1.0f)};
+            r = Max(r, zero);
+            g = Max(g, zero);
+            b = Max(b, zero);
+
+            if constexpr (Mapping == ToneMapping::MaxToOne)
+            {
+                const Float4 divisor{Max(Max(r, Max(g, b)), one)};
+                r = Div(r, divisor);
+                g = Div(g, divisor);
+                b = Div(b, divisor);
+            }
+            else if constexpr (Mapping == ToneMapping::Reinhard)
+            {
+                r = Div(r, Add(one, r));
+                g = Div(g, Add(one, g));
+                b = Div(b, Add(one, b));
+            }
+            else if constexpr (Mapping == ToneMapping::ACES)
+            {
+                const auto aces = [](Float4 c)
+                {
+                    const Float4 numerator{Mul(c, Add(Mul(Splat(2.51f), c), Splat(0.03f)))};
+                    const Float4 denominator{Add(Mul(c, Add(Mul(Splat(2.43f), c), Splat(0.59f))), Splat(0.14f))};
+                    return Div(numerator, denominator);
+                };
+                r = aces(r);
+                g = aces(g);
+                b = aces(b);
+            }
+
+            r = Min(r, one);
+            g = Min(g, one);
+            b = Min(b, one);
+        }
+
+        // Four pixels: tone map in registers, quantize, pack R | G << 8 | B << 16 | A << 24 (in byte order) and store
+        template <ToneMapping Mapping, bool EncodeSRGB>
+        void ResolveFour(const float* redPtr, const float* greenPtr, const float* bluePtr, uint32_t* outPtr)
+        {
+            using namespace simd;
+            Float4 r{Load(redPtr)};
+            Float4 g{Load(greenPtr)};
+            Float4 b{Load(bluePtr)};
+            ToneMap<Mapping>(r, g, b);
+
+            if constexpr (EncodeSRGB)
+            {
+                // The table lookup has no SIMD form on SSE2, the indices come from the registers
+                const Float4 scale{Splat(static_cast<float>(s_SRGBTableSize - 1))};
+                const Float4 half{Splat(0.5f)};
+                int32_t indices[3][4];
+                Store(indices[0], Truncate(Add(Mul(r, scale), half)));
+                Store(indices[1], Truncate(Add(Mul(g, scale), half)));
+                Store(indices[2], Truncate(Add(Mul(b, scale), half)));
+
+                const auto& table{GetSRGBTable()};
+                for (int lane{0}; lane < 4; ++lane)
+                {
+                    outPtr[lane] = FrameBuffer::PackColor(table[indices[0][lane]], table[indices[1][lane]], table[indices[2][lane]]);
+                }
+            }
+            else
+            {
+                const Float4 scale{Splat(255.0f)};
+                const Int4 red{Truncate(Mul(r, scale))};
+                const Int4 green{Truncate(Mul(g, scale))};
+                const Int4 blue{Truncate(Mul(b, scale))};
+                if constexpr (std::endian::native == std::endian::little)
+                {
+                    Store(outPtr, Or(Or(red, ShiftLeft<8>(green)), Or(ShiftLeft<16>(blue), SplatInt(0xFF000000u))));
+                }
+                else
+                {
+                    Store(outPtr, Or(Or(ShiftLeft<24>(red), ShiftLeft<16>(green)), Or(ShiftLeft<8>(blue), SplatInt(0xFFu))));
+                }
+            }
+        }
+
+        template <ToneMapping Mapping, bool EncodeSRGB>
+        void ResolveSpan(const float* redPtr, const float* greenPtr, const float* bluePtr, uint32_t* outPtr, int count)
+        {
+            int idx{0};
+            for (; idx + 8 <= count; idx += 8)
+            {
+                ResolveFour<Mapping, EncodeSRGB>(redPtr + idx, greenPtr + idx, bluePtr + idx, outPtr + idx);
+                ResolveFour<Mapping, EncodeSRGB>(redPtr + idx + 4, greenPtr + idx + 4, bluePtr + idx + 4, outPtr + idx + 4);
+            }
+            for (; idx + 4 <= count; idx += 4)
+            {
+                ResolveFour<Mapping, EncodeSRGB>(redPtr + idx, greenPtr + idx, bluePtr + idx, outPtr + idx);
+            }
+            for (; idx < count; ++idx)
+            {
+                outPtr[idx] = ResolvePixel<Mapping, EncodeSRGB>(redPtr[idx], greenPtr[idx], bluePtr[idx]);
+            }
+        }
+
+        // Picks the instantiation once per call, the loops themselves have no settings branches
+        template <template <ToneMapping, bool> typename Kernel, typename... Args>
+        auto Dispatch(const HdrBuffer::ResolveSettings& settings, Args&&... args)
+        {
+            const auto select = [&]<ToneMapping Mapping>()
+            {
+                return settings.encodeSRGB ? Kernel<Mapping, true>::Run(args...) : Kernel<Mapping, false>::Run(args...);
+            };
+            switch (settings.toneMapping)
+            {
+            case ToneMapping::Clamp:    return select.template operator()<ToneMapping::Clamp>();
+            case ToneMapping::Reinhard: return select.template operator()<ToneMapping::Reinhard>();
+            case ToneMapping::ACES:     return select.template operator()<ToneMapping::ACES>();
+            default:                    return select.template operator()<ToneMapping::MaxToOne>();
+            }
+        }
+
+        template <ToneMapping Mapping, bool EncodeSRGB>
+        struct SpanKernel
+        {
+            static void Run(const float* redPtr, const float* greenPtr, const float* bluePtr, uint32_t* outPtr, int count)
+            {
+                ResolveSpan<Mapping, EncodeSRGB>(redPtr, greenPtr, bluePtr, outPtr, count);
+            }
+        };
+
+        template <ToneMapping Mapping, bool EncodeSRGB>
+        struct PixelKernel
+        {
+            static uint32_t Run(const ColorRGB& color)
+            {
+                return ResolvePixel<Mapping, EncodeSRGB>(color.r, color.g, color.b);
+            }
+        };
+    }
+
+    HdrBuffer::HdrBuffer(int width, int height) :
+        m_Width{width},
+        m_Height{height},
+        m_ViewportWidth{width},
+        m_ViewportHeight{height},
+        m_TileMask{width, height}
+    {
+        assert(width > 0 and height > 0 and "HdrBuffer::HdrBuffer: Invalid dimensions");
+
+        const size_t pixelCount{static_cast<size_t>(width) * height};
+        m_Red.resize(pixelCount);
+        m_Green.resize(pixelCount);
+        m_Blue.resize(pixelCount);
+    }
+
+    void HdrBuffer::ClearDeferred(const ColorRGB& color, int viewportWidth, int viewportHeight)
+    {
+        assert(viewportWidth > 0 and viewportWidth <= m_Width and viewportHeight > 0 and viewportHeight <= m_Height and "HdrBuffer::ClearDeferred: Invalid viewport");
+
+        m_ClearColor     = color;
+        m_ViewportWidth  = viewportWidth;
+        m_ViewportHeight = viewportHeight;
+        m_TileMask.SetRegion(viewportWidth, viewportHeight);
+    }
+
+    /**
+     * \brief Fills the still cleared tiles overlapping the given pixel rectangle (inclusive), call before writing into it
+     */
+    void HdrBuffer::PrepareTiles(int minX, int minY, int maxX, int maxY)
+    {
+        m_TileMask.Prepare(minX, minY, maxX, maxY, [this](int beginX, int beginY, int endX, int endY)
+        {
+            FillTile(beginX, beginY, endX, endY);
+        });
+    }
+
+    /**
+     * \brief Runs of written tiles go through ResolveSpan, tiles that were only cleared get the packed clear color.
+     * Only reads the tile flags, the next ClearDeferred sets them again
+     */
+    void HdrBuffer::Resolve(uint32_t* colorBufferPtr, int beginY, int endY, const ResolveSettings& settings) const
+    {
+        assert(beginY >= 0 and endY <= m_ViewportHeight and "HdrBuffer::Resolve: Rows outside the viewport");
+
+        constexpr int tileSize{TileClearMask::s_TileSize};
+        const uint32_t clearPixel{ResolvePixel(m_ClearColor, settings)};
+        const int tileCountX{(m_ViewportWidth + tileSize - 1) / tileSize};
+
+        for (int y{beginY}; y < endY; ++y)
+        {
+            const size_t rowOffset{static_cast<size_t>(y) * m_Width};
+            const int tileY{y / tileSize};
+
+            int tileX{0};
+            while (tileX < tileCountX)
+            {
+                const bool isCleared{m_TileMask.IsCleared(tileX, tileY)};
+                int runEnd{tileX + 1};
+                while (runEnd < tileCountX and m_TileMask.IsCleared(runEnd, tileY) == isCleared)
+                {
+                    ++runEnd;
+                }
+
+                const int beginX{tileX * tileSize};
+                const int endX{std::min(runEnd * tileSize, m_ViewportWidth)};
+                if (isCleared)
+                {
+                    std::fill_n(colorBufferPtr + rowOffset + beginX, endX - beginX, clearPixel);
+                }
+                else
+                {
+                    Dispatch<SpanKernel>(settings, m_Red.data() + rowOffset + beginX, m_Green.data() + rowOffset + beginX,
+                                         m_Blue.data() + rowOffset + beginX, colorBufferPtr + rowOffset + beginX, endX - beginX);
+                }
+                tileX = runEnd;
+            }
+        }
+    }
+
+    void HdrBuffer::ResolveSpan(const float* redPtr, const float* greenPtr, const float* bluePtr, uint32_t* outPtr, int count,
+                                const ResolveSettings& settings)
+    {
+        Dispatch<SpanKernel>(settings, redPtr, greenPtr, bluePtr, outPtr, count);
+    }
+
+    uint32_t HdrBuffer::ResolvePixel(const ColorRGB& color, const ResolveSettings& settings)
+    {
+        return Dispatch<PixelKernel>(settings, color);
+    }
+
+    uint8_t HdrBuffer::EncodeSRGB(float linear)
+    {
+        return Quantize<true>(MinLane(MaxLane(linear, 0.0f), 1.0f));
+    }
+
+    const char* HdrBuffer::GetToneMappingName(ToneMapping toneMapping)
+    {
+        switch (toneMapping)
+        {
+        case ToneMapping::MaxToOne:
+            return "MAX TO ONE";
+        case ToneMapping::Clamp:
+            return "CLAMP";
+        case ToneMapping::Reinhard:
+            return "REINHARD";
+        case ToneMapping::ACES:
+            return "ACES";
+        default:
+            return "UNKNOWN";
+        }
+    }
+
+    void HdrBuffer::FillTile(int beginX, int beginY, int endX, int endY)
+    {
+        for (int y{beginY}; y < endY; ++y)
+        {
+            const size_t offset{beginX + static_cast<size_t>(y) * m_Width};
+            std::fill_n(m_Red.begin()   + offset, endX - beginX, m_ClearColor.r);
+            std::fill_n(m_Green.begin() + offset, endX - beginX, m_ClearColor.g);
+            std::fill_n(m_Blue.begin()  + offset, endX - beginX, m_ClearColor.b);
+        }
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+// Project includes
+#include "ColorRGB.h"
+#include "TileClearMask.h"
+
+// Standard includes
+#include <cstdint>
+#include <vector>
+
+namespace dae
+{
+    enum class ToneMapping : uint8_t
+    {
+        MaxToOne, // Divides by the largest channel when it is over 1, keeps the hue (what shading did per pixel before)
+        Clamp,    // Per channel min(c, 1)
+        Reinhard, // c / (1 + c) per channel
+        ACES,     // Narkowicz's fit of the ACES filmic curve
+        COUNT
+    };
+
+    /**
+     * \brief Linear float color, one plane per channel.
+     * Shading writes unclamped color, Resolve tone maps, optionally sRGB encodes and packs it into an RGBA8
+     * color buffer, eight pixels per iteration. Clears are per tile like the DepthBuffer's,
+     * a tile nothing touched resolves straight to the packed clear color.
+     */
+    class HdrBuffer final
+    {
+    public:
+        struct ResolveSettings
+        {
+            ToneMapping toneMapping {ToneMapping::MaxToOne};
+            bool        encodeSRGB  {false};
+        };
+
+        HdrBuffer(int width, int height);
+        ~HdrBuffer() = default;
+
+        HdrBuffer(const HdrBuffer&)                = delete;
+        HdrBuffer(HdrBuffer&&) noexcept            = delete;
+        HdrBuffer& operator=(const HdrBuffer&)     = delete;
+        HdrBuffer& operator=(HdrBuffer&&) noexcept = delete;
+
+        // Only flags the tiles of the viewport, the viewport is also what Resolve writes
+        void ClearDeferred(const ColorRGB& color, int viewportWidth, int viewportHeight);
+        void PrepareTiles(int minX, int minY, int maxX, int maxY);
+
+        // The pixel's tile must have been prepared
+        inline void Write(int index, const ColorRGB& color)
+        {
+            m_Red[index]   = color.r;
+            m_Green[index] = color.g;
+            m_Blue[index]  = color.b;
+        }
+
+        // Rows [beginY, endY) of the viewport into colorBufferPtr (same width as this buffer), rows can be resolved on several workers
+        void Resolve(uint32_t* colorBufferPtr, int beginY, int endY, const ResolveSettings& settings) const;
+
+        // count pixels of the three planes into packed RGBA8, the kernel of Resolve
+        static void ResolveSpan(const float* redPtr, const float* greenPtr, const float* bluePtr, uint32_t* outPtr, int count,
+                                const ResolveSettings& settings);
+        // One pixel with the same operations as ResolveSpan, also its tail
+        static uint32_t ResolvePixel(const ColorRGB& color, const ResolveSettings& settings);
+        // [0, 1] linear to 8-bit sRGB through a 4096 entry table
+        static uint8_t EncodeSRGB(float linear);
+        static const char* GetToneMappingName(ToneMapping toneMapping);
+
+        inline int GetWidth()  const { return m_Width;  }
+        inline int GetHeight() const { return m_Height; }
+
+    private:
+        void FillTile(int beginX, int beginY, int endX, int endY);
+
+        int m_Width          {0};
+        int m_Height         {0};
+        int m_ViewportWidth  {0};
+        int m_ViewportHeight {0};
+
+        std::vector<float> m_Red   {};
+        std::vector<float> m_Green {};
+        std::vector<float> m_Blue  {};
+
+        TileClearMask m_TileMask;
+        ColorRGB      m_ClearColor {};
+    };
+}
@@ -0,0 +1,94 @@
+#include "Heatmap.h"
+#include "FrameBuffer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace dae
+{
+    Heatmap::Heatmap(int width, int height) :
+        m_Width{width},
+        m_Height{height},
+        m_Counters(static_cast<size_t>(width) * height, 0)
+    {
+        assert(width > 0 and height > 0 and "Heatmap::Heatmap: Invalid dimensions");
+    }
+
+    void Heatmap::Clear()
+    {
+        std::fill(m_Counters.begin(), m_Counters.end(), 0u);
+    }
+
+    void Heatmap::AddRect(int minX, int minY, int maxX, int maxY)
+    {
+        assert(minX >= 0 and minY >= 0 and maxX < m_Width and maxY < m_Height and "Heatmap::AddRect: Out of bounds");
+
+        for (int y{minY}; y <= maxY; ++y)
+        {
+            uint32_t* rowPtr{m_Counters.data() + static_cast<size_t>(y) * m_Width};
+            for (int x{minX}; x <= maxX; ++x)
+            {
+                ++rowPtr[x];
+            }
+        }
+    }
+
+    uint32_t Heatmap::GetPercentile(int viewportWidth, int viewportHeight, float percentile)
+    {
+        assert(percentile >= 0.0f and percentile <= 100.0f and "Heatmap::GetPercentile: Percentile out of range");
+
+        m_Scratch.clear();
+        for (int y{0}; y < viewportHeight; ++y)
+        {
+            const uint32_t* rowPtr{m_Counters.data() + static_cast<size_t>(y) * m_Width};
+            std::copy_if(rowPtr, rowPtr + viewportWidth, std::back_inserter(m_Scratch), [](uint32_t value) { return value > 0; });
+        }
+        if (m_Scratch.empty()) return 0;
+
+        const auto rank{static_cast<size_t>(percentile / 100.0f * static_cast<float>(m_Scratch.size() - 1) + 0.5f)};
+        std::nth_element(m_Scratch.begin(), m_Scratch.begin() + rank, m_Scratch.end());
+        return m_Scratch[rank];
+    }
+
+    void Heatmap::Resolve(uint32_t* colorBufferPtr, int viewportWidth, int viewportHeight, uint32_t maxValue) const
+    {
+        const float scale{1.0f / static_cast<float>(std::max(maxValue, 1u))};
+        for (int y{0}; y < viewportHeight; ++y)
+        {
+            const size_t rowOffset{static_cast<size_t>(y) * m_Width};
+            for (int x{0}; x < viewportWidth; ++x)
+            {
+                colorBufferPtr[rowOffset + x] = GetHeatColor(static_cast<float>(m_Counters[rowOffset + x]) * scale);
+            }
+        }
+    }
+
+    uint32_t Heatmap::GetHeatColor(float t)
+    {
+        struct Stop
+        {
+            float r, g, b;
+        };
+        static constexpr Stop s_Ramp[]
+        {
+            {0.0f, 0.0f, 0.0f}, // Nothing
+            {0.0f, 0.0f, 1.0f},
+            {0.0f, 1.0f, 1.0f},
+            {0.0f, 1.0f, 0.0f},
+            {1.0f, 1.0f, 0.0f},
+            {1.0f, 0.0f, 0.0f}, // maxValue and above
+        };
+        constexpr int lastStop{static_cast<int>(std::size(s_Ramp)) - 1};
+
+        const float position{std::clamp(t, 0.0f, 1.0f) * static_cast<float>(lastStop)};
+        const int   stop{std::min(static_cast<int>(position), lastStop - 1)};
+        const float factor{position - static_cast<float>(stop)};
+
+        const Stop& from{s_Ramp[stop]};
+        const Stop& to{s_Ramp[stop + 1]};
+        return FrameBuffer::PackColor(static_cast<uint8_t>((from.r + (to.r - from.r) * factor) * 255.0f + 0.5f),
+                                      static_cast<uint8_t>((from.g + (to.g - from.g) * factor) * 255.0f + 0.5f),
+                                      static_cast<uint8_t>((from.b + (to.b - from.b) * factor) * 255.0f + 0.5f));
+    }
+}
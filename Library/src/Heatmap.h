@@ -0,0 +1,65 @@
+#pragma once
+
+// Standard includes
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER) and (defined(_M_X64) or defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) or defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace dae
+{
+    // Time stamp counter where there is one (not serializing, fine for costs of many instructions), nanoseconds otherwise
+    inline uint64_t ReadCycleCounter()
+    {
+#if (defined(_MSC_VER) and (defined(_M_X64) or defined(_M_IX86))) or defined(__x86_64__) or defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    /**
+     * \brief One counter per pixel (overdraw, bounding box tests, shading cycles, ...) for the debug views.
+     * Resolve turns the counters into a heat color ramp: black, blue, cyan, green, yellow, red.
+     */
+    class Heatmap final
+    {
+    public:
+        Heatmap(int width, int height);
+        ~Heatmap() = default;
+
+        Heatmap(const Heatmap&)                = delete;
+        Heatmap(Heatmap&&) noexcept            = delete;
+        Heatmap& operator=(const Heatmap&)     = delete;
+        Heatmap& operator=(Heatmap&&) noexcept = delete;
+
+        void Clear();
+        // +1 for every pixel of the inclusive rectangle
+        void AddRect(int minX, int minY, int maxX, int maxY);
+        inline void Add(int index, uint32_t value) { m_Counters[index] += value; }
+
+        // Over the pixels that counted anything, a high percentile keeps a few outliers from darkening the whole map
+        uint32_t GetPercentile(int viewportWidth, int viewportHeight, float percentile);
+        // Writes the ramp into the viewport of colorBufferPtr (same width as the heatmap), maxValue maps to red
+        void Resolve(uint32_t* colorBufferPtr, int viewportWidth, int viewportHeight, uint32_t maxValue) const;
+
+        // t in [0, 1], packed like FrameBuffer::PackColor
+        static uint32_t GetHeatColor(float t);
+
+        inline int GetWidth()  const { return m_Width;  }
+        inline int GetHeight() const { return m_Height; }
+        inline uint32_t*       GetData()       { return m_Counters.data(); }
+        inline const uint32_t* GetData() const { return m_Counters.data(); }
+
+    private:
+        int                   m_Width    {0};
+        int                   m_Height   {0};
+        std::vector<uint32_t> m_Counters {};
+        std::vector<uint32_t> m_Scratch  {}; // GetPercentile, reused
+    };
+}
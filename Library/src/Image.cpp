@@ -0,0 +1,152 @@
+#include "Image.h"
+#include "FrameBuffer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+
+namespace dae
+{
+    namespace
+    {
+        // Next header field of a PPM, skipping whitespace and # comments
+        bool ReadHeaderField(std::istream& stream, std::string& field)
+        {
+            field.clear();
+            char character{};
+            while (stream.get(character))
+            {
+                if (character == '#')
+                {
+                    while (stream.get(character) and character != '\n') {}
+                    continue;
+                }
+                if (std::isspace(static_cast<unsigned char>(character)))
+                {
+                    if (not field.empty()) return true;
+                    continue;
+                }
+                field += character;
+            }
+            return not field.empty();
+        }
+    }
+
+    Image::Image(int width, int height) :
+        m_Width{width},
+        m_Height{height},
+        m_Pixels(static_cast<size_t>(width) * height, 0)
+    {
+        assert(width >= 0 and height >= 0 and "Image::Image: Invalid dimensions");
+    }
+
+    Image Image::FromFrameBuffer(const FrameBuffer& frameBuffer)
+    {
+        Image image{frameBuffer.GetViewportWidth(), frameBuffer.GetViewportHeight()};
+        for (int y{0}; y < image.m_Height; ++y)
+        {
+            const uint32_t* rowPtr{frameBuffer.GetColorBuffer() + static_cast<size_t>(y) * frameBuffer.GetWidth()};
+            std::copy_n(rowPtr, image.m_Width, image.m_Pixels.begin() + static_cast<ptrdiff_t>(y) * image.m_Width);
+        }
+        return image;
+    }
+
+    /**
+     * \brief Reads a binary PPM (P6, max value 255)
+     * \param path
+     * \param image Left untouched on failure
+     * \return true on success
+     */
+    bool Image::LoadPPM(const std::string& path, Image& image)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (not file) return false;
+
+        std::string magic{}, width{}, height{}, maxValue{};
+        // The last field ends with exactly one whitespace character, the pixel data follows right after it
+        if (not ReadHeaderField(file, magic) or not ReadHeaderField(file, width) or not ReadHeaderField(file, height) or not ReadHeaderField(file, maxValue)) return false;
+        if (magic != "P6" or maxValue != "255") return false;
+
+        Image result{std::atoi(width.c_str()), std::atoi(height.c_str())};
+        if (result.m_Width <= 0 or result.m_Height <= 0) return false;
+
+        std::vector<uint8_t> row(static_cast<size_t>(result.m_Width) * 3);
+        for (int y{0}; y < result.m_Height; ++y)
+        {
+            if (not file.read(reinterpret_cast<char*>(row.data()), static_cast<std::streamsize>(row.size()))) return false;
+            for (int x{0}; x < result.m_Width; ++x)
+            {
+                result.m_Pixels[static_cast<size_t>(y) * result.m_Width + x] = FrameBuffer::PackColor(row[x * 3], row[x * 3 + 1], row[x * 3 + 2]);
+            }
+        }
+
+        image = std::move(result);
+        return true;
+    }
+
+    bool Image::SavePPM(const std::string& path) const
+    {
+        std::ofstream file(path, std::ios::binary);
+        if (not file) return false;
+
+        file << "P6\n" << m_Width << " " << m_Height << "\n255\n";
+
+        std::vector<uint8_t> row(static_cast<size_t>(m_Width) * 3);
+        for (int y{0}; y < m_Height; ++y)
+        {
+            for (int x{0}; x < m_Width; ++x)
+            {
+                const uint32_t pixel{m_Pixels[static_cast<size_t>(y) * m_Width + x]};
+                row[x * 3]     = FrameBuffer::UnpackR(pixel);
+                row[x * 3 + 1] = FrameBuffer::UnpackG(pixel);
+                row[x * 3 + 2] = FrameBuffer::UnpackB(pixel);
+            }
+            file.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+        }
+
+        return file.good();
+    }
+
+    ImageDiff Image::Compare(const Image& actual, const Image& reference, uint8_t tolerance, Image* diffImagePtr)
+    {
+        ImageDiff diff{};
+        diff.sizeMatches = actual.m_Width == reference.m_Width and actual.m_Height == reference.m_Height;
+        if (not diff.sizeMatches) return diff;
+
+        if (diffImagePtr) *diffImagePtr = Image{reference.m_Width, reference.m_Height};
+
+        uint64_t deltaSum{0};
+        for (size_t idx{0}; idx < reference.m_Pixels.size(); ++idx)
+        {
+            const uint32_t actualPixel{actual.m_Pixels[idx]};
+            const uint32_t referencePixel{reference.m_Pixels[idx]};
+
+            const int deltaR{std::abs(FrameBuffer::UnpackR(actualPixel) - FrameBuffer::UnpackR(referencePixel))};
+            const int deltaG{std::abs(FrameBuffer::UnpackG(actualPixel) - FrameBuffer::UnpackG(referencePixel))};
+            const int deltaB{std::abs(FrameBuffer::UnpackB(actualPixel) - FrameBuffer::UnpackB(referencePixel))};
+            const auto delta{static_cast<uint8_t>(std::max({deltaR, deltaG, deltaB}))};
+
+            deltaSum += static_cast<uint64_t>(deltaR + deltaG + deltaB);
+            diff.maxChannelDelta = std::max(diff.maxChannelDelta, delta);
+            const bool isDifferent{delta > tolerance};
+            if (isDifferent) ++diff.differentPixels;
+
+            if (diffImagePtr)
+            {
+                // Matching pixels keep the reference as a dim gray, the red of a different pixel gets brighter with its delta
+                const auto luminance{static_cast<uint8_t>((FrameBuffer::UnpackR(referencePixel) + FrameBuffer::UnpackG(referencePixel) + FrameBuffer::UnpackB(referencePixel)) / 12)};
+                diffImagePtr->m_Pixels[idx] = isDifferent
+                    ? FrameBuffer::PackColor(static_cast<uint8_t>(std::min(128 + delta, 255)), 0, 0)
+                    : FrameBuffer::PackColor(luminance, luminance, luminance);
+            }
+        }
+
+        if (not reference.m_Pixels.empty())
+        {
+            diff.meanChannelDelta = static_cast<float>(static_cast<double>(deltaSum) / static_cast<double>(reference.m_Pixels.size() * 3));
+        }
+        return diff;
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+// Standard includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dae
+{
+    class FrameBuffer;
+
+    // Result of Image::Compare, channel deltas are in 0..255
+    struct ImageDiff
+    {
+        bool     sizeMatches      {false};
+        uint64_t differentPixels  {0}; // Pixels with a channel delta above the tolerance
+        uint8_t  maxChannelDelta  {0};
+        float    meanChannelDelta {0.0f};
+
+        inline float GetDifferentFraction(uint64_t pixelCount) const
+        {
+            return pixelCount > 0 ? static_cast<float>(differentPixels) / static_cast<float>(pixelCount) : 0.0f;
+        }
+    };
+
+    /**
+     * \brief Standalone copy of a frame's viewport, packed like FrameBuffer::PackColor (alpha is ignored).
+     * Used by the golden image tests: frames are saved and loaded as binary PPM (P6) and compared per channel.
+     */
+    class Image final
+    {
+    public:
+        Image() = default;
+        Image(int width, int height);
+
+        static Image FromFrameBuffer(const FrameBuffer& frameBuffer);
+        // Binary PPM with a max value of 255, like FrameBuffer::SaveToPPM writes
+        static bool LoadPPM(const std::string& path, Image& image);
+        bool SavePPM(const std::string& path) const;
+
+        /**
+         * \brief Per-channel comparison of actual against reference.
+         * diffImagePtr (optional) gets the reference darkened to gray, with every pixel above the tolerance in red
+         */
+        static ImageDiff Compare(const Image& actual, const Image& reference, uint8_t tolerance, Image* diffImagePtr = nullptr);
+
+        inline int GetWidth()  const { return m_Width;  }
+        inline int GetHeight() const { return m_Height; }
+        inline uint64_t GetPixelCount() const { return m_Pixels.size(); }
+        inline uint32_t*       GetPixels()       { return m_Pixels.data(); }
+        inline const uint32_t* GetPixels() const { return m_Pixels.data(); }
+
+    private:
+        int                   m_Width  {0};
+        int                   m_Height {0};
+        std::vector<uint32_t> m_Pixels {};
+    };
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+// Standard includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dae
+{
+    /**
+     * \brief Decodes an image file for Texture::LoadFromFile.
+     * Keeps the Library free of any particular image library: the windowed app hands in SDL_image,
+     * the headless targets the built-in PngImageLoader.
+     */
+    class ImageLoader
+    {
+    public:
+        ImageLoader() = default;
+        virtual ~ImageLoader() = default;
+
+        ImageLoader(const ImageLoader&)                = delete;
+        ImageLoader(ImageLoader&&) noexcept            = delete;
+        ImageLoader& operator=(const ImageLoader&)     = delete;
+        ImageLoader& operator=(ImageLoader&&) noexcept = delete;
+
+        /**
+         * \brief texels get RGBA8, packed like FrameBuffer::PackColor, row-major without padding
+         * \return false (texels untouched) when the file cannot be read or decoded
+         */
+        virtual bool Load(const std::string& path, int& width, int& height, std::vector<uint32_t>& texels) const = 0;
+    };
+}
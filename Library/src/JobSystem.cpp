@@ -0,0 +1,299 @@
+#include "JobSystem.h"
+#include "Profiler.h"
+
+#include <cassert>
+#include <string>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace dae
+{
+    namespace
+    {
+        // Identifies the pool (and slot) the current thread belongs to
+        thread_local const JobSystem* t_JobSystemPtr {nullptr};
+        thread_local uint32_t         t_WorkerIndex  {0};
+
+        void PinThread(std::thread& thread, uint32_t core)
+        {
+#if defined(_WIN32)
+            SetThreadAffinityMask(thread.native_handle(), DWORD_PTR{1} << core);
+#elif defined(__linux__)
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(core, &cpuSet);
+            pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+#else
+            (void)thread;
+            (void)core;
+#endif
+        }
+    }
+
+#pragma region JobSystem
+    JobSystem::JobSystem(uint32_t workerThreadCount, bool pinThreads, size_t scratchBytesPerWorker, const WorkerInitFunction& workerInit) :
+        m_ScratchSize{scratchBytesPerWorker}
+    {
+        const uint32_t hardwareThreads{std::max(std::thread::hardware_concurrency(), 1u)};
+        if (workerThreadCount == 0)
+        {
+            workerThreadCount = GetDefaultWorkerThreadCount();
+        }
+
+        // Slot 0 is the submitting thread
+        m_Workers.resize(static_cast<size_t>(workerThreadCount) + 1);
+        for (auto& workerPtr : m_Workers)
+        {
+            workerPtr = std::make_unique<Worker>();
+            workerPtr->jobs    = std::make_unique<Job[]>(s_QueueCapacity);
+            workerPtr->scratch = std::make_unique<std::byte[]>(m_ScratchSize);
+        }
+
+        // The workers only use workerInit before counting down, it can stay a reference
+        std::latch initialized{static_cast<std::ptrdiff_t>(workerThreadCount)};
+        const WorkerInitFunction* workerInitPtr{workerInit ? &workerInit : nullptr};
+
+        m_Threads.reserve(workerThreadCount);
+        for (uint32_t idx{1}; idx <= workerThreadCount; ++idx)
+        {
+            m_Threads.emplace_back(&JobSystem::WorkerLoop, this, idx, workerInitPtr, &initialized);
+            if (pinThreads)
+            {
+                PinThread(m_Threads.back(), idx % hardwareThreads);
+            }
+        }
+        initialized.wait();
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard lock{m_SleepMutex};
+            m_IsRunning = false;
+        }
+        m_SleepCondition.notify_all();
+
+        for (auto& thread : m_Threads)
+        {
+            thread.join();
+        }
+    }
+
+    uint32_t JobSystem::GetCurrentWorkerIndex() const
+    {
+        return t_JobSystemPtr == this ? t_WorkerIndex : 0;
+    }
+
+    uint32_t JobSystem::GetDefaultWorkerThreadCount()
+    {
+        return std::max(std::thread::hardware_concurrency(), 1u) - 1;
+    }
+
+    void JobSystem::Schedule(const Job& job)
+    {
+        assert(job.invokePtr and job.counterPtr and "JobSystem::Schedule: Incomplete job");
+
+        job.counterPtr->value.fetch_add(1);
+
+        const uint32_t workerIndex{GetCurrentWorkerIndex()};
+        if (not Push(workerIndex, job))
+        {
+            // Queue full, don't block: run it right here
+            Execute(job, workerIndex);
+            return;
+        }
+
+        m_QueuedJobs.fetch_add(1);
+        if (m_SleepingWorkers.load() > 0)
+        {
+            // Taking the lock orders this wake-up after a worker's check of m_QueuedJobs
+            {
+                std::lock_guard lock{m_SleepMutex};
+            }
+            m_SleepCondition.notify_one();
+        }
+    }
+
+    void JobSystem::Wait(JobCounter& counter)
+    {
+        const uint32_t workerIndex{GetCurrentWorkerIndex()};
+        while (counter.value.load(std::memory_order_acquire) > 0)
+        {
+            if (not TryRunJob(workerIndex))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::WorkerLoop(uint32_t workerIndex, const WorkerInitFunction* workerInitPtr, std::latch* initializedPtr)
+    {
+        t_JobSystemPtr = this;
+        t_WorkerIndex  = workerIndex;
+        PROFILE_THREAD("Worker " + std::to_string(workerIndex));
+
+        if (workerInitPtr)
+        {
+            (*workerInitPtr)(workerIndex);
+        }
+        initializedPtr->count_down();
+
+        while (true)
+        {
+            if (TryRunJob(workerIndex)) continue;
+
+            std::unique_lock lock{m_SleepMutex};
+            m_SleepingWorkers.fetch_add(1);
+            m_SleepCondition.wait(lock, [this] { return m_QueuedJobs.load() > 0 or not m_IsRunning; });
+            m_SleepingWorkers.fetch_sub(1);
+
+            if (not m_IsRunning) return;
+        }
+    }
+
+    bool JobSystem::Push(uint32_t workerIndex, const Job& job)
+    {
+        Worker& worker{*m_Workers[workerIndex]};
+        std::lock_guard lock{worker.mutex};
+
+        if (worker.tail - worker.head == s_QueueCapacity) return false;
+
+        worker.jobs[worker.tail % s_QueueCapacity] = job;
+        ++worker.tail;
+        return true;
+    }
+
+    bool JobSystem::Pop(uint32_t workerIndex, Job& job)
+    {
+        Worker& worker{*m_Workers[workerIndex]};
+        std::lock_guard lock{worker.mutex};
+
+        if (worker.tail == worker.head) return false;
+
+        --worker.tail;
+        job = worker.jobs[worker.tail % s_QueueCapacity];
+        return true;
+    }
+
+    bool JobSystem::Steal(uint32_t workerIndex, Job& job)
+    {
+        const uint32_t workerCount{GetWorkerCount()};
+        for (uint32_t offset{1}; offset < workerCount; ++offset)
+        {
+            Worker& victim{*m_Workers[(workerIndex + offset) % workerCount]};
+            std::lock_guard lock{victim.mutex};
+
+            if (victim.tail == victim.head) continue;
+
+            job = victim.jobs[victim.head % s_QueueCapacity];
+            ++victim.head;
+            return true;
+        }
+        return false;
+    }
+
+    bool JobSystem::TryRunJob(uint32_t workerIndex)
+    {
+        Job job{};
+        if (not Pop(workerIndex, job) and not Steal(workerIndex, job)) return false;
+
+        m_QueuedJobs.fetch_sub(1);
+        Execute(job, workerIndex);
+        return true;
+    }
+
+    void JobSystem::Execute(const Job& job, uint32_t workerIndex)
+    {
+        job.invokePtr(job.dataPtr, job.begin, job.end, workerIndex);
+        job.counterPtr->value.fetch_sub(1, std::memory_order_release);
+    }
+#pragma endregion
+
+#pragma region JobGraph
+    JobGraph::NodeId JobGraph::AddNode(NodeFunction function)
+    {
+        m_Nodes.push_back(Node{std::move(function)});
+        return static_cast<NodeId>(m_Nodes.size() - 1);
+    }
+
+    void JobGraph::AddDependency(NodeId before, NodeId after)
+    {
+        assert(before < m_Nodes.size() and after < m_Nodes.size() and before != after and "JobGraph::AddDependency: Invalid node");
+
+        m_Nodes[before].dependents.push_back(after);
+        ++m_Nodes[after].dependencyCount;
+    }
+
+    /**
+     * \brief Runs every node once, respecting the dependencies, and returns when all of them finished.
+     * The graph has to be acyclic.
+     * \param jobSystem
+     */
+    void JobGraph::Run(JobSystem& jobSystem)
+    {
+        if (m_RemainingCount < m_Nodes.size())
+        {
+            m_RemainingPtr   = std::make_unique<std::atomic<uint32_t>[]>(m_Nodes.size());
+            m_RemainingCount = m_Nodes.size();
+        }
+
+        for (size_t idx{0}; idx < m_Nodes.size(); ++idx)
+        {
+            m_RemainingPtr[idx].store(m_Nodes[idx].dependencyCount, std::memory_order_relaxed);
+        }
+
+        m_JobSystemPtr = &jobSystem;
+        for (NodeId idx{0}; idx < m_Nodes.size(); ++idx)
+        {
+            if (m_Nodes[idx].dependencyCount == 0)
+            {
+                ScheduleNode(idx);
+            }
+        }
+        jobSystem.Wait(m_Counter);
+        m_JobSystemPtr = nullptr;
+    }
+
+    void JobGraph::Clear()
+    {
+        m_Nodes.clear();
+    }
+
+    void JobGraph::ScheduleNode(NodeId node)
+    {
+        Job job{};
+        job.invokePtr  = &JobGraph::RunNode;
+        job.dataPtr    = this;
+        job.begin      = node;
+        job.end        = node + 1;
+        job.counterPtr = &m_Counter;
+        m_JobSystemPtr->Schedule(job);
+    }
+
+    void JobGraph::RunNode(const void* dataPtr, uint32_t begin, uint32_t end, uint32_t workerIndex)
+    {
+        (void)end;
+
+        // The graph is only mutated through the atomics while it runs
+        auto* graphPtr = const_cast<JobGraph*>(static_cast<const JobGraph*>(dataPtr));
+        const Node& node{graphPtr->m_Nodes[begin]};
+
+        node.function(workerIndex);
+
+        // Dependents are scheduled before this job counts as done, so the counter can't hit zero early
+        for (const NodeId dependent : node.dependents)
+        {
+            if (graphPtr->m_RemainingPtr[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                graphPtr->ScheduleNode(dependent);
+            }
+        }
+    }
+#pragma endregion
+}
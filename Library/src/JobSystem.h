@@ -0,0 +1,180 @@
+#pragma once
+
+// Standard includes
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dae
+{
+    /**
+     * \brief Number of jobs still in flight, JobSystem::Wait blocks (and helps out) until it reaches zero
+     */
+    struct JobCounter
+    {
+        std::atomic<uint32_t> value {0};
+    };
+
+    /**
+     * \brief Type-erased range of work. Points at a callable owned by the submitter,
+     * so scheduling a job never allocates.
+     */
+    struct Job
+    {
+        void (*invokePtr)(const void* dataPtr, uint32_t begin, uint32_t end, uint32_t workerIndex) {nullptr};
+        const void* dataPtr    {nullptr};
+        uint32_t    begin      {0};
+        uint32_t    end        {0};
+        JobCounter* counterPtr {nullptr};
+    };
+
+    /**
+     * \brief Work-stealing thread pool.
+     * Every worker owns a bounded queue: it pops its own newest job and steals the oldest job of the others.
+     * Worker index 0 is reserved for the thread that submits from outside the pool (e.g. the render thread),
+     * it executes jobs as well while it waits. Only one outside thread should submit at a time.
+     */
+    class JobSystem final
+    {
+    public:
+        // Runs on every worker thread before it takes its first job, e.g. to open per-thread resources
+        using WorkerInitFunction = std::function<void(uint32_t workerIndex)>;
+
+        // workerThreadCount == 0: GetDefaultWorkerThreadCount. The constructor returns once workerInit ran on all worker threads
+        explicit JobSystem(uint32_t workerThreadCount = 0, bool pinThreads = false, size_t scratchBytesPerWorker = 64 * 1024, const WorkerInitFunction& workerInit = {});
+        ~JobSystem();
+
+        JobSystem(const JobSystem&)                = delete;
+        JobSystem(JobSystem&&) noexcept            = delete;
+        JobSystem& operator=(const JobSystem&)     = delete;
+        JobSystem& operator=(JobSystem&&) noexcept = delete;
+
+        // function(uint32_t begin, uint32_t end, uint32_t workerIndex), blocks until the whole range is done
+        template <typename Function>
+        void ParallelFor(uint32_t count, uint32_t grainSize, const Function& function);
+
+        void Schedule(const Job& job);
+        void Wait(JobCounter& counter);
+
+        // Worker threads + the submitting thread
+        inline uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+        uint32_t GetCurrentWorkerIndex() const;
+        // One thread per hardware thread, minus the submitting thread
+        static uint32_t GetDefaultWorkerThreadCount();
+
+        // Per-worker memory, only ever touched by the job running on that worker
+        inline std::byte* GetScratchMemory(uint32_t workerIndex) { return m_Workers[workerIndex]->scratch.get(); }
+        inline size_t     GetScratchSize()                 const { return m_ScratchSize; }
+
+    private:
+        struct alignas(64) Worker
+        {
+            std::mutex                   mutex   {};
+            std::unique_ptr<Job[]>       jobs    {};
+            uint32_t                     head    {0}; // Oldest, stolen by other workers
+            uint32_t                     tail    {0}; // Newest, popped by the owner
+            std::unique_ptr<std::byte[]> scratch {};
+        };
+
+        static constexpr uint32_t s_QueueCapacity{4096};
+
+        void WorkerLoop(uint32_t workerIndex, const WorkerInitFunction* workerInitPtr, std::latch* initializedPtr);
+        bool Push(uint32_t workerIndex, const Job& job);
+        bool Pop(uint32_t workerIndex, Job& job);
+        bool Steal(uint32_t workerIndex, Job& job);
+        bool TryRunJob(uint32_t workerIndex);
+        static void Execute(const Job& job, uint32_t workerIndex);
+
+        std::vector<std::unique_ptr<Worker>> m_Workers {};
+        std::vector<std::thread>             m_Threads {};
+        size_t                               m_ScratchSize {0};
+
+        std::mutex              m_SleepMutex       {};
+        std::condition_variable m_SleepCondition   {};
+        std::atomic<uint32_t>   m_QueuedJobs       {0};
+        std::atomic<uint32_t>   m_SleepingWorkers  {0};
+        std::atomic<bool>       m_IsRunning        {true};
+    };
+
+    template <typename Function>
+    void JobSystem::ParallelFor(uint32_t count, uint32_t grainSize, const Function& function)
+    {
+        if (count == 0) return;
+
+        grainSize = std::max(grainSize, 1u);
+        if (count <= grainSize or GetWorkerCount() == 1)
+        {
+            function(0u, count, GetCurrentWorkerIndex());
+            return;
+        }
+
+        JobCounter counter{};
+        Job job{};
+        job.invokePtr = [](const void* dataPtr, uint32_t begin, uint32_t end, uint32_t workerIndex)
+        {
+            (*static_cast<const Function*>(dataPtr))(begin, end, workerIndex);
+        };
+        job.dataPtr    = &function;
+        job.counterPtr = &counter;
+
+        for (uint32_t begin{0}; begin < count; begin += grainSize)
+        {
+            job.begin = begin;
+            job.end   = std::min(begin + grainSize, count);
+            Schedule(job);
+        }
+        Wait(counter);
+    }
+
+    /**
+     * \brief Static DAG of jobs (e.g. vertex -> bin -> raster -> resolve).
+     * Build it once, Run it every frame: a node is scheduled as soon as all its dependencies finished.
+     * Nodes may use ParallelFor on the same JobSystem.
+     */
+    class JobGraph final
+    {
+    public:
+        using NodeId       = uint32_t;
+        using NodeFunction = std::function<void(uint32_t workerIndex)>;
+
+        JobGraph()  = default;
+        ~JobGraph() = default;
+
+        JobGraph(const JobGraph&)                = delete;
+        JobGraph(JobGraph&&) noexcept            = delete;
+        JobGraph& operator=(const JobGraph&)     = delete;
+        JobGraph& operator=(JobGraph&&) noexcept = delete;
+
+        NodeId AddNode(NodeFunction function);
+        void   AddDependency(NodeId before, NodeId after);
+        void   Run(JobSystem& jobSystem);
+        void   Clear();
+
+        inline size_t GetNodeCount() const { return m_Nodes.size(); }
+
+    private:
+        struct Node
+        {
+            NodeFunction        function        {};
+            std::vector<NodeId> dependents      {};
+            uint32_t            dependencyCount {0};
+        };
+
+        void ScheduleNode(NodeId node);
+        static void RunNode(const void* dataPtr, uint32_t begin, uint32_t end, uint32_t workerIndex);
+
+        std::vector<Node>                        m_Nodes          {};
+        std::unique_ptr<std::atomic<uint32_t>[]> m_RemainingPtr   {};
+        size_t                                   m_RemainingCount {0};
+        JobSystem*                               m_JobSystemPtr   {nullptr};
+        JobCounter                               m_Counter        {};
+    };
+}
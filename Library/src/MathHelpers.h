@@ -2,8 +2,7 @@
 #include <cfloat>
 #include <cmath>
 #include <array>
-
-#include "Vector2.h"
+#include <type_traits>
 
 namespace dae
 {
@@ -25,49 +24,100 @@ namespace dae
     constexpr auto TO_RADIANS(PI / 180.0f);
 
     /* --- HELPER FUNCTIONS --- */
-    inline float Square(float a)
+    constexpr float Square(float a)
     {
         return a * a;
     }
 
-    inline float Lerpf(float a, float b, float factor)
+    constexpr float Lerpf(float a, float b, float factor)
     {
         return ((1 - factor) * a) + (factor * b);
     }
 
-    inline bool AreEqual(float a, float b, float epsilon = FLT_EPSILON)
+    constexpr bool AreEqual(float a, float b, float epsilon = FLT_EPSILON)
+    {
+        // std::abs is not constexpr before C++23
+        const float difference{a - b};
+        return (difference < 0.f ? -difference : difference) < epsilon;
+    }
+
+    /**
+     * \brief std::sin / std::cos are not constexpr before C++26: a series at compile time, the same library call as before at run time
+     */
+    constexpr float Sin(float angle)
     {
-        return abs(a - b) < epsilon;
+        if (std::is_constant_evaluated())
+        {
+            double x{angle};
+            while (x > 3.14159265358979323846) x -= 6.283185307179586476925;
+            while (x < -3.14159265358979323846) x += 6.283185307179586476925;
+
+            double term{x};
+            double sum{x};
+            for (int n{1}; n < 12; ++n)
+            {
+                term *= -x * x / ((2 * n) * (2 * n + 1));
+                sum += term;
+            }
+            return static_cast<float>(sum);
+        }
+        return static_cast<float>(sin(angle));
     }
 
-    inline int Clamp(const int v, int min, int max)
+    constexpr float Cos(float angle)
+    {
+        if (std::is_constant_evaluated())
+        {
+            double x{angle};
+            while (x > 3.14159265358979323846) x -= 6.283185307179586476925;
+            while (x < -3.14159265358979323846) x += 6.283185307179586476925;
+
+            double term{1.0};
+            double sum{1.0};
+            for (int n{1}; n < 12; ++n)
+            {
+                term *= -x * x / ((2 * n - 1) * (2 * n));
+                sum += term;
+            }
+            return static_cast<float>(sum);
+        }
+        return static_cast<float>(cos(angle));
+    }
+
+    constexpr int Clamp(const int v, int min, int max)
     {
         if (v < min) return min;
         if (v > max) return max;
         return v;
     }
 
-    inline float Clamp(const float v, float min, float max)
+    constexpr float Clamp(const float v, float min, float max)
     {
         if (v < min) return min;
         if (v > max) return max;
         return v;
     }
 
-    inline float Saturate(const float v)
+    constexpr float Saturate(const float v)
     {
         if (v < 0.f) return 0.f;
         if (v > 1.f) return 1.f;
         return v;
     }
 
-    inline float Remap(float value, float inputMin, float inputMax, float outputMin, float outputMax)
+    constexpr float Remap(float value, float inputMin, float inputMax, float outputMin, float outputMax)
     {
         if (value <= inputMin) return outputMin;
         if (value >= inputMax) return outputMax;
         return outputMin + (value - inputMin) * (outputMax - outputMin) / (inputMax - inputMin);
     }
+}
 
+// After the scalar helpers: Vector2 uses AreEqual
+#include "Vector2.h"
+
+namespace dae
+{
     /**
      * \brief https://www.youtube.com/watch?v=HYAgJN3x4GA
      * ~2X faster than IsPointInTriangleV2
@@ -1,67 +1,113 @@
 #pragma once
+#include <cassert>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "SIMD.h"
+#include "StridedSpan.h"
 #include "Vector3.h"
 #include "Vector4.h"
 
 namespace dae
 {
+    /**
+     * \brief Row-major 4x4, row vectors: p' = p * M.
+     * What runs per vertex or per frame lives in this header (transforms, multiply, inverse) so the render loops inline it,
+     * the 4-wide rows go through SIMD.h. Lanes are multiplied and added in the order of the scalar formulas,
+     * the results are the same as without SIMD.
+     */
     struct Matrix
     {
-        Matrix() = default;
-        Matrix(
+        constexpr Matrix() = default;
+        constexpr Matrix(
             const Vector3& xAxis,
             const Vector3& yAxis,
             const Vector3& zAxis,
             const Vector3& t);
 
-        Matrix(
+        constexpr Matrix(
             const Vector4& xAxis,
             const Vector4& yAxis,
             const Vector4& zAxis,
             const Vector4& t);
 
-        Matrix(const Matrix& m);
+        constexpr Matrix(const Matrix& m) = default;
+        constexpr Matrix& operator=(const Matrix& m) = default;
+
+        // Constant evaluation takes the scalar formulas, at run time the SIMD rows, same results
+        constexpr Vector3 TransformVector(const Vector3& v) const;
+        constexpr Vector3 TransformVector(float x, float y, float z) const;
+        constexpr Vector3 TransformPoint(const Vector3& p) const;
+        constexpr Vector3 TransformPoint(float x, float y, float z) const;
 
-        Vector3 TransformVector(const Vector3& v) const;
-        Vector3 TransformVector(float x, float y, float z) const;
-        Vector3 TransformPoint(const Vector3& p) const;
-        Vector3 TransformPoint(float x, float y, float z) const;
+        constexpr Vector4 TransformPoint(const Vector4& p) const;
+        constexpr Vector4 TransformPoint(float x, float y, float z, float w) const;
 
-        Vector4 TransformPoint(const Vector4& p) const;
-        Vector4 TransformPoint(float x, float y, float z, float w) const;
+        // Batched versions, out[i] = Transform...(in[i]) with the same results. Strided spans can run over one member
+        // of an array of structs (e.g. Vertex::position), in and out may be the same elements
+        void TransformPoints(StridedSpan<const Vector3> points, StridedSpan<Vector3> out) const;
+        void TransformVectors(StridedSpan<const Vector3> vectors, StridedSpan<Vector3> out) const;
+        // w = 1, the homogeneous result before the perspective divide
+        void TransformPointsToClip(StridedSpan<const Vector3> points, StridedSpan<Vector4> out) const;
 
-        const Matrix& Transpose();
+        // Structure of arrays, four elements per register
+        void TransformPoints(std::span<const float> x, std::span<const float> y, std::span<const float> z,
+                             std::span<float> outX, std::span<float> outY, std::span<float> outZ) const;
+        void TransformVectors(std::span<const float> x, std::span<const float> y, std::span<const float> z,
+                              std::span<float> outX, std::span<float> outY, std::span<float> outZ) const;
+
+        constexpr const Matrix& Transpose();
         const Matrix& Inverse();
 
-        Vector3 GetAxisX() const;
-        Vector3 GetAxisY() const;
-        Vector3 GetAxisZ() const;
-        Vector3 GetTranslation() const;
-
-        static Matrix CreateTranslation(float x, float y, float z);
-        static Matrix CreateTranslation(const Vector3& t);
-        static Matrix CreateRotationX(float pitch);
-        static Matrix CreateRotationY(float yaw);
-        static Matrix CreateRotationZ(float roll);
-        static Matrix CreateRotation(float pitch, float yaw, float roll);
-        static Matrix CreateRotation(const Vector3& r);
-        static Matrix CreateScale(float sx, float sy, float sz);
-        static Matrix CreateScale(const Vector3& s);
-        static Matrix Transpose(const Matrix& m);
+        constexpr Vector3 GetAxisX() const;
+        constexpr Vector3 GetAxisY() const;
+        constexpr Vector3 GetAxisZ() const;
+        constexpr Vector3 GetTranslation() const;
+
+        static constexpr Matrix CreateTranslation(float x, float y, float z);
+        static constexpr Matrix CreateTranslation(const Vector3& t);
+        static constexpr Matrix CreateRotationX(float pitch);
+        static constexpr Matrix CreateRotationY(float yaw);
+        static constexpr Matrix CreateRotationZ(float roll);
+        static constexpr Matrix CreateRotation(float pitch, float yaw, float roll);
+        static constexpr Matrix CreateRotation(const Vector3& r);
+        static constexpr Matrix CreateScale(float sx, float sy, float sz);
+        static constexpr Matrix CreateScale(const Vector3& s);
+        static constexpr Matrix Transpose(const Matrix& m);
         static Matrix Inverse(const Matrix& m);
 
         static Matrix CreateLookAtLH(const Vector3& origin, const Vector3& forward, const Vector3& up);
         static Matrix CreateLookAtLH(const Vector3& origin, const Vector3& forward, Vector3& up, Vector3& right);
-        static Matrix CreatePerspectiveFovLH(float fovy, float aspect, float zn, float zf);
+        static constexpr Matrix CreatePerspectiveFovLH(float fovy, float aspect, float zn, float zf);
 
-        Vector4& operator[](int index);
-        Vector4 operator[](int index) const;
-        Matrix operator*(const Matrix& m) const;
-        const Matrix& operator*=(const Matrix& m);
-        bool operator==(const Matrix& m) const;
+        constexpr Vector4& operator[](int index);
+        constexpr Vector4 operator[](int index) const;
+        constexpr Matrix operator*(const Matrix& m) const;
+        constexpr const Matrix& operator*=(const Matrix& m);
+        constexpr bool operator==(const Matrix& m) const;
 
     private:
+        // x * row0 + y * row1 + z * row2 + w * row3, four lanes at once
+        simd::Float4 Combine(float x, float y, float z, float w) const;
+        simd::Float4 Row(int index) const { return simd::Load(&data[index].x); }
+        // The same as Combine in plain floats, for constant evaluation
+        constexpr Vector4 CombineScalar(float x, float y, float z, float w) const
+        {
+            return data[0] * x + data[1] * y + data[2] * z + data[3] * w;
+        }
+
+        // Four elements per iteration, the input this many elements ahead is prefetched
+        static constexpr size_t s_PrefetchDistance{16};
+
+        template <typename In, typename Out, typename Transform>
+        static void TransformBatch(StridedSpan<const In> in, StridedSpan<Out> out, const Transform& transform);
+        template <bool IsPoint>
+        void TransformSoA(std::span<const float> x, std::span<const float> y, std::span<const float> z,
+                          std::span<float> outX, std::span<float> outY, std::span<float> outZ) const;
+
         //Row-Major Matrix
-        Vector4 data[4]
+        alignas(16) Vector4 data[4]
         {
             {1, 0, 0, 0}, //xAxis
             {0, 1, 0, 0}, //yAxis
@@ -74,4 +120,416 @@ namespace dae
         // v2x v2y v2z v2w
         // v3x v3y v3z v3w
     };
+
+    constexpr Matrix::Matrix(const Vector3& xAxis, const Vector3& yAxis, const Vector3& zAxis, const Vector3& t) :
+        Matrix({xAxis, 0}, {yAxis, 0}, {zAxis, 0}, {t, 1})
+    {
+    }
+
+    constexpr Matrix::Matrix(const Vector4& xAxis, const Vector4& yAxis, const Vector4& zAxis, const Vector4& t) :
+        data{xAxis, yAxis, zAxis, t}
+    {
+    }
+
+    inline simd::Float4 Matrix::Combine(float x, float y, float z, float w) const
+    {
+        using namespace simd;
+        const Float4 xy{Add(Mul(Row(0), Splat(x)), Mul(Row(1), Splat(y)))};
+        return Add(Add(xy, Mul(Row(2), Splat(z))), Mul(Row(3), Splat(w)));
+    }
+
+    constexpr Vector3 Matrix::TransformVector(const Vector3& v) const
+    {
+        return TransformVector(v.x, v.y, v.z);
+    }
+
+    constexpr Vector3 Matrix::TransformVector(float x, float y, float z) const
+    {
+        if (std::is_constant_evaluated())
+        {
+            return data[0] * x + data[1] * y + data[2] * z;
+        }
+
+        using namespace simd;
+        float result[4];
+        Store(result, Add(Add(Mul(Row(0), Splat(x)), Mul(Row(1), Splat(y))), Mul(Row(2), Splat(z))));
+        return Vector3{result[0], result[1], result[2]};
+    }
+
+    constexpr Vector3 Matrix::TransformPoint(const Vector3& p) const
+    {
+        return TransformPoint(p.x, p.y, p.z);
+    }
+
+    constexpr Vector3 Matrix::TransformPoint(float x, float y, float z) const
+    {
+        if (std::is_constant_evaluated())
+        {
+            return data[0] * x + data[1] * y + data[2] * z + data[3];
+        }
+
+        using namespace simd;
+        float result[4];
+        Store(result, Add(Add(Add(Mul(Row(0), Splat(x)), Mul(Row(1), Splat(y))), Mul(Row(2), Splat(z))), Row(3)));
+        return Vector3{result[0], result[1], result[2]};
+    }
+
+    constexpr Vector4 Matrix::TransformPoint(const Vector4& p) const
+    {
+        return TransformPoint(p.x, p.y, p.z, p.w);
+    }
+
+    constexpr Vector4 Matrix::TransformPoint(float x, float y, float z, float w) const
+    {
+        if (std::is_constant_evaluated())
+        {
+            return CombineScalar(x, y, z, w);
+        }
+
+        Vector4 result;
+        simd::Store(&result.x, Combine(x, y, z, w));
+        return result;
+    }
+
+    template <typename In, typename Out, typename Transform>
+    void Matrix::TransformBatch(StridedSpan<const In> in, StridedSpan<Out> out, const Transform& transform)
+    {
+        assert(in.size() == out.size() && "Matrix::TransformBatch: Input and output sizes differ");
+
+        const size_t count{in.size()};
+        size_t idx{0};
+        for (; idx + 4 <= count; idx += 4)
+        {
+            if (idx + s_PrefetchDistance < count)
+            {
+                simd::Prefetch(&in[idx + s_PrefetchDistance]);
+            }
+
+            // All four are read before any is written, in place stays correct
+            const In in0{in[idx]};
+            const In in1{in[idx + 1]};
+            const In in2{in[idx + 2]};
+            const In in3{in[idx + 3]};
+            transform(in0, out[idx]);
+            transform(in1, out[idx + 1]);
+            transform(in2, out[idx + 2]);
+            transform(in3, out[idx + 3]);
+        }
+
+        for (; idx < count; ++idx)
+        {
+            transform(in[idx], out[idx]);
+        }
+    }
+
+    inline void Matrix::TransformPoints(StridedSpan<const Vector3> points, StridedSpan<Vector3> out) const
+    {
+        using namespace simd;
+        const Float4 row0{Row(0)}, row1{Row(1)}, row2{Row(2)}, row3{Row(3)};
+        TransformBatch(points, out, [&](const Vector3& p, Vector3& result)
+        {
+            float lanes[4];
+            Store(lanes, Add(Add(Add(Mul(row0, Splat(p.x)), Mul(row1, Splat(p.y))), Mul(row2, Splat(p.z))), row3));
+            result = Vector3{lanes[0], lanes[1], lanes[2]};
+        });
+    }
+
+    inline void Matrix::TransformVectors(StridedSpan<const Vector3> vectors, StridedSpan<Vector3> out) const
+    {
+        using namespace simd;
+        const Float4 row0{Row(0)}, row1{Row(1)}, row2{Row(2)};
+        TransformBatch(vectors, out, [&](const Vector3& v, Vector3& result)
+        {
+            float lanes[4];
+            Store(lanes, Add(Add(Mul(row0, Splat(v.x)), Mul(row1, Splat(v.y))), Mul(row2, Splat(v.z))));
+            result = Vector3{lanes[0], lanes[1], lanes[2]};
+        });
+    }
+
+    inline void Matrix::TransformPointsToClip(StridedSpan<const Vector3> points, StridedSpan<Vector4> out) const
+    {
+        using namespace simd;
+        // row3 * 1 is row3, no multiply needed for w
+        const Float4 row0{Row(0)}, row1{Row(1)}, row2{Row(2)}, row3{Row(3)};
+        TransformBatch(points, out, [&](const Vector3& p, Vector4& result)
+        {
+            Store(&result.x, Add(Add(Add(Mul(row0, Splat(p.x)), Mul(row1, Splat(p.y))), Mul(row2, Splat(p.z))), row3));
+        });
+    }
+
+    template <bool IsPoint>
+    void Matrix::TransformSoA(std::span<const float> x, std::span<const float> y, std::span<const float> z,
+                              std::span<float> outX, std::span<float> outY, std::span<float> outZ) const
+    {
+        using namespace simd;
+        const size_t count{x.size()};
+        assert(y.size() == count && z.size() == count && "Matrix::TransformSoA: Input sizes differ");
+        assert(outX.size() == count && outY.size() == count && outZ.size() == count && "Matrix::TransformSoA: Output sizes differ");
+
+        // Every matrix element in all four lanes, one lane per element
+        Float4 m[4][3];
+        for (int r{0}; r < 4; ++r)
+        {
+            for (int c{0}; c < 3; ++c)
+            {
+                m[r][c] = Splat(data[r][c]);
+            }
+        }
+
+        size_t idx{0};
+        for (; idx + 4 <= count; idx += 4)
+        {
+            if (idx + s_PrefetchDistance < count)
+            {
+                Prefetch(&x[idx + s_PrefetchDistance]);
+                Prefetch(&y[idx + s_PrefetchDistance]);
+                Prefetch(&z[idx + s_PrefetchDistance]);
+            }
+
+            const Float4 xs{Load(&x[idx])};
+            const Float4 ys{Load(&y[idx])};
+            const Float4 zs{Load(&z[idx])};
+
+            Float4 result[3];
+            for (int c{0}; c < 3; ++c)
+            {
+                result[c] = Add(Add(Mul(m[0][c], xs), Mul(m[1][c], ys)), Mul(m[2][c], zs));
+                if constexpr (IsPoint)
+                {
+                    result[c] = Add(result[c], m[3][c]);
+                }
+            }
+
+            Store(&outX[idx], result[0]);
+            Store(&outY[idx], result[1]);
+            Store(&outZ[idx], result[2]);
+        }
+
+        for (; idx < count; ++idx)
+        {
+            const Vector3 result{IsPoint ? TransformPoint(x[idx], y[idx], z[idx]) : TransformVector(x[idx], y[idx], z[idx])};
+            outX[idx] = result.x;
+            outY[idx] = result.y;
+            outZ[idx] = result.z;
+        }
+    }
+
+    inline void Matrix::TransformPoints(std::span<const float> x, std::span<const float> y, std::span<const float> z,
+                                        std::span<float> outX, std::span<float> outY, std::span<float> outZ) const
+    {
+        TransformSoA<true>(x, y, z, outX, outY, outZ);
+    }
+
+    inline void Matrix::TransformVectors(std::span<const float> x, std::span<const float> y, std::span<const float> z,
+                                         std::span<float> outX, std::span<float> outY, std::span<float> outZ) const
+    {
+        TransformSoA<false>(x, y, z, outX, outY, outZ);
+    }
+
+    constexpr const Matrix& Matrix::Transpose()
+    {
+        for (int r{0}; r < 4; ++r)
+        {
+            for (int c{r + 1}; c < 4; ++c)
+            {
+                std::swap(data[r][c], data[c][r]);
+            }
+        }
+
+        return *this;
+    }
+
+    /**
+     * \brief Any invertible 4x4, not only affine ones
+     */
+    inline const Matrix& Matrix::Inverse()
+    {
+        //Optimized Inverse as explained in FGED1 - used widely in other libraries too.
+        const Vector3 a = data[0];
+        const Vector3 b = data[1];
+        const Vector3 c = data[2];
+        const Vector3 d = data[3];
+
+        const float x = data[0][3];
+        const float y = data[1][3];
+        const float z = data[2][3];
+        const float w = data[3][3];
+
+        Vector3 s = Vector3::Cross(a, b);
+        Vector3 t = Vector3::Cross(c, d);
+        Vector3 u = a * y - b * x;
+        Vector3 v = c * w - d * z;
+
+        float det = Vector3::Dot(s, v) + Vector3::Dot(t, u);
+        assert((!AreEqual(det, 0.f)) && "ERROR: determinant is 0, there is no INVERSE!");
+        float invDet = 1.f / det;
+
+        s *= invDet;
+        t *= invDet;
+        u *= invDet;
+        v *= invDet;
+
+        Vector3 r0 = Vector3::Cross(b, v) + t * y;
+        Vector3 r1 = Vector3::Cross(v, a) - t * x;
+        Vector3 r2 = Vector3::Cross(d, u) + s * w;
+        Vector3 r3 = Vector3::Cross(u, c) - s * z;
+
+        data[0] = Vector4{r0.x, r1.x, r2.x, r3.x};
+        data[1] = Vector4{r0.y, r1.y, r2.y, r3.y};
+        data[2] = Vector4{r0.z, r1.z, r2.z, r3.z};
+        data[3] = {{-Vector3::Dot(b, t)}, {Vector3::Dot(a, t)}, {-Vector3::Dot(d, s)}, {Vector3::Dot(c, s)}};
+
+        return *this;
+    }
+
+    constexpr Matrix Matrix::Transpose(const Matrix& m)
+    {
+        Matrix out{m};
+        out.Transpose();
+
+        return out;
+    }
+
+    inline Matrix Matrix::Inverse(const Matrix& m)
+    {
+        Matrix out{m};
+        out.Inverse();
+
+        return out;
+    }
+
+    constexpr Matrix Matrix::CreateTranslation(float x, float y, float z)
+    {
+        return CreateTranslation({x, y, z});
+    }
+
+    constexpr Matrix Matrix::CreateTranslation(const Vector3& t)
+    {
+        return {Vector3::UnitX, Vector3::UnitY, Vector3::UnitZ, t};
+    }
+
+    constexpr Matrix Matrix::CreateRotationX(float pitch)
+    {
+        return {
+            {1, 0, 0, 0},
+            {0, Cos(pitch), -Sin(pitch), 0},
+            {0, Sin(pitch), Cos(pitch), 0},
+            {0, 0, 0, 1}
+        };
+    }
+
+    constexpr Matrix Matrix::CreateRotationY(float yaw)
+    {
+        return {
+            {Cos(yaw), 0, -Sin(yaw), 0},
+            {0, 1, 0, 0},
+            {Sin(yaw), 0, Cos(yaw), 0},
+            {0, 0, 0, 1}
+        };
+    }
+
+    constexpr Matrix Matrix::CreateRotationZ(float roll)
+    {
+        return {
+            {Cos(roll), Sin(roll), 0, 0},
+            {-Sin(roll), Cos(roll), 0, 0},
+            {0, 0, 1, 0},
+            {0, 0, 0, 1}
+        };
+    }
+
+    constexpr Matrix Matrix::CreateRotation(float pitch, float yaw, float roll)
+    {
+        return CreateRotation({pitch, yaw, roll});
+    }
+
+    constexpr Matrix Matrix::CreateRotation(const Vector3& r)
+    {
+        return CreateRotationX(r[0]) * CreateRotationY(r[1]) * CreateRotationZ(r[2]);
+    }
+
+    constexpr Matrix Matrix::CreateScale(float sx, float sy, float sz)
+    {
+        return {{sx, 0, 0}, {0, sy, 0}, {0, 0, sz}, Vector3::Zero};
+    }
+
+    constexpr Matrix Matrix::CreateScale(const Vector3& s)
+    {
+        return CreateScale(s[0], s[1], s[2]);
+    }
+
+    constexpr Matrix Matrix::CreatePerspectiveFovLH(float fov, float aspect, float zn, float zf)
+    {
+        return {
+            {1.0f / (aspect * fov), 0.0f, 0.0f, 0.0f},
+            {0.0f, 1.0f / fov, 0.0f, 0.0f},
+            {0.0f, 0.0f, zf / (zf - zn), 1.0f},
+            {0.0f, 0.0f, -zf * zn / (zf - zn), 0.0f}
+        };
+    }
+
+    constexpr Vector3 Matrix::GetAxisX() const
+    {
+        return data[0];
+    }
+
+    constexpr Vector3 Matrix::GetAxisY() const
+    {
+        return data[1];
+    }
+
+    constexpr Vector3 Matrix::GetAxisZ() const
+    {
+        return data[2];
+    }
+
+    constexpr Vector3 Matrix::GetTranslation() const
+    {
+        return data[3];
+    }
+
+#pragma region Operator Overloads
+    constexpr Vector4& Matrix::operator[](int index)
+    {
+        assert(index <= 3 && index >= 0);
+        return data[index];
+    }
+
+    constexpr Vector4 Matrix::operator[](int index) const
+    {
+        assert(index <= 3 && index >= 0);
+        return data[index];
+    }
+
+    // Row r of the product is row r of this matrix transforming m
+    constexpr Matrix Matrix::operator*(const Matrix& m) const
+    {
+        Matrix result;
+        for (int r{0}; r < 4; ++r)
+        {
+            if (std::is_constant_evaluated())
+            {
+                result.data[r] = m.CombineScalar(data[r].x, data[r].y, data[r].z, data[r].w);
+                continue;
+            }
+            simd::Store(&result.data[r].x, m.Combine(data[r].x, data[r].y, data[r].z, data[r].w));
+        }
+
+        return result;
+    }
+
+    constexpr const Matrix& Matrix::operator*=(const Matrix& m)
+    {
+        *this = *this * m;
+        return *this;
+    }
+
+    constexpr bool Matrix::operator==(const Matrix& m) const
+    {
+        return data[0] == m.data[0]
+            && data[1] == m.data[1]
+            && data[2] == m.data[2]
+            && data[3] == m.data[3];
+    }
+#pragma endregion
 }
@@ -0,0 +1,405 @@
+#include "PngImageLoader.h"
+#include "FrameBuffer.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+namespace dae
+{
+    namespace
+    {
+        uint32_t ReadBigEndian(const uint8_t* dataPtr)
+        {
+            return (static_cast<uint32_t>(dataPtr[0]) << 24) | (static_cast<uint32_t>(dataPtr[1]) << 16) | (static_cast<uint32_t>(dataPtr[2]) << 8) | dataPtr[3];
+        }
+
+#pragma region Inflate
+        // Deflate reads its bits least significant first
+        struct BitReader
+        {
+            const std::vector<uint8_t>& data;
+            size_t   offset    {0};
+            uint32_t bitBuffer {0};
+            int      bitCount  {0};
+            bool     isOverrun {false};
+
+            int GetBits(int count)
+            {
+                while (bitCount < count)
+                {
+                    if (offset == data.size())
+                    {
+                        isOverrun = true;
+                        return 0;
+                    }
+                    bitBuffer |= static_cast<uint32_t>(data[offset++]) << bitCount;
+                    bitCount += 8;
+                }
+                const int value{static_cast<int>(bitBuffer & ((1u << count) - 1))};
+                bitBuffer >>= count;
+                bitCount -= count;
+                return value;
+            }
+
+            // Stored blocks start on a byte boundary
+            void AlignToByte()
+            {
+                bitBuffer = 0;
+                bitCount  = 0;
+            }
+        };
+
+        // Canonical Huffman code: how many codes of each length, and the symbols ordered by code
+        struct Huffman
+        {
+            std::array<uint16_t, 16>  counts  {};
+            std::array<uint16_t, 288> symbols {};
+        };
+
+        // false for an over-subscribed code, incomplete codes are allowed (a single distance code is legal)
+        bool BuildHuffman(Huffman& huffman, const uint8_t* lengthsPtr, int symbolCount)
+        {
+            huffman.counts.fill(0);
+            for (int symbol{0}; symbol < symbolCount; ++symbol) ++huffman.counts[lengthsPtr[symbol]];
+            if (huffman.counts[0] == symbolCount) return true;
+
+            int left{1};
+            for (int length{1}; length < 16; ++length)
+            {
+                left = (left << 1) - huffman.counts[length];
+                if (left < 0) return false;
+            }
+
+            std::array<uint16_t, 16> offsets{};
+            for (int length{1}; length < 15; ++length) offsets[length + 1] = offsets[length] + huffman.counts[length];
+            for (int symbol{0}; symbol < symbolCount; ++symbol)
+            {
+                if (lengthsPtr[symbol] != 0) huffman.symbols[offsets[lengthsPtr[symbol]]++] = static_cast<uint16_t>(symbol);
+            }
+            return true;
+        }
+
+        // -1 when no code matches
+        int DecodeSymbol(BitReader& reader, const Huffman& huffman)
+        {
+            int code{0};
+            int first{0};
+            int index{0};
+            for (int length{1}; length < 16; ++length)
+            {
+                code |= reader.GetBits(1);
+                const int count{huffman.counts[length]};
+                if (code - first < count) return huffman.symbols[index + code - first];
+                index += count;
+                first = (first + count) << 1;
+                code <<= 1;
+            }
+            return -1;
+        }
+
+        constexpr std::array<uint16_t, 29> s_LengthBase{3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+        constexpr std::array<uint8_t, 29>  s_LengthExtra{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+        constexpr std::array<uint16_t, 30> s_DistanceBase{1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+        constexpr std::array<uint8_t, 30>  s_DistanceExtra{0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+        bool InflateCodes(BitReader& reader, const Huffman& lengthCode, const Huffman& distanceCode, std::vector<uint8_t>& output)
+        {
+            while (not reader.isOverrun)
+            {
+                const int symbol{DecodeSymbol(reader, lengthCode)};
+                if (symbol < 0) return false;
+                if (symbol < 256)
+                {
+                    output.push_back(static_cast<uint8_t>(symbol));
+                    continue;
+                }
+                if (symbol == 256) return true;
+                if (symbol > 285) return false;
+
+                const size_t length{s_LengthBase[symbol - 257] + static_cast<size_t>(reader.GetBits(s_LengthExtra[symbol - 257]))};
+                const int distanceSymbol{DecodeSymbol(reader, distanceCode)};
+                if (distanceSymbol < 0 or distanceSymbol > 29) return false;
+                const size_t distance{s_DistanceBase[distanceSymbol] + static_cast<size_t>(reader.GetBits(s_DistanceExtra[distanceSymbol]))};
+                if (distance > output.size()) return false;
+
+                // Byte by byte, the copy may overlap what it writes
+                const size_t start{output.size() - distance};
+                for (size_t idx{0}; idx < length; ++idx) output.push_back(output[start + idx]);
+            }
+            return false;
+        }
+
+        bool InflateFixed(BitReader& reader, std::vector<uint8_t>& output)
+        {
+            std::array<uint8_t, 288> lengths{};
+            for (int symbol{0}; symbol < 288; ++symbol) lengths[symbol] = symbol < 144 ? 8 : symbol < 256 ? 9 : symbol < 280 ? 7 : 8;
+            Huffman lengthCode{};
+            BuildHuffman(lengthCode, lengths.data(), 288);
+
+            lengths.fill(5);
+            Huffman distanceCode{};
+            BuildHuffman(distanceCode, lengths.data(), 30);
+            return InflateCodes(reader, lengthCode, distanceCode, output);
+        }
+
+        bool InflateDynamic(BitReader& reader, std::vector<uint8_t>& output)
+        {
+            constexpr std::array<uint8_t, 19> codeLengthOrder{16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+            const int lengthCount{reader.GetBits(5) + 257};
+            const int distanceCount{reader.GetBits(5) + 1};
+            const int codeLengthCount{reader.GetBits(4) + 4};
+            if (lengthCount > 286 or distanceCount > 30) return false;
+
+            std::array<uint8_t, 320> lengths{};
+            for (int idx{0}; idx < codeLengthCount; ++idx) lengths[codeLengthOrder[idx]] = static_cast<uint8_t>(reader.GetBits(3));
+            Huffman codeLengthCode{};
+            if (not BuildHuffman(codeLengthCode, lengths.data(), 19)) return false;
+
+            // Literal/length and distance code lengths are one sequence, repeats may cross from one into the other
+            lengths.fill(0);
+            int index{0};
+            while (index < lengthCount + distanceCount)
+            {
+                const int symbol{DecodeSymbol(reader, codeLengthCode)};
+                if (symbol < 0 or reader.isOverrun) return false;
+                if (symbol < 16)
+                {
+                    lengths[index++] = static_cast<uint8_t>(symbol);
+                    continue;
+                }
+
+                uint8_t length{0};
+                int     repeat{0};
+                if (symbol == 16)
+                {
+                    if (index == 0) return false;
+                    length = lengths[index - 1];
+                    repeat = 3 + reader.GetBits(2);
+                }
+                else if (symbol == 17)
+                {
+                    repeat = 3 + reader.GetBits(3);
+                }
+                else
+                {
+                    repeat = 11 + reader.GetBits(7);
+                }
+                if (index + repeat > lengthCount + distanceCount) return false;
+                while (repeat-- > 0) lengths[index++] = length;
+            }
+            if (lengths[256] == 0) return false;
+
+            Huffman lengthCode{};
+            Huffman distanceCode{};
+            if (not BuildHuffman(lengthCode, lengths.data(), lengthCount)) return false;
+            if (not BuildHuffman(distanceCode, lengths.data() + lengthCount, distanceCount)) return false;
+            return InflateCodes(reader, lengthCode, distanceCode, output);
+        }
+
+        // zlib stream (RFC 1950) around deflate blocks (RFC 1951), the Adler-32 at the end is not checked
+        bool Inflate(const std::vector<uint8_t>& zlib, std::vector<uint8_t>& output, std::string& error)
+        {
+            if (zlib.size() < 2 or (zlib[0] & 0x0F) != 8 or ((zlib[0] << 8) | zlib[1]) % 31 != 0 or (zlib[1] & 0x20))
+            {
+                error = "Invalid zlib header";
+                return false;
+            }
+
+            BitReader reader{zlib, 2};
+            bool isFinal{false};
+            while (not isFinal)
+            {
+                isFinal = reader.GetBits(1);
+                const int type{reader.GetBits(2)};
+                bool isValid{false};
+                if (type == 0)
+                {
+                    reader.AlignToByte();
+                    if (reader.offset + 4 > zlib.size()) break;
+                    const size_t size{static_cast<size_t>(zlib[reader.offset] | (zlib[reader.offset + 1] << 8))};
+                    const size_t inverted{static_cast<size_t>(zlib[reader.offset + 2] | (zlib[reader.offset + 3] << 8))};
+                    reader.offset += 4;
+                    isValid = (size ^ 0xFFFF) == inverted and reader.offset + size <= zlib.size();
+                    if (isValid)
+                    {
+                        output.insert(output.end(), zlib.begin() + static_cast<std::ptrdiff_t>(reader.offset), zlib.begin() + static_cast<std::ptrdiff_t>(reader.offset + size));
+                        reader.offset += size;
+                    }
+                }
+                else if (type == 1)
+                {
+                    isValid = InflateFixed(reader, output);
+                }
+                else if (type == 2)
+                {
+                    isValid = InflateDynamic(reader, output);
+                }
+
+                if (not isValid or reader.isOverrun)
+                {
+                    error = "Invalid deflate block";
+                    return false;
+                }
+            }
+            return true;
+        }
+#pragma endregion
+
+#pragma region Filters
+        uint8_t Paeth(int left, int up, int upLeft)
+        {
+            const int estimate{left + up - upLeft};
+            const int leftDistance{std::abs(estimate - left)};
+            const int upDistance{std::abs(estimate - up)};
+            const int upLeftDistance{std::abs(estimate - upLeft)};
+            if (leftDistance <= upDistance and leftDistance <= upLeftDistance) return static_cast<uint8_t>(left);
+            return static_cast<uint8_t>(upDistance <= upLeftDistance ? up : upLeft);
+        }
+
+        // In place: rows hold a filter byte followed by rowSize bytes, previous rows are already reconstructed
+        bool Unfilter(std::vector<uint8_t>& rows, int height, size_t rowSize, size_t bytesPerPixel)
+        {
+            for (int y{0}; y < height; ++y)
+            {
+                uint8_t*       rowPtr{&rows[y * (rowSize + 1) + 1]};
+                const uint8_t* upPtr{y > 0 ? rowPtr - (rowSize + 1) : nullptr};
+                const uint8_t  filter{rowPtr[-1]};
+                for (size_t idx{0}; idx < rowSize; ++idx)
+                {
+                    const int left{idx >= bytesPerPixel ? rowPtr[idx - bytesPerPixel] : 0};
+                    const int up{upPtr ? upPtr[idx] : 0};
+                    const int upLeft{upPtr and idx >= bytesPerPixel ? upPtr[idx - bytesPerPixel] : 0};
+                    switch (filter)
+                    {
+                    case 0: break;
+                    case 1: rowPtr[idx] = static_cast<uint8_t>(rowPtr[idx] + left); break;
+                    case 2: rowPtr[idx] = static_cast<uint8_t>(rowPtr[idx] + up); break;
+                    case 3: rowPtr[idx] = static_cast<uint8_t>(rowPtr[idx] + (left + up) / 2); break;
+                    case 4: rowPtr[idx] = static_cast<uint8_t>(rowPtr[idx] + Paeth(left, up, upLeft)); break;
+                    default: return false;
+                    }
+                }
+            }
+            return true;
+        }
+#pragma endregion
+    }
+
+    /**
+     * \brief Collects the IDAT chunks, inflates and unfilters them and expands every pixel to RGBA8
+     */
+    bool PngImageLoader::Load(const std::string& path, int& width, int& height, std::vector<uint32_t>& texels) const
+    {
+        const auto fail = [&path](const std::string& reason)
+        {
+            std::cout << "PngImageLoader::Load() failed: " << reason << " (" << path << ")" << std::endl;
+            return false;
+        };
+
+        std::ifstream file(path, std::ios::binary);
+        if (not file) return fail("Cannot open file");
+        const std::vector<uint8_t> data{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+
+        constexpr std::array<uint8_t, 8> signature{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        if (data.size() < 8 + 25 or not std::equal(signature.begin(), signature.end(), data.begin())) return fail("Not a PNG file");
+
+        // Header, palette and image data, the CRCs are not checked
+        int     imageWidth{0};
+        int     imageHeight{0};
+        int     bitDepth{0};
+        int     colorType{-1};
+        std::vector<uint32_t> palette{};
+        std::vector<uint8_t>  zlib{};
+        for (size_t offset{8}; offset + 12 <= data.size();)
+        {
+            const size_t size{ReadBigEndian(&data[offset])};
+            if (offset + 12 + size > data.size()) return fail("Truncated chunk");
+            const std::string type(reinterpret_cast<const char*>(&data[offset + 4]), 4);
+            const uint8_t*    chunkPtr{&data[offset + 8]};
+
+            if (type == "IHDR" and size >= 13)
+            {
+                imageWidth  = static_cast<int>(ReadBigEndian(chunkPtr));
+                imageHeight = static_cast<int>(ReadBigEndian(chunkPtr + 4));
+                bitDepth    = chunkPtr[8];
+                colorType   = chunkPtr[9];
+                if (chunkPtr[12] != 0) return fail("Interlaced images are not supported");
+            }
+            else if (type == "PLTE")
+            {
+                palette.resize(size / 3);
+                for (size_t idx{0}; idx < palette.size(); ++idx)
+                {
+                    palette[idx] = FrameBuffer::PackColor(chunkPtr[idx * 3], chunkPtr[idx * 3 + 1], chunkPtr[idx * 3 + 2]);
+                }
+            }
+            else if (type == "tRNS" and colorType == 3)
+            {
+                for (size_t idx{0}; idx < size and idx < palette.size(); ++idx)
+                {
+                    palette[idx] = (palette[idx] & FrameBuffer::PackColor(255, 255, 255, 0)) | FrameBuffer::PackColor(0, 0, 0, chunkPtr[idx]);
+                }
+            }
+            else if (type == "IDAT")
+            {
+                zlib.insert(zlib.end(), chunkPtr, chunkPtr + size);
+            }
+            else if (type == "IEND")
+            {
+                break;
+            }
+            offset += 12 + size;
+        }
+
+        // Channels per pixel by color type: gray, -, RGB, palette, gray + alpha, -, RGBA
+        constexpr std::array<int, 7> channelCounts{1, 0, 3, 1, 2, 0, 4};
+        if (imageWidth <= 0 or imageHeight <= 0) return fail("Missing or invalid IHDR");
+        if (colorType < 0 or colorType > 6 or channelCounts[colorType] == 0) return fail("Unknown color type");
+        if (bitDepth != 8 and not (bitDepth == 16 and colorType != 3)) return fail("Unsupported bit depth");
+        if (colorType == 3 and palette.empty()) return fail("Missing PLTE");
+
+        const size_t bytesPerPixel{static_cast<size_t>(channelCounts[colorType] * bitDepth / 8)};
+        const size_t rowSize{bytesPerPixel * imageWidth};
+        // Deflate cannot expand more than 1032:1, so a bogus header does not get to allocate
+        if (static_cast<size_t>(imageHeight) > zlib.size() * 1032 / (rowSize + 1)) return fail("Not enough image data");
+        std::vector<uint8_t> rows{};
+        rows.reserve((rowSize + 1) * imageHeight);
+        std::string error{};
+        if (not Inflate(zlib, rows, error)) return fail(error);
+        if (rows.size() < (rowSize + 1) * imageHeight) return fail("Not enough image data");
+        if (not Unfilter(rows, imageHeight, rowSize, bytesPerPixel)) return fail("Unknown filter type");
+
+        // 16-bit channels are big endian, the high byte comes first
+        const size_t channelStride{static_cast<size_t>(bitDepth / 8)};
+        std::vector<uint32_t> decoded(static_cast<size_t>(imageWidth) * imageHeight);
+        for (int y{0}; y < imageHeight; ++y)
+        {
+            const uint8_t* rowPtr{&rows[y * (rowSize + 1) + 1]};
+            for (int x{0}; x < imageWidth; ++x)
+            {
+                const uint8_t* pixelPtr{rowPtr + x * bytesPerPixel};
+                const auto channel = [pixelPtr, channelStride](int index) { return pixelPtr[index * channelStride]; };
+
+                uint32_t& texel{decoded[static_cast<size_t>(y) * imageWidth + x]};
+                switch (colorType)
+                {
+                case 0: texel = FrameBuffer::PackColor(channel(0), channel(0), channel(0)); break;
+                case 2: texel = FrameBuffer::PackColor(channel(0), channel(1), channel(2)); break;
+                case 3: texel = pixelPtr[0] < palette.size() ? palette[pixelPtr[0]] : FrameBuffer::PackColor(0, 0, 0); break;
+                case 4: texel = FrameBuffer::PackColor(channel(0), channel(0), channel(0), channel(1)); break;
+                default: texel = FrameBuffer::PackColor(channel(0), channel(1), channel(2), channel(3)); break;
+                }
+            }
+        }
+
+        width  = imageWidth;
+        height = imageHeight;
+        texels = std::move(decoded);
+        return true;
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+// Project includes
+#include "ImageLoader.h"
+
+namespace dae
+{
+    /**
+     * \brief Dependency-free PNG decoder (zlib inflate + scanline filters), enough for the textures in Resources.
+     * Supports non-interlaced gray, RGB, palette, gray + alpha and RGBA at 8 bits per channel,
+     * 16-bit channels keep their high byte. Anything else fails with the reason on stdout.
+     */
+    class PngImageLoader final : public ImageLoader
+    {
+    public:
+        bool Load(const std::string& path, int& width, int& height, std::vector<uint32_t>& texels) const override;
+    };
+}
@@ -0,0 +1,232 @@
+#include "Profiler.h"
+
+#include <cassert>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+
+namespace dae
+{
+    namespace
+    {
+        // Buffer of the current thread, registered on its first zone
+        thread_local void* t_ThreadBufferPtr {nullptr};
+
+        void WriteJsonString(std::ostream& stream, const std::string& text)
+        {
+            stream << '"';
+            for (const char character : text)
+            {
+                if (character == '"' or character == '\\') stream << '\\';
+                stream << character;
+            }
+            stream << '"';
+        }
+    }
+
+    Profiler::Profiler() :
+        m_FrameStartNs{Now()}
+    {
+    }
+
+    Profiler& Profiler::Get()
+    {
+        static Profiler profiler{};
+        return profiler;
+    }
+
+    void Profiler::SetThreadName(const std::string& name)
+    {
+        ThreadBuffer& buffer{GetThreadBuffer()};
+        std::lock_guard lock{m_Mutex};
+        buffer.name = name;
+    }
+
+    void Profiler::BeginZone(const char* name)
+    {
+        ThreadBuffer& buffer{GetThreadBuffer()};
+        std::lock_guard lock{buffer.mutex};
+        if (buffer.events.size() == s_EventCapacity)
+        {
+            // Never grow while recording, the zone is lost instead
+            ++buffer.dropped;
+            buffer.openZones.push_back(s_Dropped);
+            return;
+        }
+
+        buffer.openZones.push_back(static_cast<uint32_t>(buffer.events.size()));
+        buffer.events.push_back({name, Now(), 0, static_cast<uint32_t>(buffer.openZones.size() - 1)});
+    }
+
+    void Profiler::EndZone()
+    {
+        ThreadBuffer& buffer{GetThreadBuffer()};
+        std::lock_guard lock{buffer.mutex};
+        assert(not buffer.openZones.empty() and "Profiler::EndZone: No zone open");
+
+        const uint32_t eventIndex{buffer.openZones.back()};
+        buffer.openZones.pop_back();
+        if (eventIndex != s_Dropped)
+        {
+            buffer.events[eventIndex].endNs = Now();
+        }
+    }
+
+    /**
+     * \brief Moves every thread's zones into the last frame (and the capture), the buffers are reused
+     */
+    void Profiler::EndFrame()
+    {
+        const int64_t frameEndNs{Now()};
+
+        // Refilled in place: the vectors keep their capacity, once every thread has been seen this does not allocate
+        ProfileFrame& frame{m_IsPaused ? m_PausedFrame : m_LastFrame};
+        frame.startNs = m_FrameStartNs;
+        frame.endNs   = frameEndNs;
+        m_FrameStartNs = frameEndNs;
+
+        {
+            std::lock_guard lock{m_Mutex};
+            size_t threadCount{0};
+            for (const auto& bufferPtr : m_Threads)
+            {
+                std::lock_guard bufferLock{bufferPtr->mutex};
+
+                // A zone still open keeps the buffer as is, it is picked up by a later frame.
+                // Only the caller's own zone is a mistake, other threads may run outside of the frames
+                assert((bufferPtr.get() != t_ThreadBufferPtr or bufferPtr->openZones.empty()) and "Profiler::EndFrame: Called inside a zone");
+                if (not bufferPtr->openZones.empty()) continue;
+
+                if (threadCount == frame.threads.size())
+                {
+                    // Full capacity up front: stolen jobs change a thread's zone count from frame to frame
+                    frame.threads.emplace_back();
+                    frame.threads.back().events.reserve(s_EventCapacity);
+                }
+                ProfileThread& thread{frame.threads[threadCount++]};
+                thread.name = bufferPtr->name;
+                thread.events.assign(bufferPtr->events.begin(), bufferPtr->events.end());
+                bufferPtr->events.clear();
+
+                m_DroppedEvents    += bufferPtr->dropped;
+                bufferPtr->dropped  = 0;
+            }
+            frame.threads.resize(threadCount);
+        }
+
+        if (m_CaptureFramesLeft > 0)
+        {
+            m_CapturedFrames.push_back(frame);
+            --m_CaptureFramesLeft;
+        }
+    }
+
+    void Profiler::StartCapture(uint32_t frameCount)
+    {
+        m_CapturedFrames.clear();
+        m_CapturedFrames.reserve(frameCount);
+        m_CaptureFramesLeft = frameCount;
+    }
+
+    void Profiler::ClearCapture()
+    {
+        m_CapturedFrames.clear();
+        m_CaptureFramesLeft = 0;
+    }
+
+    /**
+     * \brief Trace Event Format: one complete ("X") event per zone, timestamps in microseconds
+     * \param stream
+     */
+    void Profiler::WriteChromeTrace(std::ostream& stream) const
+    {
+        const int64_t originNs{m_CapturedFrames.empty() ? 0 : m_CapturedFrames.front().startNs};
+        const std::ios_base::fmtflags flags{stream.flags()};
+        stream << std::fixed << std::setprecision(3);
+
+        stream << "{\"traceEvents\":[\n";
+        bool isFirst{true};
+        const auto separate = [&stream, &isFirst]
+        {
+            if (not isFirst) stream << ",\n";
+            isFirst = false;
+        };
+
+        // Threads are identified by their name, the same name across frames is the same row
+        std::vector<std::string> threadNames{};
+        const auto getThreadId = [&threadNames](const std::string& name)
+        {
+            for (size_t idx{0}; idx < threadNames.size(); ++idx)
+            {
+                if (threadNames[idx] == name) return idx;
+            }
+            threadNames.push_back(name);
+            return threadNames.size() - 1;
+        };
+
+        int frameIndex{0};
+        for (const ProfileFrame& frame : m_CapturedFrames)
+        {
+            for (const ProfileThread& thread : frame.threads)
+            {
+                const size_t threadId{getThreadId(thread.name)};
+                for (const ProfileEvent& event : thread.events)
+                {
+                    separate();
+                    stream << "{\"name\":";
+                    WriteJsonString(stream, event.name);
+                    stream << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadId
+                           << ",\"ts\":" << static_cast<double>(event.startNs - originNs) / 1000.0
+                           << ",\"dur\":" << static_cast<double>(event.endNs - event.startNs) / 1000.0
+                           << ",\"args\":{\"frame\":" << frameIndex << "}}";
+                }
+            }
+            ++frameIndex;
+        }
+
+        for (size_t threadId{0}; threadId < threadNames.size(); ++threadId)
+        {
+            separate();
+            stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadId << ",\"args\":{\"name\":";
+            WriteJsonString(stream, threadNames[threadId]);
+            stream << "}}";
+        }
+        stream << "\n]}\n";
+
+        stream.flags(flags);
+    }
+
+    bool Profiler::SaveChromeTrace(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if (not file) return false;
+
+        WriteChromeTrace(file);
+        return file.good();
+    }
+
+    int64_t Profiler::Now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    Profiler::ThreadBuffer& Profiler::GetThreadBuffer()
+    {
+        if (t_ThreadBufferPtr)
+        {
+            return *static_cast<ThreadBuffer*>(t_ThreadBufferPtr);
+        }
+
+        // First zone of this thread: the only time recording takes the lock or allocates
+        auto bufferPtr{std::make_unique<ThreadBuffer>()};
+        bufferPtr->events.reserve(s_EventCapacity);
+        bufferPtr->openZones.reserve(64);
+
+        std::lock_guard lock{m_Mutex};
+        bufferPtr->name = "Thread " + std::to_string(m_Threads.size());
+        t_ThreadBufferPtr = bufferPtr.get();
+        m_Threads.push_back(std::move(bufferPtr));
+        return *m_Threads.back();
+    }
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+// Standard includes
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Set to 0 (e.g. in the project's preprocessor definitions) to compile every zone out
+#ifndef ENABLE_PROFILER
+#define ENABLE_PROFILER 1
+#endif
+
+namespace dae
+{
+    struct ProfileEvent
+    {
+        const char* name    {nullptr}; // String literal, only the pointer is stored
+        int64_t     startNs {0};
+        int64_t     endNs   {0};
+        uint32_t    depth   {0};       // Nesting level on its thread
+    };
+
+    struct ProfileThread
+    {
+        std::string               name   {};
+        std::vector<ProfileEvent> events {};
+    };
+
+    // Everything recorded between two Profiler::EndFrame calls
+    struct ProfileFrame
+    {
+        int64_t                    startNs {0};
+        int64_t                    endNs   {0};
+        std::vector<ProfileThread> threads {};
+    };
+
+    /**
+     * \brief Scoped CPU zones on every thread, use PROFILE_SCOPE / PROFILE_THREAD instead of calling it directly.
+     * Every thread appends to its own preallocated buffer, recording a zone never allocates and only takes the buffer's own lock,
+     * which nothing but EndFrame contends for. EndFrame gathers the buffers at the frame boundary (render thread idle, job system drained);
+     * a thread that runs outside of the frames and is inside a zone right then keeps its buffer until a later EndFrame.
+     */
+    class Profiler final
+    {
+    public:
+        static Profiler& Get();
+
+        ~Profiler() = default;
+
+        Profiler(const Profiler&)                = delete;
+        Profiler(Profiler&&) noexcept            = delete;
+        Profiler& operator=(const Profiler&)     = delete;
+        Profiler& operator=(Profiler&&) noexcept = delete;
+
+        void SetThreadName(const std::string& name);
+        void BeginZone(const char* name);
+        void EndZone();
+
+        void EndFrame();
+
+        // Keeps the last frame on screen, recording goes on
+        inline void SetPaused(bool isPaused) { m_IsPaused = isPaused; }
+        inline bool IsPaused()         const { return m_IsPaused; }
+        inline const ProfileFrame& GetLastFrame() const { return m_LastFrame; }
+
+        // Keeps the next frameCount frames for WriteChromeTrace
+        void StartCapture(uint32_t frameCount);
+        inline bool     IsCapturing()         const { return m_CaptureFramesLeft > 0; }
+        inline bool     HasCapture()          const { return not m_CapturedFrames.empty() and not IsCapturing(); }
+        inline size_t   GetCapturedFrameCount() const { return m_CapturedFrames.size(); }
+        inline uint64_t GetDroppedEvents()    const { return m_DroppedEvents; }
+
+        // chrome://tracing or https://ui.perfetto.dev
+        void WriteChromeTrace(std::ostream& stream) const;
+        bool SaveChromeTrace(const std::string& path) const;
+        void ClearCapture();
+
+        static int64_t Now();
+
+    private:
+        struct ThreadBuffer
+        {
+            std::string               name       {};
+            std::vector<ProfileEvent> events     {};
+            std::vector<uint32_t>     openZones  {}; // Indices into events, s_Dropped if the buffer was full
+            uint64_t                  dropped    {0};
+            std::mutex                mutex      {}; // Guards the above against EndFrame
+        };
+
+        static constexpr size_t   s_EventCapacity{16 * 1024}; // Per thread and frame
+        static constexpr uint32_t s_Dropped{UINT32_MAX};
+
+        Profiler();
+
+        ThreadBuffer& GetThreadBuffer();
+
+        std::mutex                                 m_Mutex             {}; // Guards m_Threads (registration)
+        std::vector<std::unique_ptr<ThreadBuffer>> m_Threads           {};
+        ProfileFrame                               m_LastFrame         {};
+        ProfileFrame                               m_PausedFrame       {}; // Gathered into while m_LastFrame is kept on screen
+        std::vector<ProfileFrame>                  m_CapturedFrames    {};
+        int64_t                                    m_FrameStartNs      {0};
+        uint32_t                                   m_CaptureFramesLeft {0};
+        uint64_t                                   m_DroppedEvents     {0};
+        bool                                       m_IsPaused          {false};
+    };
+
+    /**
+     * \brief RAII zone, see PROFILE_SCOPE
+     */
+    class ProfileZone final
+    {
+    public:
+        explicit ProfileZone(const char* name) { Profiler::Get().BeginZone(name); }
+        ~ProfileZone()                          { Profiler::Get().EndZone(); }
+
+        ProfileZone(const ProfileZone&)                = delete;
+        ProfileZone(ProfileZone&&) noexcept            = delete;
+        ProfileZone& operator=(const ProfileZone&)     = delete;
+        ProfileZone& operator=(ProfileZone&&) noexcept = delete;
+    };
+}
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if ENABLE_PROFILER
+// name must be a string literal
+#define PROFILE_SCOPE(name) const dae::ProfileZone PROFILE_CONCAT(profileZone, __LINE__){name}
+#define PROFILE_THREAD(name) dae::Profiler::Get().SetThreadName(name)
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_THREAD(name) ((void)0)
+#endif
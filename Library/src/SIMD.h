@@ -0,0 +1,121 @@
+#pragma once
+
+// Standard includes
+#include <cstdint>
+
+// SSE2 is always there on x64 and NEON on ARM64, no runtime detection needed.
+// Set to 0 (e.g. in the project's preprocessor definitions) to run the scalar fallback everywhere
+#ifndef ENABLE_SIMD
+#define ENABLE_SIMD 1
+#endif
+
+#if ENABLE_SIMD && (defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__))
+#define SIMD_SSE 1
+#include <emmintrin.h>
+#elif ENABLE_SIMD && (defined(_M_ARM64) || defined(__aarch64__))
+#define SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace dae::simd
+{
+    /**
+     * \brief Four floats in one register, only what the math types and the color resolve need.
+     * Every operation is a plain IEEE multiply, add or divide (no fused multiply-add), so the results are the same
+     * as the scalar code that does the operations in the same order.
+     * Max(a, b) is a > b ? a : b and Min(a, b) is a < b ? a : b, also in the scalar fallback.
+     * Int4 holds four 32-bit integers, e.g. quantized color channels being packed into pixels.
+     */
+#if SIMD_SSE
+    using Float4 = __m128;
+
+    inline Float4 Load(const float* ptr)          { return _mm_loadu_ps(ptr); }
+    inline void   Store(float* ptr, Float4 value) { _mm_storeu_ps(ptr, value); }
+    inline Float4 Splat(float value)              { return _mm_set1_ps(value); }
+    inline Float4 Add(Float4 a, Float4 b)         { return _mm_add_ps(a, b); }
+    inline Float4 Sub(Float4 a, Float4 b)         { return _mm_sub_ps(a, b); }
+    inline Float4 Mul(Float4 a, Float4 b)         { return _mm_mul_ps(a, b); }
+    inline Float4 Div(Float4 a, Float4 b)         { return _mm_div_ps(a, b); }
+    inline Float4 Min(Float4 a, Float4 b)         { return _mm_min_ps(a, b); }
+    inline Float4 Max(Float4 a, Float4 b)         { return _mm_max_ps(a, b); }
+    inline void   Prefetch(const void* ptr)       { _mm_prefetch(static_cast<const char*>(ptr), _MM_HINT_T0); }
+
+    using Int4 = __m128i;
+
+    inline Int4 Truncate(Float4 value)                  { return _mm_cvttps_epi32(value); }
+    inline Int4 SplatInt(uint32_t value)                { return _mm_set1_epi32(static_cast<int>(value)); }
+    inline Int4 Or(Int4 a, Int4 b)                      { return _mm_or_si128(a, b); }
+    template <int Bits> inline Int4 ShiftLeft(Int4 a)   { return _mm_slli_epi32(a, Bits); }
+    inline void Store(uint32_t* ptr, Int4 value)        { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), value); }
+    inline void Store(int32_t* ptr, Int4 value)         { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), value); }
+#elif SIMD_NEON
+    using Float4 = float32x4_t;
+
+    inline Float4 Load(const float* ptr)          { return vld1q_f32(ptr); }
+    inline void   Store(float* ptr, Float4 value) { vst1q_f32(ptr, value); }
+    inline Float4 Splat(float value)              { return vdupq_n_f32(value); }
+    inline Float4 Add(Float4 a, Float4 b)         { return vaddq_f32(a, b); }
+    inline Float4 Sub(Float4 a, Float4 b)         { return vsubq_f32(a, b); }
+    inline Float4 Mul(Float4 a, Float4 b)         { return vmulq_f32(a, b); }
+    inline Float4 Div(Float4 a, Float4 b)         { return vdivq_f32(a, b); }
+    inline Float4 Min(Float4 a, Float4 b)         { return vbslq_f32(vcltq_f32(a, b), a, b); }
+    inline Float4 Max(Float4 a, Float4 b)         { return vbslq_f32(vcgtq_f32(a, b), a, b); }
+#if defined(_MSC_VER)
+    inline void   Prefetch(const void* ptr)       { __prefetch(ptr); }
+#else
+    inline void   Prefetch(const void* ptr)       { __builtin_prefetch(ptr); }
+#endif
+
+    using Int4 = int32x4_t;
+
+    inline Int4 Truncate(Float4 value)                  { return vcvtq_s32_f32(value); }
+    inline Int4 SplatInt(uint32_t value)                { return vdupq_n_s32(static_cast<int32_t>(value)); }
+    inline Int4 Or(Int4 a, Int4 b)                      { return vorrq_s32(a, b); }
+    template <int Bits> inline Int4 ShiftLeft(Int4 a)   { return vshlq_n_s32(a, Bits); }
+    inline void Store(uint32_t* ptr, Int4 value)        { vst1q_u32(ptr, vreinterpretq_u32_s32(value)); }
+    inline void Store(int32_t* ptr, Int4 value)         { vst1q_s32(ptr, value); }
+#else
+    struct Float4
+    {
+        float lanes[4];
+    };
+
+    inline Float4 Load(const float* ptr)          { return {ptr[0], ptr[1], ptr[2], ptr[3]}; }
+    inline void   Store(float* ptr, Float4 value) { for (int idx{0}; idx < 4; ++idx) ptr[idx] = value.lanes[idx]; }
+    inline Float4 Splat(float value)              { return {value, value, value, value}; }
+    inline Float4 Add(Float4 a, Float4 b)         { return {a.lanes[0] + b.lanes[0], a.lanes[1] + b.lanes[1], a.lanes[2] + b.lanes[2], a.lanes[3] + b.lanes[3]}; }
+    inline Float4 Sub(Float4 a, Float4 b)         { return {a.lanes[0] - b.lanes[0], a.lanes[1] - b.lanes[1], a.lanes[2] - b.lanes[2], a.lanes[3] - b.lanes[3]}; }
+    inline Float4 Mul(Float4 a, Float4 b)         { return {a.lanes[0] * b.lanes[0], a.lanes[1] * b.lanes[1], a.lanes[2] * b.lanes[2], a.lanes[3] * b.lanes[3]}; }
+    inline Float4 Div(Float4 a, Float4 b)         { return {a.lanes[0] / b.lanes[0], a.lanes[1] / b.lanes[1], a.lanes[2] / b.lanes[2], a.lanes[3] / b.lanes[3]}; }
+    inline Float4 Min(Float4 a, Float4 b)
+    {
+        Float4 result;
+        for (int idx{0}; idx < 4; ++idx) result.lanes[idx] = a.lanes[idx] < b.lanes[idx] ? a.lanes[idx] : b.lanes[idx];
+        return result;
+    }
+    inline Float4 Max(Float4 a, Float4 b)
+    {
+        Float4 result;
+        for (int idx{0}; idx < 4; ++idx) result.lanes[idx] = a.lanes[idx] > b.lanes[idx] ? a.lanes[idx] : b.lanes[idx];
+        return result;
+    }
+    inline void   Prefetch(const void*)           { }
+
+    struct Int4
+    {
+        uint32_t lanes[4];
+    };
+
+    inline Int4 Truncate(Float4 value)
+    {
+        Int4 result;
+        for (int idx{0}; idx < 4; ++idx) result.lanes[idx] = static_cast<uint32_t>(static_cast<int32_t>(value.lanes[idx]));
+        return result;
+    }
+    inline Int4 SplatInt(uint32_t value)                { return {value, value, value, value}; }
+    inline Int4 Or(Int4 a, Int4 b)                      { return {a.lanes[0] | b.lanes[0], a.lanes[1] | b.lanes[1], a.lanes[2] | b.lanes[2], a.lanes[3] | b.lanes[3]}; }
+    template <int Bits> inline Int4 ShiftLeft(Int4 a)   { return {a.lanes[0] << Bits, a.lanes[1] << Bits, a.lanes[2] << Bits, a.lanes[3] << Bits}; }
+    inline void Store(uint32_t* ptr, Int4 value)        { for (int idx{0}; idx < 4; ++idx) ptr[idx] = value.lanes[idx]; }
+    inline void Store(int32_t* ptr, Int4 value)         { for (int idx{0}; idx < 4; ++idx) ptr[idx] = static_cast<int32_t>(value.lanes[idx]); }
+#endif
+}
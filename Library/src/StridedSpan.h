@@ -0,0 +1,70 @@
+#pragma once
+
+// Standard includes
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace dae
+{
+    /**
+     * \brief Non-owning view of count elements that are stride bytes apart,
+     * e.g. every Vertex::position of a vertex array without copying them out first.
+     */
+    template <typename T>
+    class StridedSpan final
+    {
+    public:
+        using Byte = std::conditional_t<std::is_const_v<T>, const std::byte, std::byte>;
+
+        StridedSpan() = default;
+        StridedSpan(T* firstPtr, size_t count, size_t stride = sizeof(T)) :
+            m_FirstPtr{reinterpret_cast<Byte*>(firstPtr)}, m_Count{count}, m_Stride{stride}
+        {
+        }
+
+        // Contiguous elements
+        template <typename U>
+        StridedSpan(std::span<U> elements) :
+            StridedSpan{elements.data(), elements.size()}
+        {
+        }
+
+        // One member of every struct
+        template <typename Struct, typename Owner, typename Member>
+        StridedSpan(std::span<Struct> structs, Member Owner::* member) :
+            m_FirstPtr{structs.empty() ? nullptr : reinterpret_cast<Byte*>(&(structs.front().*member))}, m_Count{structs.size()}, m_Stride{sizeof(Struct)}
+        {
+            static_assert(std::is_same_v<std::remove_const_t<Struct>, Owner>, "StridedSpan: Member of another struct");
+            static_assert(std::is_same_v<std::remove_const_t<T>, Member>, "StridedSpan: Member type does not match");
+        }
+
+        T& operator[](size_t index) const
+        {
+            assert(index < m_Count and "StridedSpan: Index out of range");
+            return *reinterpret_cast<T*>(m_FirstPtr + index * m_Stride);
+        }
+
+        StridedSpan subspan(size_t offset, size_t count) const
+        {
+            assert(offset + count <= m_Count and "StridedSpan: Subspan out of range");
+            return {reinterpret_cast<T*>(m_FirstPtr + offset * m_Stride), count, m_Stride};
+        }
+
+        // Read-only view of the same elements
+        operator StridedSpan<const T>() const
+        {
+            return {reinterpret_cast<const T*>(m_FirstPtr), m_Count, m_Stride};
+        }
+
+        inline size_t size()   const { return m_Count; }
+        inline bool   empty()  const { return m_Count == 0; }
+        inline size_t stride() const { return m_Stride; }
+
+    private:
+        Byte*  m_FirstPtr {nullptr};
+        size_t m_Count    {0};
+        size_t m_Stride   {sizeof(T)};
+    };
+}
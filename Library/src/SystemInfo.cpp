@@ -0,0 +1,119 @@
+#include "SystemInfo.h"
+#include "HardwareCounters.h"
+#include "Profiler.h"
+#include "SIMD.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#include <cstring>
+#include <fstream>
+
+namespace dae
+{
+    namespace SystemInfo
+    {
+        std::string GetCPUModel()
+        {
+            // The brand string is spread over three extended cpuid leaves, 16 characters each
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            int registers[4]{};
+            __cpuid(registers, 0x80000000);
+            if (static_cast<unsigned int>(registers[0]) >= 0x80000004)
+            {
+                char brand[49]{};
+                for (int idx{0}; idx < 3; ++idx)
+                {
+                    __cpuid(registers, 0x80000002 + idx);
+                    std::memcpy(brand + idx * 16, registers, sizeof(registers));
+                }
+                std::string model{brand};
+                model.erase(0, model.find_first_not_of(' '));
+                if (not model.empty()) return model;
+            }
+#elif defined(__x86_64__) || defined(__i386__)
+            unsigned int registers[4]{};
+            if (__get_cpuid(0x80000000, &registers[0], &registers[1], &registers[2], &registers[3]) and registers[0] >= 0x80000004)
+            {
+                char brand[49]{};
+                for (unsigned int idx{0}; idx < 3; ++idx)
+                {
+                    __get_cpuid(0x80000002 + idx, &registers[0], &registers[1], &registers[2], &registers[3]);
+                    std::memcpy(brand + idx * 16, registers, sizeof(registers));
+                }
+                std::string model{brand};
+                model.erase(0, model.find_first_not_of(' '));
+                if (not model.empty()) return model;
+            }
+#endif
+
+#if defined(__linux__)
+            // Other architectures (e.g. ARM) only have it in /proc
+            std::ifstream cpuInfo("/proc/cpuinfo");
+            std::string line{};
+            while (std::getline(cpuInfo, line))
+            {
+                if (line.rfind("model name", 0) != 0) continue;
+
+                const size_t colon{line.find(':')};
+                if (colon != std::string::npos and colon + 2 <= line.size()) return line.substr(colon + 2);
+            }
+#endif
+            return "unknown";
+        }
+
+        std::string GetCompiler()
+        {
+#if defined(__clang__)
+            return "Clang " __clang_version__;
+#elif defined(_MSC_VER)
+            return "MSVC " + std::to_string(_MSC_FULL_VER);
+#elif defined(__GNUC__)
+            return "GCC " __VERSION__;
+#else
+            return "unknown";
+#endif
+        }
+
+        std::string GetBuildFlags()
+        {
+#if defined(NDEBUG)
+            std::string flags{"Release"};
+#else
+            std::string flags{"Debug"};
+#endif
+
+            // Highest vector instruction set the compiler may use on its own
+#if defined(__AVX512F__)
+            flags += " AVX512";
+#elif defined(__AVX2__)
+            flags += " AVX2";
+#elif defined(__AVX__)
+            flags += " AVX";
+#elif defined(__SSE4_1__)
+            flags += " SSE4.1";
+#elif defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+            flags += " SSE2";
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+            flags += " NEON";
+#endif
+
+#if defined(__FAST_MATH__) || (defined(_M_FP_FAST) && _M_FP_FAST)
+            flags += " fast-math";
+#endif
+#if ENABLE_PROFILER
+            flags += " profiler";
+#endif
+#if ENABLE_HARDWARE_COUNTERS
+            flags += " hardware-counters";
+#endif
+#if !ENABLE_SIMD
+            flags += " scalar-math";
+#endif
+            return flags;
+        }
+    }
+}
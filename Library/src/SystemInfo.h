@@ -0,0 +1,18 @@
+#pragma once
+
+// Standard includes
+#include <string>
+
+namespace dae
+{
+    // Where a measurement was taken, so results from different machines and builds are not compared blindly
+    namespace SystemInfo
+    {
+        // CPU brand string, e.g. "AMD Ryzen 7 5800X 8-Core Processor", "unknown" when it can not be queried
+        std::string GetCPUModel();
+        // Compiler and version this library was built with, e.g. "MSVC 1938"
+        std::string GetCompiler();
+        // Configuration and the code generation switches that change performance, e.g. "Release AVX2 profiler"
+        std::string GetBuildFlags();
+    }
+}
@@ -1,36 +1,42 @@
 #include "Texture.h"
+#include "FrameBuffer.h"
+#include "ImageLoader.h"
 #include "Vector2.h"
-#include <SDL_image.h>
 
 #include <algorithm>
-#include <iostream>
+#include <cassert>
 
 namespace dae
 {
-    Texture::Texture(SDL_Surface* pSurface) :
-        m_SurfacePtr{pSurface},
-        m_SurfacePixelsPtr{(uint32_t*)pSurface->pixels}
+    Texture::Texture(int width, int height, std::vector<uint32_t> texels) :
+        m_Width{width},
+        m_Height{height},
+        m_Texels{std::move(texels)}
     {
+        assert(m_Texels.size() == static_cast<size_t>(width) * height and "Texture::Texture: Texel count does not match dimensions");
     }
 
-    Texture::~Texture()
+    /**
+     * \brief Decodes the image with the given loader, the texture only keeps the texels
+     * \param path 
+     * \param imageLoader 
+     * \return nullptr on failure (the loader reports why)
+     */
+    Texture* Texture::LoadFromFile(const std::string& path, const ImageLoader& imageLoader)
     {
-        if (m_SurfacePtr)
+        int width{0};
+        int height{0};
+        std::vector<uint32_t> texels{};
+        if (not imageLoader.Load(path, width, height, texels))
         {
-            SDL_FreeSurface(m_SurfacePtr);
-            m_SurfacePtr = nullptr;
+            return nullptr;
         }
+        return new Texture(width, height, std::move(texels));
     }
 
-    Texture* Texture::LoadFromFile(const std::string& path)
+    Texture* Texture::Create(int width, int height, std::vector<uint32_t> texels)
     {
-        SDL_Surface* pSurface = IMG_Load(path.c_str());
-        if (!pSurface)
-        {
-            std::cout << "Texture::LoadFromFile() failed: " << SDL_GetError() << std::endl;
-            return nullptr;
-        }
-        return new Texture(pSurface);
+        return new Texture(width, height, std::move(texels));
     }
 
     /**
@@ -44,17 +50,20 @@ namespace dae
         float x {std::clamp(uv.x, 0.f, 1.f)};
         float y {std::clamp(uv.y, 0.f, 1.f)};
 
-        // Calculate the index of the pixel
-        x = x * static_cast<float>(m_SurfacePtr->w);
-        y = y * static_cast<float>(m_SurfacePtr->h);
-        const int index{static_cast<int>(y) * m_SurfacePtr->w + static_cast<int>(x)};
+        // Calculate the index of the pixel (uv == 1 would point one past the last texel)
+        x = x * static_cast<float>(m_Width);
+        y = y * static_cast<float>(m_Height);
+        const int px{std::min(static_cast<int>(x), m_Width - 1)};
+        const int py{std::min(static_cast<int>(y), m_Height - 1)};
+        const int index{py * m_Width + px};
 
         // Get the pixel at the index
-        const uint32_t pixel{m_SurfacePixelsPtr[index]};
+        const uint32_t pixel{m_Texels[index]};
 
         // Convert the pixel to a ColorRGB, range [0, 1]
-        uint8_t r, g, b;
-        SDL_GetRGB(pixel, m_SurfacePtr->format, &r, &g, &b);
+        const uint8_t r{FrameBuffer::UnpackR(pixel)};
+        const uint8_t g{FrameBuffer::UnpackG(pixel)};
+        const uint8_t b{FrameBuffer::UnpackB(pixel)};
         return ColorRGB{static_cast<float>(r) / 255.0f, static_cast<float>(g) / 255.0f, static_cast<float>(b) / 255.0f};
     }
 }
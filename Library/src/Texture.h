@@ -1,24 +1,33 @@
 #pragma once
-#include <SDL_surface.h>
+#include <cstdint>
 #include <string>
+#include <vector>
 #include "ColorRGB.h"
 
 namespace dae
 {
+    class ImageLoader;
     struct Vector2;
 
     class Texture
     {
     public:
-        ~Texture();
+        ~Texture() = default;
 
-        static Texture* LoadFromFile(const std::string& path);
+        static Texture* LoadFromFile(const std::string& path, const ImageLoader& imageLoader);
+        static Texture* Create(int width, int height, std::vector<uint32_t> texels);
         ColorRGB Sample(const Vector2& uv) const;
 
+        inline int GetWidth()  const { return m_Width;  }
+        inline int GetHeight() const { return m_Height; }
+
     private:
-        Texture(SDL_Surface* pSurface);
+        Texture(int width, int height, std::vector<uint32_t> texels);
+
+        int m_Width  {0};
+        int m_Height {0};
 
-        SDL_Surface* m_SurfacePtr       {nullptr};
-        uint32_t*    m_SurfacePixelsPtr {nullptr};
+        // RGBA8 (see FrameBuffer::PackColor), row-major, no padding
+        std::vector<uint32_t> m_Texels {};
     };
 }
@@ -0,0 +1,132 @@
+#pragma once
+
+// Standard includes
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace dae
+{
+    /**
+     * \brief One bit per 8x8 tile of a render target, set = "cleared but not written yet".
+     * A clear only sets the bits; the owner fills a tile the first time something touches it (Prepare),
+     * and fills whatever was never touched at the end of the frame (ResolveRemaining) if it needs to.
+     */
+    class TileClearMask final
+    {
+    public:
+        static constexpr int s_TileSize{8};
+
+        TileClearMask(int width, int height) :
+            m_TileCountX{(width  + s_TileSize - 1) / s_TileSize},
+            m_TileCountY{(height + s_TileSize - 1) / s_TileSize},
+            m_Width{width},
+            m_Height{height}
+        {
+            m_Words.resize((static_cast<size_t>(m_TileCountX) * m_TileCountY + 63) / 64);
+        }
+
+        inline void SetAll()
+        {
+            std::fill(m_Words.begin(), m_Words.end(), ~uint64_t{0});
+            // Keep the bits past the last tile zero, ResolveRemaining walks the words blindly
+            const size_t tailBits{static_cast<size_t>(m_TileCountX) * m_TileCountY % 64};
+            if (tailBits != 0) m_Words.back() = (uint64_t{1} << tailBits) - 1;
+        }
+        inline void ResetAll() { std::fill(m_Words.begin(), m_Words.end(), uint64_t{0}); }
+
+        // Only the tiles covering [0, width) x [0, height), e.g. a viewport smaller than the target
+        inline void SetRegion(int width, int height)
+        {
+            if (width >= m_Width and height >= m_Height)
+            {
+                SetAll();
+                return;
+            }
+
+            ResetAll();
+            const int tileCountX{std::min((width  + s_TileSize - 1) / s_TileSize, m_TileCountX)};
+            const int tileCountY{std::min((height + s_TileSize - 1) / s_TileSize, m_TileCountY)};
+            for (int tileY{0}; tileY < tileCountY; ++tileY)
+            {
+                for (int tileX{0}; tileX < tileCountX; ++tileX)
+                {
+                    const size_t tile{static_cast<size_t>(tileX) + static_cast<size_t>(tileY) * m_TileCountX};
+                    m_Words[tile / 64] |= uint64_t{1} << (tile % 64);
+                }
+            }
+        }
+
+        inline bool IsCleared(int tileX, int tileY) const
+        {
+            const size_t tile{static_cast<size_t>(tileX) + static_cast<size_t>(tileY) * m_TileCountX};
+            return (m_Words[tile / 64] >> (tile % 64)) & 1;
+        }
+        inline bool IsPixelCleared(int x, int y) const { return IsCleared(x / s_TileSize, y / s_TileSize); }
+
+        /**
+         * \brief Calls fillTile(beginX, beginY, endX, endY) for every cleared tile overlapping the pixel rectangle
+         * (inclusive, clamped to the target) and marks it as written
+         */
+        template <typename Function>
+        void Prepare(int minX, int minY, int maxX, int maxY, const Function& fillTile)
+        {
+            const int minTileX{std::max(minX, 0) / s_TileSize};
+            const int minTileY{std::max(minY, 0) / s_TileSize};
+            const int maxTileX{std::min(maxX, m_Width  - 1) / s_TileSize};
+            const int maxTileY{std::min(maxY, m_Height - 1) / s_TileSize};
+
+            for (int tileY{minTileY}; tileY <= maxTileY; ++tileY)
+            {
+                for (int tileX{minTileX}; tileX <= maxTileX; ++tileX)
+                {
+                    const size_t tile{static_cast<size_t>(tileX) + static_cast<size_t>(tileY) * m_TileCountX};
+                    uint64_t& word{m_Words[tile / 64]};
+                    const uint64_t bit{uint64_t{1} << (tile % 64)};
+                    if (word & bit)
+                    {
+                        word &= ~bit;
+                        InvokeForTile(fillTile, tileX, tileY);
+                    }
+                }
+            }
+        }
+
+        // Calls fillTile for every tile that is still cleared, a word of written tiles is skipped at once
+        template <typename Function>
+        void ResolveRemaining(const Function& fillTile)
+        {
+            for (size_t wordIdx{0}; wordIdx < m_Words.size(); ++wordIdx)
+            {
+                uint64_t word{m_Words[wordIdx]};
+                while (word != 0)
+                {
+                    const size_t tile{wordIdx * 64 + static_cast<size_t>(std::countr_zero(word))};
+                    word &= word - 1;
+                    InvokeForTile(fillTile, static_cast<int>(tile % m_TileCountX), static_cast<int>(tile / m_TileCountX));
+                }
+                m_Words[wordIdx] = 0;
+            }
+        }
+
+        inline int GetTileCountX() const { return m_TileCountX; }
+        inline int GetTileCountY() const { return m_TileCountY; }
+
+    private:
+        template <typename Function>
+        void InvokeForTile(const Function& fillTile, int tileX, int tileY) const
+        {
+            const int beginX{tileX * s_TileSize};
+            const int beginY{tileY * s_TileSize};
+            fillTile(beginX, beginY, std::min(beginX + s_TileSize, m_Width), std::min(beginY + s_TileSize, m_Height));
+        }
+
+        int m_TileCountX {0};
+        int m_TileCountY {0};
+        int m_Width      {0};
+        int m_Height     {0};
+
+        std::vector<uint64_t> m_Words {};
+    };
+}
@@ -1,22 +1,27 @@
 #include "Timer.h"
 
-#include <fstream>
-#include <iostream>
-#include <numeric>
-
-#include "SDL.h"
+#include <chrono>
 
 namespace dae
 {
+    namespace
+    {
+        // Steady clock ticks, so the timer does not need SDL
+        uint64_t GetPerformanceCounter()
+        {
+            return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        }
+    }
+
     Timer::Timer()
     {
-        const uint64_t countsPerSecond = SDL_GetPerformanceFrequency();
-        m_SecondsPerCount = 1.0f / static_cast<float>(countsPerSecond);
+        using Period = std::chrono::steady_clock::period;
+        m_SecondsPerCount = static_cast<float>(static_cast<double>(Period::num) / static_cast<double>(Period::den));
     }
 
     void Timer::Reset()
     {
-        const uint64_t currentTime = SDL_GetPerformanceCounter();
+        const uint64_t currentTime = GetPerformanceCounter();
 
         m_BaseTime = currentTime;
         m_PreviousTime = currentTime;
@@ -28,7 +33,7 @@ namespace dae
 
     void Timer::Start()
     {
-        const uint64_t startTime = SDL_GetPerformanceCounter();
+        const uint64_t startTime = GetPerformanceCounter();
 
         if (m_IsStopped)
         {
@@ -40,29 +45,6 @@ namespace dae
         }
     }
 
-    void Timer::StartBenchmark(int numFrames)
-    {
-        if (m_BenchmarkActive)
-        {
-            std::cout << "(Benchmark already running)";
-            return;
-        }
-
-        m_BenchmarkActive = true;
-
-        m_BenchmarkAvg = 0.f;
-        m_BenchmarkHigh = FLT_MIN;
-        m_BenchmarkLow = FLT_MAX;
-
-        m_BenchmarkFrames = numFrames;
-        m_BenchmarkCurrFrame = 0;
-
-        m_Benchmarks.clear();
-        m_Benchmarks.resize(m_BenchmarkFrames);
-
-        std::cout << "**BENCHMARK STARTED**\n";
-    }
-
     void Timer::Update()
     {
         if (m_IsStopped)
@@ -73,7 +55,7 @@ namespace dae
             return;
         }
 
-        const uint64_t currentTime = SDL_GetPerformanceCounter();
+        const uint64_t currentTime = GetPerformanceCounter();
         m_CurrentTime = currentTime;
 
         m_ElapsedTime = (float)((m_CurrentTime - m_PreviousTime) * m_SecondsPerCount);
@@ -98,36 +80,6 @@ namespace dae
             m_FPS = m_FPSCount;
             m_FPSCount = 0;
             m_FPSTimer = 0.0f;
-
-            if (m_BenchmarkActive)
-            {
-                m_Benchmarks[m_BenchmarkCurrFrame] = m_dFPS;
-
-                m_BenchmarkLow = std::min(m_BenchmarkLow, m_dFPS);
-                m_BenchmarkHigh = std::max(m_BenchmarkHigh, m_dFPS);
-
-                ++m_BenchmarkCurrFrame;
-                if (m_BenchmarkCurrFrame >= m_BenchmarkFrames)
-                {
-                    m_BenchmarkActive = false;
-                    m_BenchmarkAvg = std::accumulate(m_Benchmarks.begin(), m_Benchmarks.end(), 0.f) / float(
-                        m_BenchmarkFrames);
-
-                    //print
-                    std::cout << "**BENCHMARK FINISHED**\n";
-                    std::cout << ">> HIGH = " << m_BenchmarkHigh << std::endl;
-                    std::cout << ">> LOW = " << m_BenchmarkLow << std::endl;
-                    std::cout << ">> AVG = " << m_BenchmarkAvg << std::endl;
-
-                    //file save
-                    std::ofstream fileStream("benchmark.txt");
-                    fileStream << "FRAMES = " << m_BenchmarkCurrFrame << std::endl;
-                    fileStream << "HIGH = " << m_BenchmarkHigh << std::endl;
-                    fileStream << "LOW = " << m_BenchmarkLow << std::endl;
-                    fileStream << "AVG = " << m_BenchmarkAvg << std::endl;
-                    fileStream.close();
-                }
-            }
         }
     }
 
@@ -135,7 +87,7 @@ namespace dae
     {
         if (!m_IsStopped)
         {
-            const uint64_t currentTime = SDL_GetPerformanceCounter();
+            const uint64_t currentTime = GetPerformanceCounter();
 
             m_StopTime = currentTime;
             m_IsStopped = true;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cassert>
+#include <cmath>
 #include <unordered_map>
 
 namespace dae
@@ -10,8 +12,8 @@ namespace dae
         float y{};
 
         Vector2() = default;
-        Vector2(float _x, float _y);
-        Vector2(const Vector2& from, const Vector2& to);
+        constexpr Vector2(float _x, float _y) : x(_x), y(_y) { }
+        constexpr Vector2(const Vector2& from, const Vector2& to) : x(to.x - from.x), y(to.y - from.y) { }
 
         struct Hash
         {
@@ -24,40 +26,144 @@ namespace dae
                 return hashX ^ (hashY + 0x9e3779b9 + (hashX << 6) + (hashX >> 2));
             }
         };
-        
-        float Magnitude() const;
-        float SqrMagnitude() const;
-        float Normalize();
-        Vector2 Normalized() const;
-
-        static float Dot(const Vector2& v1, const Vector2& v2);
-        static float Cross(const Vector2& v1, const Vector2& v2);
-
-        //Member Operators
-        Vector2 operator*(float scale) const;
-        Vector2 operator/(float scale) const;
-        Vector2 operator+(const Vector2& v) const;
-        Vector2 operator-(const Vector2& v) const;
-        Vector2 operator-() const;
-        //Vector2& operator-();
-        Vector2& operator+=(const Vector2& v);
-        Vector2& operator-=(const Vector2& v);
-        Vector2& operator/=(float scale);
-        Vector2& operator*=(float scale);
-        float& operator[](int index);
-        float operator[](int index) const;
-
-        bool operator==(const Vector2& v) const;
-        bool operator<(const Vector2& v) const;
+
+        float Magnitude() const
+        {
+            return sqrtf(x * x + y * y);
+        }
+
+        constexpr float SqrMagnitude() const
+        {
+            return x * x + y * y;
+        }
+
+        float Normalize()
+        {
+            const float m = Magnitude();
+            x /= m;
+            y /= m;
+
+            return m;
+        }
+
+        Vector2 Normalized() const
+        {
+            const float m = Magnitude();
+            return {x / m, y / m};
+        }
+
+        static constexpr float Dot(const Vector2& v1, const Vector2& v2)
+        {
+            return v1.x * v2.x + v1.y * v2.y;
+        }
+
+        static constexpr float Cross(const Vector2& v1, const Vector2& v2)
+        {
+            return v1.x * v2.y - v1.y * v2.x;
+        }
+
+#pragma region Vector2 (Member) Operators
+        constexpr Vector2 operator*(float scale) const
+        {
+            return {x * scale, y * scale};
+        }
+
+        constexpr Vector2 operator/(float scale) const
+        {
+            return {x / scale, y / scale};
+        }
+
+        constexpr Vector2 operator+(const Vector2& v) const
+        {
+            return {x + v.x, y + v.y};
+        }
+
+        constexpr Vector2 operator-(const Vector2& v) const
+        {
+            return {x - v.x, y - v.y};
+        }
+
+        constexpr Vector2 operator-() const
+        {
+            return {-x, -y};
+        }
+
+        constexpr Vector2& operator+=(const Vector2& v)
+        {
+            x += v.x;
+            y += v.y;
+            return *this;
+        }
+
+        constexpr Vector2& operator-=(const Vector2& v)
+        {
+            x -= v.x;
+            y -= v.y;
+            return *this;
+        }
+
+        constexpr Vector2& operator/=(float scale)
+        {
+            x /= scale;
+            y /= scale;
+            return *this;
+        }
+
+        constexpr Vector2& operator*=(float scale)
+        {
+            x *= scale;
+            y *= scale;
+            return *this;
+        }
+
+        constexpr float& operator[](int index)
+        {
+            assert(index <= 1 && index >= 0);
+            return index == 0 ? x : y;
+        }
+
+        constexpr float operator[](int index) const
+        {
+            assert(index <= 1 && index >= 0);
+            return index == 0 ? x : y;
+        }
+
+        // Below, they need AreEqual from MathHelpers.h
+        constexpr bool operator==(const Vector2& v) const;
+        constexpr bool operator<(const Vector2& v) const;
+#pragma endregion
 
         static const Vector2 UnitX;
         static const Vector2 UnitY;
         static const Vector2 Zero;
     };
 
+    // The struct is incomplete where the constants are declared, they are defined here
+    inline constexpr Vector2 Vector2::UnitX{1, 0};
+    inline constexpr Vector2 Vector2::UnitY{0, 1};
+    inline constexpr Vector2 Vector2::Zero{0, 0};
+
     //Global Operators
-    inline Vector2 operator*(float scale, const Vector2& v)
+    constexpr Vector2 operator*(float scale, const Vector2& v)
     {
         return {v.x * scale, v.y * scale};
     }
 }
+
+// MathHelpers.h includes this header after its scalar helpers, AreEqual is declared either way
+#include "MathHelpers.h"
+
+namespace dae
+{
+    constexpr bool Vector2::operator==(const Vector2& v) const
+    {
+        return AreEqual(x, v.x) && AreEqual(y, v.y);
+    }
+
+    constexpr bool Vector2::operator<(const Vector2& v) const
+    {
+        if (AreEqual(x, v.x))
+            return y < v.y;
+        return x < v.x;
+    }
+}
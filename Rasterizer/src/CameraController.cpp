@@ -0,0 +1,95 @@
+// SDL includes
+#include <SDL_keyboard.h>
+#include <SDL_mouse.h>
+
+// ImGui includes
+#include "imgui.h"
+
+// Project includes
+#include "CameraController.h"
+#include "Camera.h"
+
+namespace dae
+{
+    void CameraController::Update(Camera& camera, float deltaTime) const
+    {
+        Vector3 origin{camera.GetPosition()};
+        float   pitch{camera.GetTotalPitch()};
+        float   yaw{camera.GetTotalYaw()};
+        bool    isMoved{false};
+
+        //Keyboard Input
+        const uint8_t* pKeyboardState = SDL_GetKeyboardState(nullptr);
+        if (pKeyboardState[SDL_SCANCODE_A])
+        {
+            origin -= camera.GetRight() * deltaTime * m_Speed;
+            isMoved = true;
+        }
+        else if (pKeyboardState[SDL_SCANCODE_D])
+        {
+            origin += camera.GetRight() * deltaTime * m_Speed;
+            isMoved = true;
+        }
+        if (pKeyboardState[SDL_SCANCODE_W])
+        {
+            origin += camera.GetForward() * deltaTime * m_Speed;
+            isMoved = true;
+        }
+        else if (pKeyboardState[SDL_SCANCODE_S])
+        {
+            origin -= camera.GetForward() * deltaTime * m_Speed;
+            isMoved = true;
+        }
+
+        //Mouse Input, not while the mouse is over an ImGui window
+        if (not ImGui::GetIO().WantCaptureMouse)
+        {
+            int mouseX{}, mouseY{};
+            const int threshold{1};
+
+            const uint32_t mouseState = SDL_GetRelativeMouseState(&mouseX, &mouseY);
+
+            mouseX = mouseX > threshold ? 1 : mouseX < -threshold ? -1 : 0;
+            mouseY = mouseY > threshold ? 1 : mouseY < -threshold ? -1 : 0;
+
+            const bool leftMouseButtonDown  = mouseState & SDL_BUTTON(SDL_BUTTON_LEFT);
+            const bool rightMouseButtonDown = mouseState & SDL_BUTTON(SDL_BUTTON_RIGHT);
+
+            if (leftMouseButtonDown and rightMouseButtonDown)
+            {
+                origin += camera.GetUp() * static_cast<float>(mouseY * -1) * deltaTime * m_Speed;
+            }
+            else if (leftMouseButtonDown)
+            {
+                origin += camera.GetForward() * static_cast<float>(mouseY * -1) * deltaTime * m_Speed;
+                yaw += static_cast<float>(mouseX) * m_RotationSpeed * deltaTime;
+            }
+            else if (rightMouseButtonDown)
+            {
+                yaw += static_cast<float>(mouseX) * m_RotationSpeed * deltaTime;
+                pitch += static_cast<float>(mouseY * -1) * m_RotationSpeed * deltaTime;
+            }
+            // Every mouse branch above only moves or turns with a non-zero mouse delta
+            isMoved = isMoved or mouseX or mouseY;
+        }
+
+        // A camera that did not move keeps its cached matrices
+        if (isMoved)
+        {
+            camera.SetPose(origin, pitch, yaw);
+        }
+        camera.UpdateMatrices();
+    }
+
+    void CameraController::Scroll(Camera& camera, int wheelY) const
+    {
+        // Check whether the mouse is over the ImGui window
+        if (ImGui::GetIO().WantCaptureMouse or wheelY == 0)
+        {
+            return;
+        }
+
+        const float distance{wheelY > 0 ? m_ScrollSpeed : -m_ScrollSpeed};
+        camera.SetPose(camera.GetPosition() + camera.GetForward() * distance, camera.GetTotalPitch(), camera.GetTotalYaw());
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+namespace dae
+{
+    // Forward Declarations
+    class Camera;
+
+    /**
+     * \brief Windowed input: turns SDL keyboard and mouse state into Camera::SetPose calls.
+     * WASD moves, left mouse button moves forward and turns, right looks around, both move up and down.
+     */
+    class CameraController final
+    {
+    public:
+        CameraController() = default;
+        ~CameraController() = default;
+
+        CameraController(const CameraController&)                = delete;
+        CameraController(CameraController&&) noexcept            = delete;
+        CameraController& operator=(const CameraController&)     = delete;
+        CameraController& operator=(CameraController&&) noexcept = delete;
+
+        // Once per frame, also brings the camera's matrices up to date
+        void Update(Camera& camera, float deltaTime) const;
+        void Scroll(Camera& camera, int wheelY) const;
+
+    private:
+        float m_Speed         {20.0f};
+        float m_RotationSpeed {100.0f};
+        float m_ScrollSpeed   {5.0f};
+    };
+}
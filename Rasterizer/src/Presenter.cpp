@@ -0,0 +1,110 @@
+// SDL includes
+#include "SDL.h"
+
+// ImGui includes
+#include "imgui.h"
+#include "imgui_impl_sdlrenderer2.h"
+
+// Standard includes
+#include <cassert>
+#include <cstring>
+#include <iostream>
+
+// Project includes
+#include "Presenter.h"
+#include "FrameBuffer.h"
+#include "Profiler.h"
+
+namespace dae
+{
+#pragma region Constructor/Destructor
+    Presenter::Presenter(SDL_Renderer* pRenderer, int width, int height) :
+        m_RendererPtr{pRenderer},
+        m_Width{width},
+        m_Height{height}
+    {
+        // Created once, every frame only locks and fills it
+        m_TexturePtr = SDL_CreateTexture(pRenderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STREAMING, width, height);
+        if (not m_TexturePtr)
+        {
+            std::cout << "Presenter::Presenter() failed: " << SDL_GetError() << std::endl;
+            return;
+        }
+        // A frame rendered below the output resolution is stretched over the window
+        SDL_SetTextureScaleMode(m_TexturePtr, SDL_ScaleModeLinear);
+    }
+
+    Presenter::~Presenter()
+    {
+        SDL_DestroyTexture(m_TexturePtr);
+    }
+#pragma endregion
+
+#pragma region Present
+    void Presenter::Present(const FrameBuffer& frameBuffer, bool withUI) const
+    {
+        PROFILE_SCOPE("Present");
+
+        UploadFrame(frameBuffer);
+
+        // Only the viewport holds this frame's pixels (dynamic resolution), it is upscaled to the whole window
+        const SDL_Rect sourceRect{0, 0, frameBuffer.GetViewportWidth(), frameBuffer.GetViewportHeight()};
+
+        SDL_RenderClear(m_RendererPtr);
+        SDL_RenderCopy(m_RendererPtr, m_TexturePtr, &sourceRect, nullptr);
+
+        if (withUI)
+        {
+            RenderUI();
+        }
+
+        SDL_RenderPresent(m_RendererPtr);
+    }
+#pragma endregion
+
+#pragma region Present helpers
+    /**
+     * \brief Copies the viewport of the frame buffer straight into the locked streaming texture.
+     * No intermediate surface, no format conversion: the frame buffer is already RGBA8.
+     * \param frameBuffer 
+     */
+    void Presenter::UploadFrame(const FrameBuffer& frameBuffer) const
+    {
+        assert(frameBuffer.GetWidth() == m_Width and frameBuffer.GetHeight() == m_Height and "Presenter::UploadFrame: Frame buffer size mismatch");
+
+        const int      viewportWidth{frameBuffer.GetViewportWidth()};
+        const int      viewportHeight{frameBuffer.GetViewportHeight()};
+        const SDL_Rect lockRect{0, 0, viewportWidth, viewportHeight};
+
+        void* texelsPtr{nullptr};
+        int   pitch{0};
+        if (SDL_LockTexture(m_TexturePtr, &lockRect, &texelsPtr, &pitch) != 0) return;
+
+        const uint32_t* sourcePtr{frameBuffer.GetColorBuffer()};
+        const size_t    rowBytes{static_cast<size_t>(viewportWidth) * sizeof(uint32_t)};
+        if (viewportWidth == m_Width and static_cast<size_t>(pitch) == rowBytes)
+        {
+            std::memcpy(texelsPtr, sourcePtr, rowBytes * viewportHeight);
+        }
+        else
+        {
+            auto* destinationPtr = static_cast<uint8_t*>(texelsPtr);
+            for (int y{0}; y < viewportHeight; ++y)
+            {
+                std::memcpy(destinationPtr + static_cast<size_t>(y) * pitch, sourcePtr + static_cast<size_t>(y) * m_Width, rowBytes);
+            }
+        }
+
+        SDL_UnlockTexture(m_TexturePtr);
+    }
+
+    void Presenter::RenderUI() const
+    {
+        // ImGui Rendering
+        ImGui::Render();
+        
+        SDL_RenderSetScale(m_RendererPtr, ImGui::GetIO().DisplayFramebufferScale.x, ImGui::GetIO().DisplayFramebufferScale.y);
+        ImGui_ImplSDLRenderer2_RenderDrawData(ImGui::GetDrawData());
+    }
+#pragma endregion
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+struct SDL_Renderer;
+struct SDL_Texture;
+
+namespace dae
+{
+    // Forward Declarations
+    class FrameBuffer;
+
+    /**
+     * \brief Windowed front-end: uploads a finished frame buffer to the SDL window (+ ImGui on top).
+     * The renderer itself never touches SDL, so it can run headless as well.
+     */
+    class Presenter final
+    {
+    public:
+        Presenter(SDL_Renderer* pRenderer, int width, int height);
+        ~Presenter();
+
+        Presenter(const Presenter&)                = delete;
+        Presenter(Presenter&&) noexcept            = delete;
+        Presenter& operator=(const Presenter&)     = delete;
+        Presenter& operator=(Presenter&&) noexcept = delete;
+
+        void Present(const FrameBuffer& frameBuffer, bool withUI) const;
+
+    private:
+        inline void UploadFrame(const FrameBuffer& frameBuffer) const;
+        inline void RenderUI()                                  const;
+
+        SDL_Renderer* m_RendererPtr {nullptr};
+        // Persistent streaming texture, same pixel format as the frame buffer
+        SDL_Texture*  m_TexturePtr  {nullptr};
+        int           m_Width       {0};
+        int           m_Height      {0};
+    };
+}
@@ -0,0 +1,80 @@
+// Project includes
+#include "RenderThread.h"
+#include "Renderer.h"
+#include "Profiler.h"
+
+namespace dae
+{
+#pragma region Constructor/Destructor
+    RenderThread::RenderThread(Renderer& renderer) :
+        m_Renderer{renderer}
+    {
+        m_Thread = std::thread{&RenderThread::Run, this};
+    }
+
+    RenderThread::~RenderThread()
+    {
+        Wait();
+        {
+            std::lock_guard lock{m_Mutex};
+            m_IsRunning = false;
+        }
+        m_StartCondition.notify_one();
+        m_Thread.join();
+    }
+#pragma endregion
+
+#pragma region Frame
+    /**
+     * \brief Frame boundary: waits for the frame in flight, makes it the front buffer,
+     * snapshots the pending camera/settings and starts rasterizing the next frame
+     * \param elapsedSec 
+     */
+    void RenderThread::Submit(float elapsedSec)
+    {
+        {
+            PROFILE_SCOPE("Wait for render");
+            Wait();
+        }
+
+        // Render thread is idle here, safe to touch the frame state
+        m_Renderer.EndFrame();
+        m_Renderer.BeginFrame(elapsedSec);
+
+        {
+            std::lock_guard lock{m_Mutex};
+            m_HasWork = true;
+        }
+        m_StartCondition.notify_one();
+    }
+
+    void RenderThread::Wait()
+    {
+        std::unique_lock lock{m_Mutex};
+        m_DoneCondition.wait(lock, [this] { return not m_HasWork; });
+    }
+
+    void RenderThread::Run()
+    {
+        PROFILE_THREAD("Render");
+        m_Renderer.InitializeRenderThread();
+
+        while (true)
+        {
+            {
+                std::unique_lock lock{m_Mutex};
+                m_StartCondition.wait(lock, [this] { return m_HasWork or not m_IsRunning; });
+                if (not m_HasWork) return;
+            }
+
+            m_Renderer.RenderFrame();
+
+            {
+                std::lock_guard lock{m_Mutex};
+                m_HasWork = false;
+            }
+            m_DoneCondition.notify_one();
+        }
+    }
+#pragma endregion
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// Standard includes
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace dae
+{
+    // Forward Declarations
+    class Renderer;
+
+    /**
+     * \brief Rasterizes frame N on a dedicated thread while the main thread handles input, ImGui
+     * and presents frame N-1. Camera and settings are handed over at the frame boundary in Submit.
+     */
+    class RenderThread final
+    {
+    public:
+        explicit RenderThread(Renderer& renderer);
+        ~RenderThread();
+
+        RenderThread(const RenderThread&)                = delete;
+        RenderThread(RenderThread&&) noexcept            = delete;
+        RenderThread& operator=(const RenderThread&)     = delete;
+        RenderThread& operator=(RenderThread&&) noexcept = delete;
+
+        void Submit(float elapsedSec);
+        void Wait();
+
+    private:
+        void Run();
+
+        Renderer&               m_Renderer;
+        std::thread             m_Thread         {};
+        std::mutex              m_Mutex          {};
+        std::condition_variable m_StartCondition {};
+        std::condition_variable m_DoneCondition  {};
+        bool                    m_HasWork        {false};
+        bool                    m_IsRunning      {true};
+    };
+}
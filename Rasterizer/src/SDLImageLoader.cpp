@@ -0,0 +1,49 @@
+// SDL includes
+#include <SDL_image.h>
+
+// Standard includes
+#include <cstring>
+#include <iostream>
+
+// Project includes
+#include "SDLImageLoader.h"
+
+namespace dae
+{
+    /**
+     * \brief Decodes the image with SDL_image and copies it into plain memory,
+     * the surfaces are released right away
+     */
+    bool SDLImageLoader::Load(const std::string& path, int& width, int& height, std::vector<uint32_t>& texels) const
+    {
+        SDL_Surface* pSurface = IMG_Load(path.c_str());
+        if (not pSurface)
+        {
+            std::cout << "SDLImageLoader::Load() failed: " << SDL_GetError() << std::endl;
+            return false;
+        }
+
+        // Same layout as the frame buffer (RGBA8 byte order)
+        SDL_Surface* pConverted = SDL_ConvertSurfaceFormat(pSurface, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(pSurface);
+        if (not pConverted)
+        {
+            std::cout << "SDLImageLoader::Load() failed: " << SDL_GetError() << std::endl;
+            return false;
+        }
+
+        texels.resize(static_cast<size_t>(pConverted->w) * pConverted->h);
+        SDL_LockSurface(pConverted);
+        for (int y{0}; y < pConverted->h; ++y)
+        {
+            const auto* pRow = static_cast<const uint8_t*>(pConverted->pixels) + static_cast<size_t>(y) * pConverted->pitch;
+            std::memcpy(&texels[static_cast<size_t>(y) * pConverted->w], pRow, pConverted->w * sizeof(uint32_t));
+        }
+        SDL_UnlockSurface(pConverted);
+
+        width  = pConverted->w;
+        height = pConverted->h;
+        SDL_FreeSurface(pConverted);
+        return true;
+    }
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+// Project includes
+#include "ImageLoader.h"
+
+namespace dae
+{
+    /**
+     * \brief Any format SDL_image can read, converted to RGBA8.
+     * Used by the windowed app, which links SDL anyway.
+     */
+    class SDLImageLoader final : public ImageLoader
+    {
+    public:
+        bool Load(const std::string& path, int& width, int& height, std::vector<uint32_t>& texels) const override;
+    };
+}
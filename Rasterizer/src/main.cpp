@@ -11,11 +11,22 @@
 #include <stdio.h>
 
 //Standard includes
+#include <ctime>
 #include <iostream>
+#include <string>
 
 //Project includes
 #include "Timer.h"
+#include "AllocationTracker.h"
+#include "Benchmark.h"
+#include "CameraController.h"
+#include "FrameCapture.h"
 #include "Renderer.h"
+#include "Presenter.h"
+#include "Profiler.h"
+#include "Recording.h"
+#include "RenderThread.h"
+#include "SDLImageLoader.h"
 
 using namespace dae;
 
@@ -61,8 +72,18 @@ int main(int argc, char* args[])
     }
 
     //Initialize "framework"
-    const auto timerPtr    = new Timer();
-    const auto rendererPtr = new Renderer(windowPtr, SDLRendererPtr);
+    const auto timerPtr     = new Timer();
+    const auto rendererPtr  = new Renderer(width, height, SDLImageLoader{});
+    const auto presenterPtr = new Presenter(SDLRendererPtr, width, height);
+    const auto cameraControllerPtr = new CameraController();
+    const auto renderThreadPtr = new RenderThread(*rendererPtr);
+    const auto benchmarkPtr    = new Benchmark(*rendererPtr);
+    const auto recordingPtr    = new Recording(*rendererPtr);
+    // Screenshots and image sequences are written on the capture thread, a frame is dropped rather than stalling the loop
+    const auto capturePtr      = new FrameCapture(width, height, FrameCapture::Settings{});
+
+    // Trade resolution for raster time when the frame gets too expensive (60 FPS)
+    rendererPtr->SetDynamicResolution(true, 1000.0f / 60.0f);
 
     // Setup Dear ImGui context
     IMGUI_CHECKVERSION();
@@ -78,6 +99,8 @@ int main(int argc, char* args[])
     ImGui_ImplSDL2_InitForSDLRenderer(windowPtr, SDLRendererPtr);
     ImGui_ImplSDLRenderer2_Init(SDLRendererPtr);
 
+    PROFILE_THREAD("Main");
+
     //Start loop
     timerPtr->Start();
 
@@ -101,6 +124,27 @@ int main(int argc, char* args[])
             case SDL_KEYUP:
                 switch (e.key.keysym.scancode)
                 {
+                case SDL_SCANCODE_F1:
+                    if (recordingPtr->IsRecording())
+                    {
+                        if (not recordingPtr->StopRecording("recording.rec"))
+                            std::cout << "Something went wrong. Recording not saved!" << std::endl;
+                    }
+                    else if (not recordingPtr->IsReplaying())
+                    {
+                        recordingPtr->StartRecording();
+                    }
+                    break;
+                case SDL_SCANCODE_F2:
+                    if (recordingPtr->IsReplaying())
+                    {
+                        recordingPtr->StopReplay();
+                    }
+                    else if (not recordingPtr->IsRecording() and not recordingPtr->StartReplay("recording.rec"))
+                    {
+                        std::cout << "Something went wrong. Recording not loaded!" << std::endl;
+                    }
+                    break;
                 case SDL_SCANCODE_F3:
                     rendererPtr->ToggleBoundingBoxVisibility();
                     break;
@@ -120,7 +164,11 @@ int main(int argc, char* args[])
                     rendererPtr->CycleShadingMode();
                     break;
                 case SDL_SCANCODE_F8:
-                    timerPtr->StartBenchmark();
+                    rendererPtr->StartBenchmark();
+                    break;
+                case SDL_SCANCODE_F9:
+                case SDL_SCANCODE_H:
+                    rendererPtr->CycleHeatmap();
                     break;
                 case SDL_SCANCODE_E:
                     rendererPtr->GetCamera().IncreaseFOV();
@@ -134,14 +182,14 @@ int main(int argc, char* args[])
                 }
                 break;
             case SDL_MOUSEWHEEL:
-                rendererPtr->GetCamera().Scroll(e.wheel);
+                cameraControllerPtr->Scroll(rendererPtr->GetCamera(), e.wheel.y);
                 break;
             }
         }
 
         if (rendererPtr->IsBenchmarking())
         {
-            timerPtr->StartBenchmark();
+            benchmarkPtr->Start();
             rendererPtr->StopBenchmark();
         }
 
@@ -151,10 +199,64 @@ int main(int argc, char* args[])
         ImGui::NewFrame();
 
         //--------- Update ---------
-        rendererPtr->Update(timerPtr);
+        // A running benchmark drives the camera and the animation step, not the input and the wall clock
+        float elapsedSec{timerPtr->GetElapsed()};
+        if (benchmarkPtr->IsRunning())
+        {
+            elapsedSec = benchmarkPtr->BeginFrame();
+        }
+        else if (not recordingPtr->IsReplaying())
+        {
+            cameraControllerPtr->Update(rendererPtr->GetCamera(), timerPtr->GetElapsed());
+        }
+        if (rendererPtr->HasUI())
+        {
+            PROFILE_SCOPE("UI");
+            ALLOCATION_SCOPE("UI");
+            rendererPtr->CreateUI();
+        }
+
+        // After the UI: a replay overrides whatever was changed this frame, a recording sees the final values
+        if (recordingPtr->IsReplaying() and not benchmarkPtr->IsRunning())
+        {
+            elapsedSec = recordingPtr->ReplayFrame();
+        }
+        else if (recordingPtr->IsRecording())
+        {
+            recordingPtr->RecordFrame(elapsedSec);
+        }
 
         //--------- Render ---------
-        rendererPtr->Render();
+        // Frame N starts on the render thread, frame N-1 is presented meanwhile
+        renderThreadPtr->Submit(elapsedSec);
+
+        // Submit waited for the previous frame, its timings are final now
+        if (benchmarkPtr->IsRunning() and benchmarkPtr->EndFrame(rendererPtr->GetFrameTimings()))
+        {
+            if (not benchmarkPtr->SaveReport("benchmark.txt"))
+                std::cout << "Something went wrong. Benchmark report not saved!" << std::endl;
+
+            // Per-frame results of every run are kept, to compare them with Headless --compare
+            const std::string resultsPath{"benchmark_" + std::to_string(std::time(nullptr)) + ".json"};
+            if (not benchmarkPtr->SaveReport(resultsPath))
+                std::cout << "Something went wrong. Benchmark results not saved!" << std::endl;
+        }
+
+        // Submit gathered the last frame of a capture
+        if (Profiler::Get().HasCapture())
+        {
+            if (Profiler::Get().SaveChromeTrace("trace.json"))
+                std::cout << "Chrome trace saved!" << std::endl;
+            else
+                std::cout << "Something went wrong. Chrome trace not saved!" << std::endl;
+            Profiler::Get().ClearCapture();
+        }
+
+        //--------- Present ---------
+        {
+            ALLOCATION_SCOPE("Present");
+            presenterPtr->Present(rendererPtr->GetFrameBuffer(), rendererPtr->HasUI());
+        }
 
         //--------- Timer ---------
         timerPtr->Update();
@@ -165,19 +267,30 @@ int main(int argc, char* args[])
             // std::cout << "dFPS: " << timerPtr->GetdFPS() << std::endl;
         }
 
-        //Save screenshot after full render
-        if (rendererPtr->IsTakingScreenshot())
+        //Queue the presented frame for the capture thread
+        if (rendererPtr->IsTakingScreenshot() or rendererPtr->IsCapturingSequence())
         {
-            if (!rendererPtr->SaveBufferToImage())
-                std::cout << "Screenshot saved!" << std::endl;
-            else
-                std::cout << "Something went wrong. Screenshot not saved!" << std::endl;
-            rendererPtr->StopTakingScreenshot();
+            ALLOCATION_SCOPE("Capture");
+            const bool isQueued{capturePtr->Submit(rendererPtr->GetFrameBuffer())};
+            if (rendererPtr->IsTakingScreenshot())
+            {
+                if (isQueued)
+                    std::cout << "Screenshot queued!" << std::endl;
+                else
+                    std::cout << "Capture queue is full. Screenshot dropped!" << std::endl;
+                rendererPtr->StopTakingScreenshot();
+            }
         }
     }
     timerPtr->Stop();
 
     //Shutdown "framework"
+    delete capturePtr;
+    delete recordingPtr;
+    delete benchmarkPtr;
+    delete renderThreadPtr;
+    delete cameraControllerPtr;
+    delete presenterPtr;
     delete rendererPtr;
     delete timerPtr;
 
@@ -0,0 +1,315 @@
+// Project includes
+#include "Benchmark.h"
+#include "FrameStatistics.h"
+#include "SystemInfo.h"
+
+// Standard includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <utility>
+
+namespace dae
+{
+    namespace
+    {
+        struct CameraKey
+        {
+            float   time;
+            Vector3 origin;
+            float   pitch;
+            float   yaw;
+        };
+
+        // Dolly in on the vehicle, swing around it and pull back out, loops every 8 seconds
+        constexpr float s_PathDuration{8.0f};
+        const CameraKey s_CameraPath[]
+        {
+            {0.0f, {  0.0f, 5.0f, -64.0f}, 0.0f,   0.0f},
+            {2.0f, {  0.0f, 5.0f, -40.0f}, 0.0f,   0.0f},
+            {4.0f, {-20.0f, 5.0f, -40.0f}, 0.0f,  25.0f},
+            {6.0f, { 20.0f, 5.0f, -40.0f}, 0.0f, -25.0f},
+            {8.0f, {  0.0f, 5.0f, -64.0f}, 0.0f,   0.0f},
+        };
+
+        struct StageColumn
+        {
+            const char* name;
+            float (*select)(const Renderer::FrameTimings& timings);
+        };
+
+        const StageColumn s_Stages[]
+        {
+            {"frame",   [](const Renderer::FrameTimings& timings) { return timings.update + timings.render; }},
+            {"update",  [](const Renderer::FrameTimings& timings) { return timings.update;  }},
+            {"clear",   [](const Renderer::FrameTimings& timings) { return timings.clear;   }},
+            {"vertex",  [](const Renderer::FrameTimings& timings) { return timings.vertex;  }},
+            {"setup",   [](const Renderer::FrameTimings& timings) { return timings.setup;   }},
+            {"raster",  [](const Renderer::FrameTimings& timings) { return timings.raster;  }},
+            {"resolve", [](const Renderer::FrameTimings& timings) { return timings.resolve; }},
+        };
+    }
+
+    Benchmark::Benchmark(Renderer& renderer) :
+        Benchmark(renderer, Settings{})
+    {
+    }
+
+    Benchmark::Benchmark(Renderer& renderer, const Settings& settings) :
+        m_Renderer{renderer},
+        m_Settings{settings}
+    {
+    }
+
+    /**
+     * \brief Restarts the path and the animation timeline, the next BeginFrame renders the first frame of the run
+     */
+    void Benchmark::Start()
+    {
+        if (m_IsRunning)
+        {
+            std::cout << "(Benchmark already running)\n";
+            return;
+        }
+
+        m_IsRunning       = true;
+        m_SubmittedFrames = 0;
+        m_FinishedFrames  = 0;
+        m_Samples.clear();
+        m_Samples.reserve(m_Settings.measuredFrames);
+        m_PipelineTotals   = {};
+        m_CounterTotals    = {};
+        m_AllocationTotals = {};
+
+        m_WasDynamicResolution = m_Renderer.IsDynamicResolutionEnabled();
+        m_FrameBudgetMs        = m_Renderer.GetFrameBudget();
+        m_Renderer.SetDynamicResolution(false, m_FrameBudgetMs);
+        m_Renderer.ResetTimeline();
+
+        std::cout << "**BENCHMARK STARTED**\n";
+    }
+
+    float Benchmark::BeginFrame()
+    {
+        PoseCamera(static_cast<float>(m_SubmittedFrames) * m_Settings.deltaTime);
+        ++m_SubmittedFrames;
+        return m_Settings.deltaTime;
+    }
+
+    bool Benchmark::EndFrame(const Renderer::FrameTimings& timings)
+    {
+        if (not m_IsRunning) return false;
+
+        // The warm-up also absorbs the frame that was in flight when the run started (pipelined rendering)
+        if (m_FinishedFrames++ < m_Settings.warmUpFrames) return false;
+
+        m_Samples.push_back(timings);
+        m_PipelineTotals += m_Renderer.GetPipelineStats();
+
+        const Renderer::StageCounters& counters{m_Renderer.GetStageCounters()};
+        m_CounterTotals.clear   += counters.clear;
+        m_CounterTotals.vertex  += counters.vertex;
+        m_CounterTotals.setup   += counters.setup;
+        m_CounterTotals.raster  += counters.raster;
+        m_CounterTotals.resolve += counters.resolve;
+
+        const AllocationCounts& allocations{AllocationTracker::GetLastFrame().total};
+        m_AllocationTotals.allocations += allocations.allocations;
+        m_AllocationTotals.bytes       += allocations.bytes;
+        m_AllocationTotals.frees       += allocations.frees;
+        if (static_cast<int>(m_Samples.size()) < m_Settings.measuredFrames) return false;
+
+        m_IsRunning = false;
+        m_Renderer.SetDynamicResolution(m_WasDynamicResolution, m_FrameBudgetMs);
+
+        std::cout << "**BENCHMARK FINISHED**\n";
+        WriteReport(std::cout);
+        return true;
+    }
+
+    void Benchmark::WriteReport(std::ostream& stream) const
+    {
+        const Renderer::ResolutionStats& resolution{m_Renderer.GetResolutionStats()};
+        stream << "SCENE = " << Renderer::GetSceneName() << '\n'
+               << "RENDER PATH = " << m_Renderer.GetRenderPathVariant() << '\n'
+               << "THREADS = " << m_Renderer.GetWorkerCount() << '\n'
+               << "CPU = " << SystemInfo::GetCPUModel() << '\n'
+               << "BUILD = " << SystemInfo::GetCompiler() << ", " << SystemInfo::GetBuildFlags() << '\n'
+               << "FRAMES = " << m_Samples.size() << " (after " << m_Settings.warmUpFrames << " warm-up frames)\n"
+               << "STEP = " << m_Settings.deltaTime << " s\n"
+               << "RESOLUTION = " << resolution.width << "x" << resolution.height << '\n'
+               << std::left << std::setw(10) << "STAGE (ms)" << std::right
+               << std::setw(10) << "MIN" << std::setw(10) << "MEAN" << std::setw(10) << "P50"
+               << std::setw(10) << "P95" << std::setw(10) << "P99" << std::setw(10) << "MAX" << '\n';
+
+        std::vector<double> samples(m_Samples.size());
+        const std::ios_base::fmtflags flags{stream.flags()};
+        stream << std::fixed << std::setprecision(3);
+        for (const StageColumn& stage : s_Stages)
+        {
+            for (size_t idx{0}; idx < m_Samples.size(); ++idx)
+            {
+                samples[idx] = stage.select(m_Samples[idx]);
+            }
+            const SampleSummary summary{Summarize(samples)};
+
+            stream << std::left << std::setw(10) << stage.name << std::right
+                   << std::setw(10) << summary.min << std::setw(10) << summary.mean << std::setw(10) << summary.p50
+                   << std::setw(10) << summary.p95 << std::setw(10) << summary.p99 << std::setw(10) << summary.max << '\n';
+        }
+
+        // The path is fixed, so is the work: the mean is the per-frame count
+        const double frameCount{static_cast<double>(std::max<size_t>(m_Samples.size(), 1))};
+        stream << std::setprecision(1) << "PIPELINE (mean per frame)\n";
+        m_PipelineTotals.ForEach([&stream, frameCount](const char* name, uint64_t value)
+        {
+            stream << std::left << std::setw(28) << name << std::right << std::setw(14) << static_cast<double>(value) / frameCount << '\n';
+        });
+
+        // Should be 0: the measured frames are warmed up
+        stream << "HEAP ALLOCATIONS (mean per frame) = " << static_cast<double>(m_AllocationTotals.allocations) / frameCount
+               << " (" << static_cast<double>(m_AllocationTotals.bytes) / frameCount << " bytes)\n";
+
+        WriteCounters(stream, frameCount);
+        stream.flags(flags);
+    }
+
+    void Benchmark::WriteCounters(std::ostream& stream, double frameCount) const
+    {
+        const HardwareCounters* countersPtr{m_Renderer.GetHardwareCounters()};
+        if (not countersPtr or not countersPtr->IsAvailable())
+        {
+            stream << "HARDWARE COUNTERS = not available";
+            if (countersPtr) stream << " (" << countersPtr->GetStatus() << ")";
+            stream << '\n';
+            return;
+        }
+
+        stream << "HARDWARE COUNTERS (mean per frame, render thread + workers)\n"
+               << std::left << std::setw(10) << "STAGE" << std::right;
+        for (int idx{0}; idx < HardwareCounterValues::s_EventCount; ++idx)
+        {
+            stream << std::setw(16) << HardwareCounters::GetName(static_cast<HardwareEvent>(idx));
+        }
+        stream << std::setw(8) << "IPC" << '\n';
+
+        const std::pair<const char*, const HardwareCounterValues*> stages[]
+        {
+            {"clear",   &m_CounterTotals.clear},
+            {"vertex",  &m_CounterTotals.vertex},
+            {"setup",   &m_CounterTotals.setup},
+            {"raster",  &m_CounterTotals.raster},
+            {"resolve", &m_CounterTotals.resolve},
+        };
+        const bool hasIPC{countersPtr->IsAvailable(HardwareEvent::Cycles) and countersPtr->IsAvailable(HardwareEvent::Instructions)};
+        for (const auto& [name, totalsPtr] : stages)
+        {
+            stream << std::left << std::setw(10) << name << std::right << std::setprecision(0);
+            for (int idx{0}; idx < HardwareCounterValues::s_EventCount; ++idx)
+            {
+                if (countersPtr->IsAvailable(static_cast<HardwareEvent>(idx)))
+                {
+                    stream << std::setw(16) << static_cast<double>(totalsPtr->counts[idx]) / frameCount;
+                }
+                else
+                {
+                    stream << std::setw(16) << "-";
+                }
+            }
+            stream << std::setprecision(2) << std::setw(8);
+            if (hasIPC) stream << totalsPtr->GetIPC();
+            else        stream << "-";
+            stream << '\n';
+        }
+        if (not countersPtr->GetStatus().empty())
+        {
+            stream << "MISSING = " << countersPtr->GetStatus() << '\n';
+        }
+    }
+
+    bool Benchmark::SaveReport(const std::string& path) const
+    {
+        const auto hasExtension = [&path](const std::string& extension)
+        {
+            return path.size() >= extension.size() and path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+        };
+        if (hasExtension(".json") or hasExtension(".csv"))
+        {
+            return CreateResults().Save(path);
+        }
+
+        std::ofstream file(path);
+        if (not file) return false;
+
+        WriteReport(file);
+        return file.good();
+    }
+
+    BenchmarkResults Benchmark::CreateResults() const
+    {
+        std::vector<std::string> metricNames{};
+        for (const StageColumn& stage : s_Stages)
+        {
+            metricNames.emplace_back(stage.name);
+        }
+        BenchmarkResults results{std::move(metricNames)};
+
+        // Local time of the report, the run itself is reproducible
+        const std::time_t now{std::chrono::system_clock::to_time_t(std::chrono::system_clock::now())};
+        std::tm localTime{};
+#if defined(_WIN32)
+        localtime_s(&localTime, &now);
+#else
+        localtime_r(&now, &localTime);
+#endif
+        char date[32]{};
+        std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", &localTime);
+
+        const Renderer::ResolutionStats& resolution{m_Renderer.GetResolutionStats()};
+        results.SetMetadata("scene",         Renderer::GetSceneName());
+        results.SetMetadata("resolution",    std::to_string(resolution.width) + "x" + std::to_string(resolution.height));
+        results.SetMetadata("render_path",   m_Renderer.GetRenderPathVariant());
+        results.SetMetadata("threads",       std::to_string(m_Renderer.GetWorkerCount()));
+        results.SetMetadata("cpu",           SystemInfo::GetCPUModel());
+        results.SetMetadata("compiler",      SystemInfo::GetCompiler());
+        results.SetMetadata("build_flags",   SystemInfo::GetBuildFlags());
+        results.SetMetadata("warmup_frames", std::to_string(m_Settings.warmUpFrames));
+        results.SetMetadata("step",          std::to_string(m_Settings.deltaTime));
+        results.SetMetadata("unit",          "ms");
+        results.SetMetadata("date",          date);
+
+        std::vector<double> values(std::size(s_Stages));
+        for (const Renderer::FrameTimings& timings : m_Samples)
+        {
+            for (size_t idx{0}; idx < values.size(); ++idx)
+            {
+                values[idx] = s_Stages[idx].select(timings);
+            }
+            results.AddFrame(values);
+        }
+        return results;
+    }
+
+    void Benchmark::PoseCamera(float time) const
+    {
+        time = std::fmod(time, s_PathDuration);
+
+        size_t key{0};
+        while (s_CameraPath[key + 1].time < time)
+        {
+            ++key;
+        }
+        const CameraKey& from{s_CameraPath[key]};
+        const CameraKey& to{s_CameraPath[key + 1]};
+        const float factor{(time - from.time) / (to.time - from.time)};
+
+        Camera& camera{m_Renderer.GetCamera()};
+        camera.SetPose(from.origin + (to.origin - from.origin) * factor, Lerpf(from.pitch, to.pitch, factor), Lerpf(from.yaw, to.yaw, factor));
+        camera.UpdateMatrices();
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+// Project includes
+#include "AllocationTracker.h"
+#include "BenchmarkResults.h"
+#include "Renderer.h"
+
+// Standard includes
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace dae
+{
+    /**
+     * \brief Reproducible performance run. The camera follows a fixed path and the animation advances by a fixed
+     * step per frame, so every run renders exactly the same frames whatever the wall clock does.
+     * Every measured frame's stage timings are kept, the report has min/mean/p50/p95/p99/max per stage
+     * and the mean pipeline statistics and hardware counters per frame.
+     * The per-frame timings and the run's context can also be saved as JSON or CSV to compare runs (see BenchmarkComparison).
+     */
+    class Benchmark final
+    {
+    public:
+        struct Settings
+        {
+            int   warmUpFrames   {30};
+            int   measuredFrames {300};
+            float deltaTime      {1.0f / 60.0f};
+        };
+
+        explicit Benchmark(Renderer& renderer);
+        Benchmark(Renderer& renderer, const Settings& settings);
+        ~Benchmark() = default;
+
+        Benchmark(const Benchmark&)                = delete;
+        Benchmark(Benchmark&&) noexcept            = delete;
+        Benchmark& operator=(const Benchmark&)     = delete;
+        Benchmark& operator=(Benchmark&&) noexcept = delete;
+
+        void Start();
+
+        // Poses the camera for the next frame, returns the animation step to render it with
+        float BeginFrame();
+        // Timings of a finished frame, returns true when this frame completed the run
+        bool EndFrame(const Renderer::FrameTimings& timings);
+
+        void WriteReport(std::ostream& stream) const;
+        // .json and .csv get the per-frame results, anything else the text report
+        bool SaveReport(const std::string& path) const;
+        BenchmarkResults CreateResults() const;
+
+        inline bool IsRunning() const { return m_IsRunning; }
+        inline const Settings& GetSettings() const { return m_Settings; }
+        inline const std::vector<Renderer::FrameTimings>& GetSamples() const { return m_Samples; }
+        inline const PipelineStats& GetPipelineTotals() const { return m_PipelineTotals; }
+        inline const Renderer::StageCounters& GetCounterTotals() const { return m_CounterTotals; }
+        inline const AllocationCounts& GetAllocationTotals() const { return m_AllocationTotals; }
+
+    private:
+        void PoseCamera(float time) const;
+        void WriteCounters(std::ostream& stream, double frameCount) const;
+
+        Renderer& m_Renderer;
+        Settings  m_Settings {};
+
+        bool m_IsRunning       {false};
+        int  m_SubmittedFrames {0};
+        int  m_FinishedFrames  {0};
+
+        // Restored when the run is over, the run itself uses a fixed resolution
+        bool  m_WasDynamicResolution {false};
+        float m_FrameBudgetMs        {0.0f};
+
+        std::vector<Renderer::FrameTimings> m_Samples          {};
+        PipelineStats                       m_PipelineTotals   {}; // Sum over the measured frames
+        Renderer::StageCounters             m_CounterTotals    {}; // Sum over the measured frames
+        AllocationCounts                    m_AllocationTotals {}; // Sum over the measured frames
+    };
+}
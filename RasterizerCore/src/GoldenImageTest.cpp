@@ -0,0 +1,169 @@
+// Project includes
+#include "GoldenImageTest.h"
+#include "Image.h"
+
+// Standard includes
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace dae
+{
+    namespace
+    {
+        // Relative to the scene's initial camera, so every scene gets the same kind of views
+        struct CameraPose
+        {
+            const char* name;
+            float       distanceScale; // Origin scaled towards the world origin, the model sits there
+            float       pitch;
+            float       yaw;
+        };
+
+        const CameraPose s_Poses[]
+        {
+            {"initial",     1.0f,   0.0f,  0.0f},
+            {"near",        0.625f, 0.0f,  0.0f},
+            {"near_turned", 0.625f, 5.0f, 20.0f}, // Model partly out of the frustum
+        };
+
+        struct ShadingModeCase
+        {
+            const char*           name;
+            Renderer::ShadingMode shadingMode;
+        };
+
+        // The shading cost heatmap is timed, it is never the same twice
+        const ShadingModeCase s_ShadingModes[]
+        {
+            {"observed_area", Renderer::ShadingMode::ObservedArea},
+            {"diffuse",       Renderer::ShadingMode::Diffuse},
+            {"specular",      Renderer::ShadingMode::Specular},
+            {"combined",      Renderer::ShadingMode::Combined},
+            {"depth_buffer",  Renderer::ShadingMode::DepthBuffer},
+            {"bounding_box",  Renderer::ShadingMode::BoundingBox},
+            {"overdraw",      Renderer::ShadingMode::Overdraw},
+            {"pixel_tests",   Renderer::ShadingMode::PixelTests},
+        };
+    }
+
+    GoldenImageTest::GoldenImageTest(Renderer& renderer, const Settings& settings) :
+        m_Renderer{renderer},
+        m_Settings{settings}
+    {
+    }
+
+    bool GoldenImageTest::Run()
+    {
+        m_Passed  = 0;
+        m_Failed  = 0;
+        m_Blessed = 0;
+
+        // Always the full resolution, whatever the budget asks for
+        m_Renderer.SetDynamicResolution(false, m_Renderer.GetFrameBudget());
+
+        const Vector3 initialOrigin{m_Renderer.GetCamera().GetPosition()};
+        std::cout << "GOLDEN IMAGES: " << Renderer::GetSceneName() << (m_Settings.bless ? " (bless)" : "") << '\n';
+
+        for (const CameraPose& pose : s_Poses)
+        {
+            m_Renderer.GetCamera().SetPose(initialOrigin * pose.distanceScale, pose.pitch, pose.yaw);
+
+            // Only the final vehicle paths have shading modes, the other scenes are one image per pose
+            if (not m_Renderer.HasUI())
+            {
+                RunCase(pose.name);
+                continue;
+            }
+            for (const ShadingModeCase& shadingMode : s_ShadingModes)
+            {
+                m_Renderer.SetShadingMode(shadingMode.shadingMode);
+                RunCase(std::string{pose.name} + "_" + shadingMode.name);
+            }
+        }
+
+        m_Renderer.GetCamera().SetPose(initialOrigin, 0.0f, 0.0f);
+        m_Renderer.SetShadingMode(Renderer::ShadingMode::Combined);
+
+        std::cout << "PASSED = " << m_Passed << ", FAILED = " << m_Failed;
+        if (m_Settings.bless) std::cout << ", BLESSED = " << m_Blessed;
+        std::cout << std::endl;
+        return m_Failed == 0 and (m_Settings.bless ? m_Blessed : m_Passed) > 0;
+    }
+
+    void GoldenImageTest::RunCase(const std::string& name)
+    {
+        // Animation at its start, the same frame every run
+        m_Renderer.ResetTimeline();
+        m_Renderer.UpdateHeadless(0.0f);
+        m_Renderer.Render();
+        m_Renderer.EndFrame();
+        const Image actual{Image::FromFrameBuffer(m_Renderer.GetFrameBuffer())};
+
+        namespace fs = std::filesystem;
+        const fs::path referencePath{fs::path{m_Settings.referenceDirectory} / Renderer::GetSceneName() / (name + ".ppm")};
+
+        if (m_Settings.bless)
+        {
+            std::error_code error{};
+            fs::create_directories(referencePath.parent_path(), error);
+            if (actual.SavePPM(referencePath.string()))
+            {
+                ++m_Blessed;
+                std::cout << "BLESSED " << name << '\n';
+            }
+            else
+            {
+                ++m_Failed;
+                std::cout << "FAILED  " << name << ": could not write " << referencePath.string() << '\n';
+            }
+            return;
+        }
+
+        Image reference{};
+        if (not Image::LoadPPM(referencePath.string(), reference))
+        {
+            // Not skipped: a gate that compares nothing must not pass
+            ++m_Failed;
+            std::cout << "FAILED  " << name << ": no reference at " << referencePath.string() << " (see --bless)\n";
+            return;
+        }
+
+        Image diffImage{};
+        const ImageDiff diff{Image::Compare(actual, reference, m_Settings.tolerance, &diffImage)};
+        const float differentFraction{diff.GetDifferentFraction(reference.GetPixelCount())};
+        const bool isPassed{diff.sizeMatches and differentFraction <= m_Settings.maxDifferentPixels};
+
+        std::cout << (isPassed ? "PASSED  " : "FAILED  ") << name;
+        if (diff.sizeMatches)
+        {
+            std::cout << std::fixed << std::setprecision(3)
+                      << ": max delta " << static_cast<int>(diff.maxChannelDelta)
+                      << ", mean delta " << diff.meanChannelDelta
+                      << ", " << differentFraction * 100.0f << "% different"
+                      << std::defaultfloat << '\n';
+        }
+        else
+        {
+            std::cout << ": " << actual.GetWidth() << "x" << actual.GetHeight()
+                      << " against a " << reference.GetWidth() << "x" << reference.GetHeight() << " reference\n";
+        }
+
+        if (isPassed)
+        {
+            ++m_Passed;
+            return;
+        }
+
+        ++m_Failed;
+        const fs::path outputDirectory{fs::path{m_Settings.outputDirectory} / Renderer::GetSceneName()};
+        std::error_code error{};
+        fs::create_directories(outputDirectory, error);
+        actual.SavePPM((outputDirectory / (name + "_actual.ppm")).string());
+        if (diff.sizeMatches)
+        {
+            diffImage.SavePPM((outputDirectory / (name + "_diff.ppm")).string());
+        }
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+// Project includes
+#include "Renderer.h"
+
+// Standard includes
+#include <cstdint>
+#include <string>
+
+namespace dae
+{
+    /**
+     * \brief Image regression test of the compiled scene (see SceneSelector.h).
+     * Every case is one shading mode at one fixed camera pose with the animation at its start,
+     * rendered and compared against <reference directory>/<scene>/<pose>_<mode>.ppm.
+     * A failing case also writes the frame and a diff image to the output directory.
+     * A missing reference fails its case, so an empty or mistyped directory never passes.
+     *
+     * The references are not part of the repository: they depend on the resolution, the compiler and its
+     * floating point code generation. Bless them once on the machine (or CI image) that runs the test,
+     * from a commit whose output was checked by eye, and keep that directory with the machine:
+     *   Headless --golden GoldenImages --bless
+     * Re-bless after an intended change of the output, never to make a failing run pass.
+     */
+    class GoldenImageTest final
+    {
+    public:
+        struct Settings
+        {
+            std::string referenceDirectory {"GoldenImages"};
+            std::string outputDirectory    {"GoldenImages_Failed"};
+            uint8_t     tolerance          {2};      // Per channel, absorbs rounding differences
+            float       maxDifferentPixels {0.001f}; // Fraction of the frame above the tolerance, absorbs edge pixels
+            bool        bless              {false};
+        };
+
+        GoldenImageTest(Renderer& renderer, const Settings& settings);
+        ~GoldenImageTest() = default;
+
+        GoldenImageTest(const GoldenImageTest&)                = delete;
+        GoldenImageTest(GoldenImageTest&&) noexcept            = delete;
+        GoldenImageTest& operator=(const GoldenImageTest&)     = delete;
+        GoldenImageTest& operator=(GoldenImageTest&&) noexcept = delete;
+
+        // Renders every case, prints one line per case, returns true when none failed and at least one was compared (or blessed)
+        bool Run();
+
+        inline int GetPassed()  const { return m_Passed;  }
+        inline int GetFailed()  const { return m_Failed;  }
+        inline int GetBlessed() const { return m_Blessed; }
+
+    private:
+        void RunCase(const std::string& name);
+
+        Renderer& m_Renderer;
+        Settings  m_Settings {};
+
+        int m_Passed  {0};
+        int m_Failed  {0};
+        int m_Blessed {0};
+    };
+}
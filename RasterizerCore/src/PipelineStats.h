@@ -0,0 +1,76 @@
+#pragma once
+
+// Standard includes
+#include <cstdint>
+
+namespace dae
+{
+    /**
+     * \brief Work done by one frame, like a D3D pipeline statistics query.
+     * Every worker counts into its own copy (cache line aligned, no sharing), the copies are merged after the frame.
+     */
+    struct alignas(64) PipelineStats
+    {
+        uint64_t verticesTransformed     {0};
+        uint64_t trianglesSubmitted      {0};
+        uint64_t trianglesFrustumCulled  {0}; // Entirely in front of the near or behind the far plane, or the whole mesh outside the frustum
+        uint64_t trianglesDegenerate     {0}; // Zero area on screen
+        uint64_t trianglesBackfaceCulled {0};
+        uint64_t trianglesOffScreen      {0}; // Bounding box leaves the viewport
+        uint64_t pixelsTested            {0}; // Bounding box pixels
+        uint64_t pixelsCovered           {0}; // Inside the triangle
+        uint64_t depthTestsPassed        {0};
+        uint64_t pixelsShaded            {0};
+
+        PipelineStats& operator+=(const PipelineStats& other)
+        {
+            for (const Counter& counter : s_Counters)
+            {
+                this->*counter.memberPtr += other.*counter.memberPtr;
+            }
+            return *this;
+        }
+
+        inline uint64_t GetTrianglesCulled() const
+        {
+            return trianglesFrustumCulled + trianglesDegenerate + trianglesBackfaceCulled + trianglesOffScreen;
+        }
+
+        // Depth-test passes per viewport pixel: how often a pixel is written on average
+        inline float GetOverdraw(uint64_t viewportPixels) const
+        {
+            return viewportPixels > 0 ? static_cast<float>(depthTestsPassed) / static_cast<float>(viewportPixels) : 0.0f;
+        }
+
+        // function(const char* name, uint64_t value)
+        template <typename Function>
+        void ForEach(const Function& function) const
+        {
+            for (const Counter& counter : s_Counters)
+            {
+                function(counter.name, this->*counter.memberPtr);
+            }
+        }
+
+    private:
+        struct Counter
+        {
+            const char*              name;
+            uint64_t PipelineStats::* memberPtr;
+        };
+
+        static constexpr Counter s_Counters[]
+        {
+            {"Vertices transformed",      &PipelineStats::verticesTransformed},
+            {"Triangles submitted",       &PipelineStats::trianglesSubmitted},
+            {"Triangles frustum culled",  &PipelineStats::trianglesFrustumCulled},
+            {"Triangles degenerate",      &PipelineStats::trianglesDegenerate},
+            {"Triangles backface culled", &PipelineStats::trianglesBackfaceCulled},
+            {"Triangles off screen",      &PipelineStats::trianglesOffScreen},
+            {"Pixels tested",             &PipelineStats::pixelsTested},
+            {"Pixels covered",            &PipelineStats::pixelsCovered},
+            {"Depth tests passed",        &PipelineStats::depthTestsPassed},
+            {"Pixels shaded",             &PipelineStats::pixelsShaded},
+        };
+    };
+}
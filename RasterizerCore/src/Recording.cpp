@@ -0,0 +1,299 @@
+// Project includes
+#include "Recording.h"
+#include "Renderer.h"
+
+// Standard includes
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+
+namespace dae
+{
+    namespace
+    {
+        // "DAEREC" + format version, a file of another version is refused rather than misread
+        constexpr char     s_Magic[6] {'D', 'A', 'E', 'R', 'E', 'C'};
+        constexpr uint16_t s_Version  {2};
+
+        // Every recorded setting, in file order. Adding one changes the settings size, older files are refused then
+        template <typename Settings, typename Function>
+        void ForEachSetting(Settings& settings, const Function& function)
+        {
+            function(settings.previousShadingMode);
+            function(settings.currentShadingMode);
+            function(settings.useNormalMap);
+            function(settings.rotate);
+            for (auto& value : settings.ambient)         function(value);
+            for (auto& value : settings.lightDirection)  function(value);
+            function(settings.lightIntensity);
+            function(settings.kd);
+            function(settings.shininess);
+            for (auto& value : settings.backgroundColor) function(value);
+            function(settings.depthFormat);
+            function(settings.dynamicResolution);
+            function(settings.frameBudgetMs);
+            function(settings.minResolutionScale);
+            function(settings.toneMapping);
+            function(settings.encodeSRGB);
+            // mathPrecision is not recorded, a replay renders with the precision of the replaying run (exact vs fast on the same frames)
+        }
+
+        template <typename T>
+        void Write(std::ostream& stream, const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        template <typename T>
+        bool Read(std::istream& stream, T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+        }
+    }
+
+    Recording::Recording(Renderer& renderer) :
+        m_Renderer{renderer}
+    {
+    }
+
+    /**
+     * \brief Restarts the animation timeline, the next RecordFrame records the first frame
+     */
+    void Recording::StartRecording()
+    {
+        m_State        = State::Recording;
+        m_CurrentFrame = 0;
+        m_Width        = m_Renderer.m_Width;
+        m_Height       = m_Renderer.m_Height;
+        m_Frames.clear();
+        m_Settings.clear();
+
+        m_Renderer.ResetTimeline();
+        std::cout << "**RECORDING STARTED**\n";
+    }
+
+    void Recording::RecordFrame(float elapsedSec)
+    {
+        if (m_State != State::Recording) return;
+
+        const Camera& camera{m_Renderer.m_PendingCamera};
+
+        Frame frame{};
+        frame.elapsedSec = elapsedSec;
+        frame.origin     = camera.GetPosition();
+        frame.pitch      = camera.GetTotalPitch();
+        frame.yaw        = camera.GetTotalYaw();
+        frame.fovAngle   = camera.GetFOVAngle();
+
+        std::vector<uint8_t> settings{SaveSettings()};
+        if (m_Settings.empty() or settings != m_Settings.back())
+        {
+            frame.settings = static_cast<int32_t>(m_Settings.size());
+            m_Settings.push_back(std::move(settings));
+        }
+
+        m_Frames.push_back(frame);
+        ++m_CurrentFrame;
+    }
+
+    bool Recording::StopRecording(const std::string& path)
+    {
+        if (m_State != State::Recording) return false;
+
+        m_State = State::Idle;
+        std::cout << "**RECORDING STOPPED** (" << m_Frames.size() << " frames)\n";
+        return Save(path);
+    }
+
+    /**
+     * \brief Loads the recording and restarts the animation timeline, the next ReplayFrame applies the first frame
+     */
+    bool Recording::StartReplay(const std::string& path)
+    {
+        if (m_State == State::Recording or not Load(path)) return false;
+
+        if (m_Width != m_Renderer.m_Width or m_Height != m_Renderer.m_Height)
+        {
+            std::cout << "(Recorded at " << m_Width << "x" << m_Height << ", replaying at "
+                      << m_Renderer.m_Width << "x" << m_Renderer.m_Height << ")\n";
+        }
+
+        m_State        = State::Replaying;
+        m_CurrentFrame = 0;
+        m_Renderer.ResetTimeline();
+        std::cout << "**REPLAY STARTED** (" << m_Frames.size() << " frames)\n";
+        return true;
+    }
+
+    float Recording::ReplayFrame()
+    {
+        if (m_State != State::Replaying or m_CurrentFrame >= m_Frames.size()) return 0.0f;
+
+        const Frame& frame{m_Frames[m_CurrentFrame]};
+        if (frame.settings >= 0)
+        {
+            LoadSettings(m_Settings[frame.settings]);
+        }
+
+        Camera& camera{m_Renderer.m_PendingCamera};
+        camera.SetPose(frame.origin, frame.pitch, frame.yaw);
+        camera.SetFOVAngle(frame.fovAngle);
+        camera.UpdateMatrices();
+
+        if (++m_CurrentFrame == m_Frames.size())
+        {
+            StopReplay();
+        }
+        return frame.elapsedSec;
+    }
+
+    void Recording::StopReplay()
+    {
+        if (m_State != State::Replaying) return;
+
+        m_State = State::Idle;
+        std::cout << "**REPLAY FINISHED** (" << m_CurrentFrame << "/" << m_Frames.size() << " frames)\n";
+    }
+
+    /**
+     * \brief Binary, native byte order: header, the settings blobs, then one fixed size record per frame
+     */
+    bool Recording::Save(const std::string& path) const
+    {
+        std::ofstream file(path, std::ios::binary);
+        if (not file) return false;
+
+        file.write(s_Magic, sizeof(s_Magic));
+        Write(file, s_Version);
+        Write(file, static_cast<int32_t>(m_Width));
+        Write(file, static_cast<int32_t>(m_Height));
+
+        const std::string scene{Renderer::GetSceneName()};
+        Write(file, static_cast<uint32_t>(scene.size()));
+        file.write(scene.data(), static_cast<std::streamsize>(scene.size()));
+
+        Write(file, static_cast<uint32_t>(m_Settings.size()));
+        Write(file, static_cast<uint32_t>(m_Settings.empty() ? 0 : m_Settings.front().size()));
+        for (const std::vector<uint8_t>& settings : m_Settings)
+        {
+            file.write(reinterpret_cast<const char*>(settings.data()), static_cast<std::streamsize>(settings.size()));
+        }
+
+        Write(file, static_cast<uint32_t>(m_Frames.size()));
+        for (const Frame& frame : m_Frames)
+        {
+            Write(file, frame.elapsedSec);
+            Write(file, frame.origin.x);
+            Write(file, frame.origin.y);
+            Write(file, frame.origin.z);
+            Write(file, frame.pitch);
+            Write(file, frame.yaw);
+            Write(file, frame.fovAngle);
+            Write(file, frame.settings);
+        }
+
+        return file.good();
+    }
+
+    /**
+     * \brief Leaves the current recording untouched on failure
+     */
+    bool Recording::Load(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (not file) return false;
+
+        char magic[sizeof(s_Magic)]{};
+        uint16_t version{};
+        if (not file.read(magic, sizeof(magic)) or std::memcmp(magic, s_Magic, sizeof(s_Magic)) != 0 or not Read(file, version) or version != s_Version)
+        {
+            std::cout << path << " is not a recording of this version\n";
+            return false;
+        }
+
+        int32_t width{}, height{};
+        uint32_t sceneSize{};
+        if (not Read(file, width) or not Read(file, height) or not Read(file, sceneSize) or sceneSize > 64) return false;
+
+        std::string scene(sceneSize, '\0');
+        if (not file.read(scene.data(), sceneSize)) return false;
+        if (scene != Renderer::GetSceneName())
+        {
+            std::cout << "(Recorded with scene " << scene << ", replaying " << Renderer::GetSceneName() << ")\n";
+        }
+
+        uint32_t settingsCount{}, settingsSize{};
+        if (not Read(file, settingsCount) or not Read(file, settingsSize)) return false;
+        if (settingsCount > 0 and settingsSize != SaveSettings().size())
+        {
+            std::cout << path << " was recorded with other settings, it can not be replayed by this build\n";
+            return false;
+        }
+
+        // Counts are not trusted for allocations, a corrupt file runs out of data instead
+        std::vector<std::vector<uint8_t>> allSettings{};
+        for (uint32_t idx{0}; idx < settingsCount; ++idx)
+        {
+            std::vector<uint8_t>& settings{allSettings.emplace_back(settingsSize)};
+            if (not file.read(reinterpret_cast<char*>(settings.data()), settingsSize)) return false;
+        }
+
+        uint32_t frameCount{};
+        if (not Read(file, frameCount)) return false;
+
+        std::vector<Frame> frames{};
+        for (uint32_t idx{0}; idx < frameCount; ++idx)
+        {
+            Frame frame{};
+            if (not Read(file, frame.elapsedSec) or not Read(file, frame.origin.x) or not Read(file, frame.origin.y) or not Read(file, frame.origin.z)
+                or not Read(file, frame.pitch) or not Read(file, frame.yaw) or not Read(file, frame.fovAngle) or not Read(file, frame.settings))
+            {
+                return false;
+            }
+            if (frame.settings >= static_cast<int32_t>(settingsCount)) return false;
+
+            frames.push_back(frame);
+        }
+
+        m_Width    = width;
+        m_Height   = height;
+        m_Settings = std::move(allSettings);
+        m_Frames   = std::move(frames);
+        return true;
+    }
+
+    std::vector<uint8_t> Recording::SaveSettings() const
+    {
+        std::vector<uint8_t> bytes{};
+        ForEachSetting(m_Renderer.m_PendingSettings, [&bytes](const auto& value)
+        {
+            const auto* valuePtr{reinterpret_cast<const uint8_t*>(&value)};
+            bytes.insert(bytes.end(), valuePtr, valuePtr + sizeof(value));
+        });
+        return bytes;
+    }
+
+    void Recording::LoadSettings(const std::vector<uint8_t>& bytes)
+    {
+        Renderer::Settings& settings{m_Renderer.m_PendingSettings};
+
+        // Dynamic resolution stays as the replaying application set it up
+        const bool  dynamicResolution{settings.dynamicResolution};
+        const float frameBudgetMs{settings.frameBudgetMs};
+        const float minResolutionScale{settings.minResolutionScale};
+
+        size_t offset{0};
+        ForEachSetting(settings, [&bytes, &offset](auto& value)
+        {
+            std::memcpy(&value, bytes.data() + offset, sizeof(value));
+            offset += sizeof(value);
+        });
+
+        settings.dynamicResolution  = dynamicResolution;
+        settings.frameBudgetMs      = frameBudgetMs;
+        settings.minResolutionScale = minResolutionScale;
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+// Project includes
+#include "Maths.h"
+
+// Standard includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dae
+{
+    // Forward Declarations
+    class Renderer;
+
+    /**
+     * \brief Records what every frame is rendered with (animation step, camera pose, FOV, UI settings)
+     * and replays it frame by frame, so a session can be rendered again exactly - also headless.
+     * The animation timeline restarts with both, the model rotation follows from the recorded steps.
+     * Settings are only stored on the frames that changed them. Dynamic resolution is not replayed:
+     * it reacts to the timing of the machine, the replaying application keeps its own.
+     */
+    class Recording final
+    {
+    public:
+        explicit Recording(Renderer& renderer);
+        ~Recording() = default;
+
+        Recording(const Recording&)                = delete;
+        Recording(Recording&&) noexcept            = delete;
+        Recording& operator=(const Recording&)     = delete;
+        Recording& operator=(Recording&&) noexcept = delete;
+
+        void StartRecording();
+        // After input and UI, before the frame is submitted
+        void RecordFrame(float elapsedSec);
+        // Writes the recording, returns false when it could not be saved
+        bool StopRecording(const std::string& path);
+
+        bool StartReplay(const std::string& path);
+        // Poses the camera and applies the settings of the next frame, returns the animation step to render it with
+        float ReplayFrame();
+        void StopReplay();
+
+        inline bool IsRecording() const { return m_State == State::Recording; }
+        inline bool IsReplaying() const { return m_State == State::Replaying; }
+        inline size_t GetFrameCount()  const { return m_Frames.size(); }
+        inline size_t GetCurrentFrame() const { return m_CurrentFrame; }
+
+        bool Save(const std::string& path) const;
+        bool Load(const std::string& path);
+
+    private:
+        enum class State
+        {
+            Idle,
+            Recording,
+            Replaying
+        };
+
+        struct Frame
+        {
+            float   elapsedSec {0.0f};
+            Vector3 origin     {};
+            float   pitch      {0.0f};
+            float   yaw        {0.0f};
+            float   fovAngle   {0.0f};
+            int32_t settings   {-1}; // Index into m_Settings, -1 = unchanged
+        };
+
+        std::vector<uint8_t> SaveSettings() const;
+        void LoadSettings(const std::vector<uint8_t>& bytes);
+
+        Renderer& m_Renderer;
+        State     m_State        {State::Idle};
+        size_t    m_CurrentFrame {0};
+
+        int m_Width  {0}; // Frame buffer size while recording
+        int m_Height {0};
+
+        std::vector<Frame>                m_Frames   {};
+        std::vector<std::vector<uint8_t>> m_Settings {};
+    };
+}
@@ -1,23 +1,51 @@
-// SDL includes
-#include "SDL.h"
-#include "SDL_surface.h"
-
 // ImGui includes
 #include "imgui.h"
-#include "imgui_impl_sdlrenderer2.h"
 
 // Project includes
 #include "Renderer.h"
+#include "AllocationTracker.h"
+#include "DynamicResolution.h"
+#include "FrameArena.h"
+#include "FastMath.h"
+#include "FrameBuffer.h"
+#include "Heatmap.h"
+#include "JobSystem.h"
 #include "Maths.h"
+#include "Profiler.h"
 #include "Texture.h"
 #include "Utils.h"
 #include "SceneSelector.h"
 
 // Standard includes
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <span>
+#include <utility>
 
 namespace dae
 {
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        float MillisecondsSince(Clock::time_point start)
+        {
+            return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+        }
+
+        // Same zone, same color in every frame
+        ImU32 GetZoneColor(const char* name)
+        {
+            uint32_t hash{2166136261u};
+            for (const char* characterPtr{name}; *characterPtr; ++characterPtr)
+            {
+                hash = (hash ^ static_cast<uint8_t>(*characterPtr)) * 16777619u;
+            }
+            return ImColor::HSV(static_cast<float>(hash % 360) / 360.0f, 0.55f, 0.75f);
+        }
+    }
+
 #pragma region Global Variables
     const std::vector<Vertex> triangle_vertices_ndc
     {
@@ -97,51 +125,79 @@ namespace dae
             PrimitiveTopology::TriangleStrip
         }
     };
-
-    // SS = Screen Space
-    std::vector<Vertex>     vertices_ss                   {};
-    std::vector<Vertex_Out> vertices_ss_out               {};
-    std::vector<Mesh>       meshes_world_list_transformed {};
-
-    std::array<float, 3> weights{};
 #pragma endregion
 
 #pragma region Constructor/Destructor
-    Renderer::Renderer(SDL_Window* pWindow) :
-        m_WindowPtr(pWindow)
+    Renderer::Renderer(int width, int height, const ImageLoader& imageLoader) :
+        m_Width{width},
+        m_Height{height}
     {
         // Initialize 
-        SDL_GetWindowSize(pWindow, &m_Width, &m_Height);
         m_HalfWidth  = m_Width * 0.5f;
         m_HalfHeight = m_Height * 0.5f;
+        m_ViewportWidth      = m_Width;
+        m_ViewportHeight     = m_Height;
+        m_ViewportHalfWidth  = m_HalfWidth;
+        m_ViewportHalfHeight = m_HalfHeight;
+        m_ResolutionStats.width  = m_Width;
+        m_ResolutionStats.height = m_Height;
 
         // Create Buffers
-        m_FrontBufferPtr      = SDL_GetWindowSurface(pWindow);
-        m_BackBufferPtr       = SDL_CreateRGBSurface(0, m_Width, m_Height, 32, 0, 0, 0, 0);
-        m_BackBufferPixelsPtr = (uint32_t*)m_BackBufferPtr->pixels;
+        m_FrameBufferPtrs[0]   = new FrameBuffer(m_Width, m_Height);
+        m_FrameBufferPtrs[1]   = new FrameBuffer(m_Width, m_Height);
+        m_FrameBufferPtr       = m_FrameBufferPtrs[1 - m_FrontBufferIndex];
+        m_BackBufferPixelsPtr  = m_FrameBufferPtr->GetColorBuffer();
+        m_DepthBufferPixelsPtr = m_FrameBufferPtr->GetDepthBuffer();
 
-        // m_pDepthBufferPixels = new float[m_Width * m_Height];
-        m_DepthBuffer.resize(m_Width * m_Height);
+        m_DepthBufferPtr = new DepthBuffer(m_Width, m_Height);
+        m_HdrBufferPtr   = new HdrBuffer(m_Width, m_Height);
+        m_HeatmapPtr     = new Heatmap(m_Width, m_Height);
+
+        m_DynamicResolutionPtr = new DynamicResolution(m_Width, m_Height);
+
+        const uint32_t workerThreadCount{JobSystem::GetDefaultWorkerThreadCount()};
+        m_HardwareCountersPtrs.resize(workerThreadCount + 1, nullptr);
+        m_JobSystemPtr = new JobSystem(workerThreadCount, false, 64 * 1024, [this](uint32_t workerIndex)
+        {
+            m_HardwareCountersPtrs[workerIndex] = new HardwareCounters();
+        });
+        m_WorkerStats.resize(m_JobSystemPtr->GetWorkerCount());
+        assert(m_JobSystemPtr->GetScratchSize() >= s_SetupBatchSize * sizeof(TriangleSetup) and "Renderer::Renderer: Scratch memory can't hold a setup batch");
 
         // General initialization
         InitializeCamera();
         InitializeOutputVertices();
-        InitializeTextures();
+        InitializeTextures(imageLoader);
         m_Transform = Matrix::CreateTranslation(m_Translation);
 
+        // Stealing can hand every setup batch to the same worker, so each sub-arena fits the setup of the whole mesh
+        size_t triangleCount{0};
+        for (const Mesh& mesh : m_MeshesWorldListTransformed)
+        {
+            triangleCount = std::max(triangleCount, mesh.indices.size() / 3);
+        }
+        const size_t workerCapacity{std::max<size_t>(64 * 1024, triangleCount * sizeof(TriangleSetup) + (triangleCount / s_SetupBatchSize + 1) * alignof(TriangleSetup))};
+        m_FrameArenaPtr = new FrameArena(m_JobSystemPtr->GetWorkerCount(), 1024 * 1024, workerCapacity);
+
         // --- ASSERTS ---
         assert(not meshes_world_list.empty() and "Meshes list is empty");
         assert(not meshes_world_strip.empty() and "Meshes strip is empty");
     }
 
-    Renderer::Renderer(SDL_Window* pWindow, SDL_Renderer* pRenderer)
-        : Renderer(pWindow)
-    {
-        m_RendererPtr = pRenderer;
-    }
-
     Renderer::~Renderer()
     {
+        for (const HardwareCounters* countersPtr : m_HardwareCountersPtrs)
+        {
+            delete countersPtr;
+        }
+        delete m_FrameArenaPtr;
+        delete m_JobSystemPtr;
+        delete m_DepthBufferPtr;
+        delete m_HdrBufferPtr;
+        delete m_HeatmapPtr;
+        delete m_DynamicResolutionPtr;
+        delete m_FrameBufferPtrs[0];
+        delete m_FrameBufferPtrs[1];
         delete m_TexturePtr;
 
         // Vehicle
@@ -153,44 +209,136 @@ namespace dae
 #pragma endregion
 
 #pragma region Update/Render
-    void Renderer::Update(Timer* pTimer)
+    /**
+     * \brief Opens the hardware counters of the calling thread, the workers already opened theirs.
+     * It has to be the thread that calls Render: the counters only count the thread that opened them
+     */
+    void Renderer::InitializeRenderThread()
+    {
+        assert(not m_HardwareCountersPtrs[0] and "Renderer::InitializeRenderThread: Already initialized");
+        m_HardwareCountersPtrs[0] = new HardwareCounters();
+    }
+
+    /**
+     * \brief Single threaded frame setup without input: snapshot, animate, ready to Render()
+     * \param elapsedSec 
+     */
+    void Renderer::UpdateHeadless(float elapsedSec)
+    {
+        m_PendingCamera.UpdateMatrices();
+        BeginFrame(elapsedSec);
+
+        PROFILE_SCOPE("Update");
+
+        ALLOCATION_SCOPE("Update");
+        const auto updateStart{Clock::now()};
+        UpdateMeshes(m_FrameElapsedSec);
+        m_FrameTimings.update = MillisecondsSince(updateStart);
+    }
+
+    /**
+     * \brief Frame boundary, called while no frame is being rendered.
+     * Hands the pending camera/settings over to the frame that is about to be rendered.
+     * \param elapsedSec 
+     */
+    void Renderer::BeginFrame(float elapsedSec)
+    {
+        m_Camera          = m_PendingCamera;
+        m_Settings        = m_PendingSettings;
+        m_FrameElapsedSec = elapsedSec;
+
+        if (m_PendingTimelineReset)
+        {
+            m_AccTime              = 0.0f;
+            m_PendingTimelineReset = false;
+        }
+    }
+
+    /**
+     * \brief Render thread: only reads the frame copies and writes the back buffer
+     */
+    void Renderer::RenderFrame()
+    {
+        {
+            PROFILE_SCOPE("Update");
+            ALLOCATION_SCOPE("Update");
+            const auto updateStart{Clock::now()};
+            UpdateMeshes(m_FrameElapsedSec);
+            m_FrameTimings.update = MillisecondsSince(updateStart);
+        }
+
+        Render();
+    }
+
+    /**
+     * \brief Frame boundary, called while no frame is being rendered.
+     * The finished back buffer becomes the front buffer (GetFrameBuffer), the old front buffer is reused.
+     */
+    void Renderer::EndFrame()
+    {
+        m_FrontBufferIndex     = 1 - m_FrontBufferIndex;
+        m_FrameBufferPtr       = m_FrameBufferPtrs[1 - m_FrontBufferIndex];
+        m_BackBufferPixelsPtr  = m_FrameBufferPtr->GetColorBuffer();
+        m_DepthBufferPixelsPtr = m_FrameBufferPtr->GetDepthBuffer();
+
+        m_ResolutionStats.scale    = m_DynamicResolutionPtr->GetScale();
+        m_ResolutionStats.width    = m_ViewportWidth;
+        m_ResolutionStats.height   = m_ViewportHeight;
+        m_ResolutionStats.rasterMs = m_FrameTimings.render;
+
+        m_LastFrameTimings  = m_FrameTimings;
+        m_LastPipelineStats = m_PipelineStats;
+        m_LastHeatMax       = m_HeatMax;
+
+        // Only the final vehicle path samples the stages
+        m_LastStageCounters       = m_StageCounters;
+        m_LastHardwareCountersPtr = W4 and TODO_7 ? m_HardwareCountersPtrs[0] : nullptr;
+
+        // Workers and render thread are idle, their zones and allocations can be gathered
+        Profiler::Get().EndFrame();
+        AllocationTracker::EndFrame();
+        if (m_RenderedFrames > s_WarmUpFrames)
+        {
+            m_SteadyStateHeapAllocations += AllocationTracker::GetLastFrame().total.allocations;
+        }
+    }
+
+    void Renderer::UpdateMeshes(float elapsedSec)
     {
-        m_Camera.Update(pTimer);
-        
         // --- WEEK 3 ---
 #if W3
 #if TODO_4
-        if (not m_Rotate) return;
+        if (not m_Settings.rotate) return;
         
-        m_AccTime += pTimer->GetElapsed();
+        m_AccTime += elapsedSec;
         const float yaw{m_RotationAngleDeg * TO_RADIANS * m_RotationSpeed * m_AccTime};
         const auto rotMatrix{Matrix::CreateRotationY(yaw)};
         
         for (size_t idx{0}; idx < meshes_world_list[0].vertices.size(); ++idx)
         {
-            meshes_world_list_transformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
+            m_MeshesWorldListTransformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
         }
 #elif TODO_5
-        if (not m_Rotate) return;
+        if (not m_Settings.rotate) return;
         
-        m_AccTime += pTimer->GetElapsed();
+        m_AccTime += elapsedSec;
         const float yaw{m_RotationAngleDeg * TO_RADIANS * m_RotationSpeed * m_AccTime};
         const auto rotMatrix{Matrix::CreateRotationY(yaw)};
         
         for (size_t idx{0}; idx < meshes_world_list[0].vertices.size(); ++idx)
         {
-            meshes_world_list_transformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
+            m_MeshesWorldListTransformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
         }
 #elif TODO_6
-        if (not m_Rotate) return;
+        if (not m_Settings.rotate) return;
         
-        m_AccTime += pTimer->GetElapsed();
+        m_AccTime += elapsedSec;
         const float yaw{m_RotationAngleDeg * TO_RADIANS * m_RotationSpeed * m_AccTime};
         const auto rotMatrix{Matrix::CreateRotationY(yaw)};
         
         for (size_t idx{0}; idx < meshes_world_list[0].vertices.size(); ++idx)
         {
-            meshes_world_list_transformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
+            m_MeshesWorldListTransformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
         }
 #endif
 #endif
@@ -198,255 +346,234 @@ namespace dae
         // --- WEEK 4 ---
 #if W4
 #if TODO_0
-        if (not m_Rotate) return;
+        if (not m_Settings.rotate) return;
         
-        m_AccTime += pTimer->GetElapsed();
+        m_AccTime += elapsedSec;
         const float yaw{m_RotationAngleDeg * TO_RADIANS * m_RotationSpeed * m_AccTime};
         const auto rotMatrix{Matrix::CreateRotationY(yaw)};
         
         for (size_t idx{0}; idx < meshes_world_list[0].vertices.size(); ++idx)
         {
-            meshes_world_list_transformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
+            m_MeshesWorldListTransformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
         }
 #elif TODO_1
-        if (not m_Rotate) return;
+        if (not m_Settings.rotate) return;
         
-        m_AccTime += pTimer->GetElapsed();
+        m_AccTime += elapsedSec;
         const float yaw{m_RotationAngleDeg * TO_RADIANS * m_RotationSpeed * m_AccTime};
         const auto rotMatrix{Matrix::CreateRotationY(yaw)};
         
         for (size_t idx{0}; idx < meshes_world_list[0].vertices.size(); ++idx)
         {
-            meshes_world_list_transformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
-            meshes_world_list_transformed[0].vertices[idx].normal = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].normal);
+            m_MeshesWorldListTransformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
+            m_MeshesWorldListTransformed[0].vertices[idx].normal = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].normal);
         }
 #elif TODO_2
-        if (not m_Rotate) return;
+        if (not m_Settings.rotate) return;
         
-        m_AccTime += pTimer->GetElapsed();
+        m_AccTime += elapsedSec;
         const float yaw{m_RotationAngleDeg * TO_RADIANS * m_RotationSpeed * m_AccTime};
         const auto rotMatrix{Matrix::CreateRotationY(yaw)};
         
         for (size_t idx{0}; idx < meshes_world_list[0].vertices.size(); ++idx)
         {
-            meshes_world_list_transformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
-            meshes_world_list_transformed[0].vertices[idx].normal = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].normal);
-            meshes_world_list_transformed[0].vertices[idx].tangent = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].tangent);
+            m_MeshesWorldListTransformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
+            m_MeshesWorldListTransformed[0].vertices[idx].normal = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].normal);
+            m_MeshesWorldListTransformed[0].vertices[idx].tangent = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].tangent);
         }
 #elif TODO_3
-        if (not m_Rotate) return;
+        if (not m_Settings.rotate) return;
         
-        m_AccTime += pTimer->GetElapsed();
+        m_AccTime += elapsedSec;
         const float yaw{m_RotationAngleDeg * TO_RADIANS * m_RotationSpeed * m_AccTime};
         const auto rotMatrix{Matrix::CreateRotationY(yaw)};
         
         for (size_t idx{0}; idx < meshes_world_list[0].vertices.size(); ++idx)
         {
-            meshes_world_list_transformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
-            meshes_world_list_transformed[0].vertices[idx].normal = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].normal);
-            meshes_world_list_transformed[0].vertices[idx].tangent = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].tangent);
+            m_MeshesWorldListTransformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
+            m_MeshesWorldListTransformed[0].vertices[idx].normal = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].normal);
+            m_MeshesWorldListTransformed[0].vertices[idx].tangent = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].tangent);
         }
 #elif TODO_4
-        if (not m_Rotate) return;
+        if (not m_Settings.rotate) return;
         
-        m_AccTime += pTimer->GetElapsed();
+        m_AccTime += elapsedSec;
         const float yaw{m_RotationAngleDeg * TO_RADIANS * m_RotationSpeed * m_AccTime};
         const auto rotMatrix{Matrix::CreateRotationY(yaw)};
         
         for (size_t idx{0}; idx < meshes_world_list[0].vertices.size(); ++idx)
         {
-            meshes_world_list_transformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
-            meshes_world_list_transformed[0].vertices[idx].normal = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].normal);
-            meshes_world_list_transformed[0].vertices[idx].tangent = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].tangent);
+            m_MeshesWorldListTransformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
+            m_MeshesWorldListTransformed[0].vertices[idx].normal = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].normal);
+            m_MeshesWorldListTransformed[0].vertices[idx].tangent = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].tangent);
         }
 #elif TODO_5
-        if (not m_Rotate) return;
+        if (not m_Settings.rotate) return;
         
-        m_AccTime += pTimer->GetElapsed();
+        m_AccTime += elapsedSec;
         const float yaw{m_RotationAngleDeg * TO_RADIANS * m_RotationSpeed * m_AccTime};
         const auto rotMatrix{Matrix::CreateRotationY(yaw)};
         
         for (size_t idx{0}; idx < meshes_world_list[0].vertices.size(); ++idx)
         {
-            meshes_world_list_transformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
-            meshes_world_list_transformed[0].vertices[idx].normal = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].normal);
-            meshes_world_list_transformed[0].vertices[idx].tangent = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].tangent);
+            m_MeshesWorldListTransformed[0].vertices[idx].position = rotMatrix.TransformPoint(meshes_world_list[0].vertices[idx].position);
+            m_MeshesWorldListTransformed[0].vertices[idx].normal = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].normal);
+            m_MeshesWorldListTransformed[0].vertices[idx].tangent = rotMatrix.TransformVector(meshes_world_list[0].vertices[idx].tangent);
         }
 #elif TODO_6
         const float yaw{m_RotationAngleRad * m_AccTime};
         const auto rotation{Matrix::CreateRotationY(yaw)};
         const auto combined = rotation * m_Transform;
         
-        if (m_Rotate)
+        if (m_Settings.rotate)
         {
-            m_AccTime += pTimer->GetElapsed();
+            m_AccTime += elapsedSec;
         }
         
         for (size_t idx{0}; idx < meshes_world_list[0].vertices.size(); ++idx)
         {
-            meshes_world_list_transformed[0].vertices[idx].position = combined.TransformPoint(meshes_world_list[0].vertices[idx].position);
-            meshes_world_list_transformed[0].vertices[idx].normal = combined.TransformVector(meshes_world_list[0].vertices[idx].normal);
-            meshes_world_list_transformed[0].vertices[idx].tangent = combined.TransformVector(meshes_world_list[0].vertices[idx].tangent);
+            m_MeshesWorldListTransformed[0].vertices[idx].position = combined.TransformPoint(meshes_world_list[0].vertices[idx].position);
+            m_MeshesWorldListTransformed[0].vertices[idx].normal = combined.TransformVector(meshes_world_list[0].vertices[idx].normal);
+            m_MeshesWorldListTransformed[0].vertices[idx].tangent = combined.TransformVector(meshes_world_list[0].vertices[idx].tangent);
         }
 #elif TODO_7
         const float yaw{m_RotationAngleRad * m_AccTime};
         const auto rotation{Matrix::CreateRotationY(yaw)};
         const auto combined = rotation * m_Transform;
         
-        if (m_Rotate)
+        if (m_Settings.rotate)
         {
-            m_AccTime += pTimer->GetElapsed();
+            m_AccTime += elapsedSec;
         }
         
-        for (size_t idx{0}; idx < meshes_world_list[0].vertices.size(); ++idx)
-        {
-            meshes_world_list_transformed[0].vertices[idx].position = combined.TransformPoint(meshes_world_list[0].vertices[idx].position);
-            meshes_world_list_transformed[0].vertices[idx].normal = combined.TransformVector(meshes_world_list[0].vertices[idx].normal);
-            meshes_world_list_transformed[0].vertices[idx].tangent = combined.TransformVector(meshes_world_list[0].vertices[idx].tangent);
-        }
+        // One batched pass per attribute, straight over the vertex members
+        const std::span<const Vertex> source{meshes_world_list[0].vertices};
+        const std::span<Vertex> destination{m_MeshesWorldListTransformed[0].vertices};
+        combined.TransformPoints({source, &Vertex::position}, {destination, &Vertex::position});
+        combined.TransformVectors({source, &Vertex::normal}, {destination, &Vertex::normal});
+        combined.TransformVectors({source, &Vertex::tangent}, {destination, &Vertex::tangent});
+        // The bounds stay in object space, the frustum test moves them with the mesh
+        m_MeshesWorldListTransformed[0].worldMatrix = combined;
 #endif
 #endif
     }
 
     void Renderer::Render()
     {
-        //@START
-        //Lock BackBuffer
-        SDL_LockSurface(m_BackBufferPtr);
+        PROFILE_SCOPE("Render");
+        ALLOCATION_SCOPE("Render");
+
+        // Everything transient from the previous frame is released at once
+        m_FrameArenaPtr->Reset();
+        std::fill(m_WorkerStats.begin(), m_WorkerStats.end(), PipelineStats{});
+        if (m_RenderedFrames++ >= s_WarmUpFrames)
+        {
+            m_SteadyStateArenaAllocations += m_FrameArenaPtr->GetLastFrameUpstreamAllocations();
+        }
+
+        // Internal resolution, only the final vehicle path knows how to render into a viewport
+        const bool useDynamicResolution{m_Settings.dynamicResolution and W4 and TODO_7};
+        if (useDynamicResolution)
+        {
+            m_DynamicResolutionPtr->SetBudget(m_Settings.frameBudgetMs);
+            m_DynamicResolutionPtr->SetScaleRange(m_Settings.minResolutionScale, 1.0f);
+        }
+        else
+        {
+            m_DynamicResolutionPtr->Reset();
+        }
+        SetViewport(m_DynamicResolutionPtr->GetWidth(), m_DynamicResolutionPtr->GetHeight());
+
+        const auto renderStart{Clock::now()};
 
         // --- WEEK 1 ---
 #if W1
 #if TODO_0
         Render_W1_TODO_0();
-        UpdateWindow();
 #elif TODO_1
         Render_W1_TODO_1();
-        UpdateWindow();
 #elif TODO_2
         Render_W1_TODO_2();
-        UpdateWindow();
 #elif TODO_3
         Render_W1_TODO_3();
-        UpdateWindow();
 #elif TODO_4
         Render_W1_TODO_4();
-        UpdateWindow();
 #elif TODO_5
         Render_W1_TODO_5();
-        UpdateWindow();
 #endif
 
         // --- WEEK 2 ---
 #elif W2
 #if TODO_1
         Render_W2_TODO_1();
-        UpdateWindow();
 #elif TODO_2
         Render_W2_TODO_2();
-        UpdateWindow();
 #elif TODO_3
         Render_W2_TODO_3();
-        UpdateWindow();
 #elif TODO_4
         Render_W2_TODO_4();
-        UpdateWindow();
 #elif TODO_5
         Render_W2_TODO_5();
-        UpdateWindow();
 #endif
 
         // --- WEEK 3 ---
 #elif W3
 #if TODO_0
         Render_W3_TODO_0();
-        UpdateWindow();
 #elif TODO_1
         Render_W3_TODO_1();
-        UpdateWindow();
 #elif TODO_2
         Render_W3_TODO_2();
-        UpdateWindow();
 #elif TODO_3
         Render_W3_TODO_3();
-        UpdateWindow();
 #elif TODO_4
         Render_W3_TODO_4();
-        UpdateWindow();
 #elif TODO_5
         Render_W3_TODO_5();
-        UpdateWindow();
 #elif TODO_6
         Render_W3_TODO_6();
-        UpdateWindow();
 #endif
 
         // --- WEEK 4 ---
 #elif W4
 #if TODO_0
         Render_W4_TODO_0();
-        UpdateWindow();
 #elif TODO_1
         Render_W4_TODO_1();
-        UpdateWindow();
 #elif TODO_2
         Render_W4_TODO_2();
-        UpdateWindow();
 #elif TODO_3
         Render_W4_TODO_3();
-        UpdateWindow();
 #elif TODO_4
         Render_W4_TODO_4();
-        UpdateWindow();
 #elif TODO_5
         Render_W4_TODO_5();
-        UpdateWindow();
 #elif TODO_6
         Render_W4_TODO_6();
-        UpdateCurrentShadingModeText();
-        CreateUI();
-        UpdateRenderer();
 #elif TODO_7
         Render_W4_TODO_7();
-        UpdateCurrentShadingModeText();
-        CreateUI();
-        UpdateRenderer();
 #endif
 #endif
-    }
-#pragma endregion
-
-#pragma region Render helpers
-    void Renderer::SwapBuffers() const
-    {
-        SDL_UnlockSurface(m_BackBufferPtr);
-        SDL_BlitSurface(m_BackBufferPtr, 0, m_FrontBufferPtr, 0);
-    }
 
-    void Renderer::UpdateWindow() const
-    {
-        SwapBuffers();
-        SDL_UpdateWindowSurface(m_WindowPtr);
-    }
+        m_FrameTimings.render = MillisecondsSince(renderStart);
 
-    void Renderer::UpdateRenderer() const
-    {
-        // ImGui Rendering
-        SwapBuffers();
-        
-        ImGui::Render();
-        
-        SDL_RenderSetScale(m_RendererPtr, ImGui::GetIO().DisplayFramebufferScale.x, ImGui::GetIO().DisplayFramebufferScale.y);
-        
-        auto* frontTexturePtr = SDL_CreateTextureFromSurface(m_RendererPtr, m_FrontBufferPtr);
-        SDL_RenderCopy(m_RendererPtr, frontTexturePtr, nullptr, nullptr);
-        
-        ImGui_ImplSDLRenderer2_RenderDrawData(ImGui::GetDrawData());
-        
-        SDL_RenderPresent(m_RendererPtr);
+        m_PipelineStats = {};
+        for (const PipelineStats& workerStats : m_WorkerStats)
+        {
+            m_PipelineStats += workerStats;
+        }
+        if (useDynamicResolution)
+        {
+            m_DynamicResolutionPtr->Update(m_FrameTimings.render);
+        }
     }
+#pragma endregion
 
+#pragma region UI
     void Renderer::CreateUI()
     {
+        UpdateCurrentShadingModeText();
+
         // ImGui Window
         ImGui::Begin("Properties");
         ImGui::Text("Current mode: %s", m_CurrentShadingModeAsText.c_str());
@@ -455,24 +582,71 @@ namespace dae
         ImGui::Separator();
         ImGui::Spacing();
 
-        ImGui::ColorEdit3("Background color", m_BackgroundColor);
+        ImGui::ColorEdit3("Background color", m_PendingSettings.backgroundColor);
+        if (ImGui::BeginCombo("Depth format", DepthBuffer::GetFormatName(m_PendingSettings.depthFormat)))
+        {
+            for (int idx{0}; idx < static_cast<int>(DepthFormat::COUNT); ++idx)
+            {
+                const auto format{static_cast<DepthFormat>(idx)};
+                if (ImGui::Selectable(DepthBuffer::GetFormatName(format), format == m_PendingSettings.depthFormat))
+                {
+                    m_PendingSettings.depthFormat = format;
+                }
+            }
+            ImGui::EndCombo();
+        }
+        if (ImGui::BeginCombo("Tone mapping", HdrBuffer::GetToneMappingName(m_PendingSettings.toneMapping)))
+        {
+            for (int idx{0}; idx < static_cast<int>(ToneMapping::COUNT); ++idx)
+            {
+                const auto toneMapping{static_cast<ToneMapping>(idx)};
+                if (ImGui::Selectable(HdrBuffer::GetToneMappingName(toneMapping), toneMapping == m_PendingSettings.toneMapping))
+                {
+                    m_PendingSettings.toneMapping = toneMapping;
+                }
+            }
+            ImGui::EndCombo();
+        }
+        ImGui::Checkbox("sRGB output", &m_PendingSettings.encodeSRGB);
 
         ImGui::Spacing();
         ImGui::Separator();
         ImGui::Spacing();
         
-        ImGui::Checkbox("Normal map", &m_UseNormalMap);
-        ImGui::Checkbox("Rotate", &m_Rotate);
+        if (ImGui::Button("Cycle heatmap"))
+        {
+            CycleHeatmap();
+        }
+        if (m_PendingSettings.currentShadingMode == ShadingMode::Overdraw or m_PendingSettings.currentShadingMode == ShadingMode::PixelTests
+            or m_PendingSettings.currentShadingMode == ShadingMode::ShadingCost)
+        {
+            ImGui::SameLine();
+            ImGui::Text("black 0 .. red %u", m_LastHeatMax);
+        }
+        
+        ImGui::Checkbox("Normal map", &m_PendingSettings.useNormalMap);
+        ImGui::Checkbox("Rotate", &m_PendingSettings.rotate);
+        if (ImGui::BeginCombo("Math precision", GetMathPrecisionName(m_PendingSettings.mathPrecision)))
+        {
+            for (const MathPrecision precision : {MathPrecision::Exact, MathPrecision::Fast})
+            {
+                if (ImGui::Selectable(GetMathPrecisionName(precision), precision == m_PendingSettings.mathPrecision))
+                {
+                    m_PendingSettings.mathPrecision = precision;
+                }
+            }
+            ImGui::EndCombo();
+        }
         
         ImGui::Spacing();
         ImGui::Separator();
         ImGui::Spacing();
         
-        ImGui::ColorEdit3("Ambient", m_Ambient);
-        ImGui::SliderFloat3("Light direction", m_LightDirection, -1.0f, 1.0f);
-        ImGui::SliderFloat("Light intensity", &m_LightIntensity, 0.0f, 20.0f);
-        ImGui::SliderFloat("KD (Diffuse reflection coefficient)", &m_KD, 0.0f, 20.0f);
-        ImGui::SliderFloat("Shininess", &m_Shininess, 0.0f, 100.0f);
+        ImGui::ColorEdit3("Ambient", m_PendingSettings.ambient);
+        ImGui::SliderFloat3("Light direction", m_PendingSettings.lightDirection, -1.0f, 1.0f);
+        ImGui::SliderFloat("Light intensity", &m_PendingSettings.lightIntensity, 0.0f, 20.0f);
+        ImGui::SliderFloat("KD (Diffuse reflection coefficient)", &m_PendingSettings.kd, 0.0f, 20.0f);
+        ImGui::SliderFloat("Shininess", &m_PendingSettings.shininess, 0.0f, 100.0f);
         
         ImGui::Spacing();
         ImGui::Separator();
@@ -483,6 +657,11 @@ namespace dae
             TakeScreenshot();
         }
         ImGui::SameLine();
+        if (ImGui::Button(m_CaptureSequence ? "Stop capture" : "Start capture"))
+        {
+            ToggleSequenceCapture();
+        }
+        ImGui::SameLine();
         if (ImGui::Button("Start benchmark"))
         {
             StartBenchmark();
@@ -492,55 +671,319 @@ namespace dae
         ImGui::Separator();
         ImGui::Spacing();
         
+        ImGui::Checkbox("Dynamic resolution", &m_PendingSettings.dynamicResolution);
+        ImGui::SliderFloat("Raster budget (ms)", &m_PendingSettings.frameBudgetMs, 1.0f, 50.0f);
+        ImGui::SliderFloat("Minimum scale", &m_PendingSettings.minResolutionScale, 0.25f, 1.0f);
+        ImGui::Text("Resolution %dx%d (%.0f%%), raster %.2f ms", m_ResolutionStats.width, m_ResolutionStats.height,
+                    m_ResolutionStats.scale * 100.0f, m_ResolutionStats.rasterMs);
+
+        ImGui::Spacing();
+        ImGui::Separator();
+        ImGui::Spacing();
+
+        if (ImGui::CollapsingHeader("Pipeline statistics"))
+        {
+            m_LastPipelineStats.ForEach([](const char* name, uint64_t value)
+            {
+                ImGui::Text("%-26s %llu", name, static_cast<unsigned long long>(value));
+            });
+            const uint64_t viewportPixels{static_cast<uint64_t>(m_ResolutionStats.width) * static_cast<uint64_t>(m_ResolutionStats.height)};
+            ImGui::Text("%-26s %.2f", "Overdraw", m_LastPipelineStats.GetOverdraw(viewportPixels));
+        }
+
+        ImGui::Spacing();
+        ImGui::Separator();
+        ImGui::Spacing();
+
         ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate,
                     ImGui::GetIO().Framerate);
         ImGui::End();
+
+        CreateProfilerUI();
+    }
+
+    /**
+     * \brief Timeline of the last profiled frame: one lane per thread, nested zones stacked under their parent
+     */
+    void Renderer::CreateProfilerUI() const
+    {
+        ImGui::Begin("Profiler");
+#if ENABLE_PROFILER
+        Profiler& profiler{Profiler::Get()};
+
+        bool isPaused{profiler.IsPaused()};
+        if (ImGui::Checkbox("Pause", &isPaused))
+        {
+            profiler.SetPaused(isPaused);
+        }
+        ImGui::SameLine();
+        if (profiler.IsCapturing())
+        {
+            ImGui::Text("Capturing %zu/%u frames", profiler.GetCapturedFrameCount(), s_TraceFrames);
+        }
+        else if (ImGui::Button("Capture Chrome trace"))
+        {
+            profiler.StartCapture(s_TraceFrames);
+        }
+
+        const ProfileFrame& frame{profiler.GetLastFrame()};
+        const int64_t frameNs{std::max(frame.endNs - frame.startNs, int64_t{1})};
+        ImGui::Text("Frame %.2f ms, dropped zones %llu", static_cast<double>(frameNs) / 1'000'000.0,
+                    static_cast<unsigned long long>(profiler.GetDroppedEvents()));
+
+        constexpr float laneHeight{18.0f};
+        const float width{std::max(ImGui::GetContentRegionAvail().x, 1.0f)};
+        const float pixelsPerNs{width / static_cast<float>(frameNs)};
+        ImDrawList* drawListPtr{ImGui::GetWindowDrawList()};
+
+        for (const ProfileThread& thread : frame.threads)
+        {
+            uint32_t maxDepth{0};
+            for (const ProfileEvent& event : thread.events)
+            {
+                maxDepth = std::max(maxDepth, event.depth);
+            }
+
+            ImGui::TextUnformatted(thread.name.c_str());
+            const ImVec2 origin{ImGui::GetCursorScreenPos()};
+            ImGui::Dummy({width, laneHeight * static_cast<float>(maxDepth + 1)});
+
+            for (const ProfileEvent& event : thread.events)
+            {
+                const float startX{origin.x + static_cast<float>(event.startNs - frame.startNs) * pixelsPerNs};
+                const float endX{std::max(origin.x + static_cast<float>(event.endNs - frame.startNs) * pixelsPerNs, startX + 1.0f)};
+                const ImVec2 min{startX, origin.y + laneHeight * static_cast<float>(event.depth)};
+                const ImVec2 max{endX, min.y + laneHeight - 1.0f};
+
+                drawListPtr->AddRectFilled(min, max, GetZoneColor(event.name));
+                drawListPtr->PushClipRect(min, max, true);
+                drawListPtr->AddText({min.x + 2.0f, min.y + 1.0f}, IM_COL32_WHITE, event.name);
+                drawListPtr->PopClipRect();
+
+                if (ImGui::IsMouseHoveringRect(min, max))
+                {
+                    ImGui::SetTooltip("%s: %.3f ms", event.name, static_cast<double>(event.endNs - event.startNs) / 1'000'000.0);
+                }
+            }
+        }
+#else
+        ImGui::TextUnformatted("Compiled out (ENABLE_PROFILER is 0)");
+#endif
+
+        ImGui::Spacing();
+        ImGui::Separator();
+        ImGui::Spacing();
+
+        if (ImGui::CollapsingHeader("Heap allocations (last frame)"))
+        {
+            const AllocationFrame& allocations{AllocationTracker::GetLastFrame()};
+            ImGui::Text("%llu allocations, %llu bytes, %llu frees",
+                        static_cast<unsigned long long>(allocations.total.allocations),
+                        static_cast<unsigned long long>(allocations.total.bytes),
+                        static_cast<unsigned long long>(allocations.total.frees));
+            ImGui::Text("After warm-up: %llu, live: %llu",
+                        static_cast<unsigned long long>(m_SteadyStateHeapAllocations),
+                        static_cast<unsigned long long>(AllocationTracker::GetLiveAllocations()));
+            if constexpr (not AllocationTracker::IsEnabled())
+            {
+                ImGui::TextUnformatted("operator new is not tracked (ENABLE_ALLOCATION_TRACKING is 0)");
+            }
+
+            if (ImGui::BeginTable("HeapAllocations", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+            {
+                ImGui::TableSetupColumn("Tag");
+                ImGui::TableSetupColumn("Allocations");
+                ImGui::TableSetupColumn("Bytes");
+                ImGui::TableHeadersRow();
+
+                for (int idx{0}; idx < allocations.tagCount; ++idx)
+                {
+                    const TaggedAllocationCounts& tag{allocations.tags[idx]};
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(tag.tag);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(tag.allocations));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%llu", static_cast<unsigned long long>(tag.bytes));
+                }
+                ImGui::EndTable();
+            }
+        }
+
+        if (ImGui::CollapsingHeader("Hardware counters (render thread + workers)"))
+        {
+            const HardwareCounters* countersPtr{m_LastHardwareCountersPtr};
+            if (not countersPtr)
+            {
+                ImGui::TextUnformatted("Not sampled, only the final vehicle path reads them");
+            }
+            else if (not countersPtr->IsAvailable())
+            {
+                ImGui::TextWrapped("Not available: %s", countersPtr->GetStatus().c_str());
+            }
+            else
+            {
+                if (not countersPtr->GetStatus().empty())
+                {
+                    ImGui::TextWrapped("Missing %s", countersPtr->GetStatus().c_str());
+                }
+
+                const std::pair<const char*, const HardwareCounterValues*> stages[]
+                {
+                    {"Clear",   &m_LastStageCounters.clear},
+                    {"Vertex",  &m_LastStageCounters.vertex},
+                    {"Setup",   &m_LastStageCounters.setup},
+                    {"Raster",  &m_LastStageCounters.raster},
+                    {"Resolve", &m_LastStageCounters.resolve},
+                };
+
+                constexpr int eventCount{HardwareCounterValues::s_EventCount};
+                const bool hasIPC{countersPtr->IsAvailable(HardwareEvent::Cycles) and countersPtr->IsAvailable(HardwareEvent::Instructions)};
+                if (ImGui::BeginTable("HardwareCounters", eventCount + 2, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+                {
+                    ImGui::TableSetupColumn("Stage");
+                    for (int idx{0}; idx < eventCount; ++idx)
+                    {
+                        ImGui::TableSetupColumn(HardwareCounters::GetName(static_cast<HardwareEvent>(idx)));
+                    }
+                    ImGui::TableSetupColumn("IPC");
+                    ImGui::TableHeadersRow();
+
+                    for (const auto& [name, valuesPtr] : stages)
+                    {
+                        ImGui::TableNextRow();
+                        ImGui::TableNextColumn();
+                        ImGui::TextUnformatted(name);
+                        for (int idx{0}; idx < eventCount; ++idx)
+                        {
+                            ImGui::TableNextColumn();
+                            if (countersPtr->IsAvailable(static_cast<HardwareEvent>(idx)))
+                            {
+                                ImGui::Text("%llu", static_cast<unsigned long long>(valuesPtr->counts[idx]));
+                            }
+                            else
+                            {
+                                ImGui::TextUnformatted("-");
+                            }
+                        }
+                        ImGui::TableNextColumn();
+                        if (hasIPC)
+                        {
+                            ImGui::Text("%.2f", valuesPtr->GetIPC());
+                        }
+                        else
+                        {
+                            ImGui::TextUnformatted("-");
+                        }
+                    }
+                    ImGui::EndTable();
+                }
+            }
+        }
+        ImGui::End();
     }
 #pragma endregion
 
 #pragma region Setters
+    /**
+     * \brief Restarts the model animation at t = 0 with the next frame (see BeginFrame)
+     */
+    void Renderer::ResetTimeline()
+    {
+        m_PendingTimelineReset = true;
+    }
+
+    void Renderer::SetDynamicResolution(bool isEnabled, float frameBudgetMs)
+    {
+        m_PendingSettings.dynamicResolution = isEnabled;
+        m_PendingSettings.frameBudgetMs     = frameBudgetMs;
+    }
+
+    void Renderer::SetMathPrecision(MathPrecision precision)
+    {
+        m_PendingSettings.mathPrecision = precision;
+    }
+
+    void Renderer::SetColorResolve(ToneMapping toneMapping, bool encodeSRGB)
+    {
+        m_PendingSettings.toneMapping = toneMapping;
+        m_PendingSettings.encodeSRGB  = encodeSRGB;
+    }
+
     void Renderer::ToggleDepthBufferVisibility()
     {
-        if (m_CurrentShadingMode != ShadingMode::DepthBuffer)
+        if (m_PendingSettings.currentShadingMode != ShadingMode::DepthBuffer)
         {
-            m_PreviousShadingMode = m_CurrentShadingMode;
-            m_CurrentShadingMode = ShadingMode::DepthBuffer;
+            m_PendingSettings.previousShadingMode = m_PendingSettings.currentShadingMode;
+            m_PendingSettings.currentShadingMode = ShadingMode::DepthBuffer;
         }
         else
         {
-            m_CurrentShadingMode = m_PreviousShadingMode;
+            m_PendingSettings.currentShadingMode = m_PendingSettings.previousShadingMode;
         }
     }
 
     void Renderer::ToggleBoundingBoxVisibility()
     {
-        if (m_CurrentShadingMode != ShadingMode::BoundingBox)
+        if (m_PendingSettings.currentShadingMode != ShadingMode::BoundingBox)
         {
-            m_PreviousShadingMode = m_CurrentShadingMode;
-            m_CurrentShadingMode = ShadingMode::BoundingBox;
+            m_PendingSettings.previousShadingMode = m_PendingSettings.currentShadingMode;
+            m_PendingSettings.currentShadingMode = ShadingMode::BoundingBox;
         }
         else
         {
-            m_CurrentShadingMode = m_PreviousShadingMode;
+            m_PendingSettings.currentShadingMode = m_PendingSettings.previousShadingMode;
         }
     }
 
     void Renderer::ToggleNormalVisibility()
     {
-        m_UseNormalMap = not m_UseNormalMap;
+        m_PendingSettings.useNormalMap = not m_PendingSettings.useNormalMap;
     }
 
     void Renderer::ToggleRotation()
     {
-        m_Rotate = not m_Rotate;
+        m_PendingSettings.rotate = not m_PendingSettings.rotate;
+    }
+
+    /**
+     * \brief Off -> overdraw -> bounding box tests -> shading cost -> off
+     */
+    void Renderer::CycleHeatmap()
+    {
+        switch (m_PendingSettings.currentShadingMode)
+        {
+        case ShadingMode::Overdraw:
+            m_PendingSettings.currentShadingMode = ShadingMode::PixelTests;
+            break;
+        case ShadingMode::PixelTests:
+            m_PendingSettings.currentShadingMode = ShadingMode::ShadingCost;
+            break;
+        case ShadingMode::ShadingCost:
+            m_PendingSettings.currentShadingMode = m_PendingSettings.previousShadingMode;
+            break;
+        default:
+            m_PendingSettings.previousShadingMode = m_PendingSettings.currentShadingMode;
+            m_PendingSettings.currentShadingMode  = ShadingMode::Overdraw;
+            break;
+        }
     }
 
     void Renderer::CycleShadingMode()
     {
-        m_CurrentShadingMode = static_cast<ShadingMode>(
-            (static_cast<int>(m_CurrentShadingMode) + 1) % static_cast<int>(ShadingMode::COUNT)
+        m_PendingSettings.currentShadingMode = static_cast<ShadingMode>(
+            (static_cast<int>(m_PendingSettings.currentShadingMode) + 1) % static_cast<int>(ShadingMode::COUNT)
             );
     }
+
+    void Renderer::SetShadingMode(ShadingMode shadingMode)
+    {
+        if (shadingMode == m_PendingSettings.currentShadingMode) return;
+
+        m_PendingSettings.previousShadingMode = m_PendingSettings.currentShadingMode;
+        m_PendingSettings.currentShadingMode  = shadingMode;
+    }
 #pragma endregion
 
 #pragma region Initialization
@@ -616,6 +1059,9 @@ namespace dae
         m_Camera.Initialize(45.0f, {0.0f, 5.0f, -64.0f}, 0.1f, 100.0f);
 #endif
 #endif
+
+        // Input only ever moves the pending copy, BeginFrame hands it to the render thread
+        m_PendingCamera = m_Camera;
     }
 
     void Renderer::InitializeOutputVertices()
@@ -624,159 +1070,159 @@ namespace dae
 #if W1
 #if TODO_0
 #elif TODO_1
-        vertices_ss.resize(triangle_vertices_ndc.size());
+        m_VerticesSS.resize(triangle_vertices_ndc.size());
 #elif TODO_2
-        vertices_ss.resize(triangle_vertices_world_todo_2.size());
+        m_VerticesSS.resize(triangle_vertices_world_todo_2.size());
 #elif TODO_3
-        vertices_ss.resize(triangle_vertices_world_todo_3.size());
+        m_VerticesSS.resize(triangle_vertices_world_todo_3.size());
 #elif TODO_4
-        vertices_ss.resize(triangle_vertices_world_todo_4.size());
+        m_VerticesSS.resize(triangle_vertices_world_todo_4.size());
 #elif TODO_5
-        vertices_ss.resize(triangle_vertices_world_todo_4.size());
+        m_VerticesSS.resize(triangle_vertices_world_todo_4.size());
 #endif
 
         // --- WEEK 2 ---
 #elif W2
 #if TODO_1
-        vertices_ss.resize(meshes_world_list[0].vertices.size());
+        m_VerticesSS.resize(meshes_world_list[0].vertices.size());
 #elif TODO_2
-        vertices_ss.resize(meshes_world_strip[0].vertices.size());
+        m_VerticesSS.resize(meshes_world_strip[0].vertices.size());
 #elif TODO_3
-        vertices_ss.resize(meshes_world_strip[0].vertices.size());
+        m_VerticesSS.resize(meshes_world_strip[0].vertices.size());
 #elif TODO_4
-        vertices_ss.resize(meshes_world_strip[0].vertices.size());
+        m_VerticesSS.resize(meshes_world_strip[0].vertices.size());
 #elif TODO_5
-        vertices_ss.resize(meshes_world_strip[0].vertices.size());
+        m_VerticesSS.resize(meshes_world_strip[0].vertices.size());
 #endif
 
         // --- WEEK 3 ---
 #elif W3
 #if TODO_0
         Utils::ParseOBJ(m_TuktukPath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        vertices_ss.resize(meshes_world_list[0].vertices.size());
+        m_VerticesSS.resize(meshes_world_list[0].vertices.size());
 #elif TODO_1
-        vertices_ss_out.resize(meshes_world_strip[0].vertices.size());
+        m_VerticesSSOut.resize(meshes_world_strip[0].vertices.size());
 #elif TODO_2
         Utils::ParseOBJ(m_TuktukPath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        m_VerticesSSOut.resize(meshes_world_list[0].vertices.size());
 #elif TODO_3
         Utils::ParseOBJ(m_TuktukPath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        m_VerticesSSOut.resize(meshes_world_list[0].vertices.size());
 #elif TODO_4
         Utils::ParseOBJ(m_TuktukPath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        meshes_world_list_transformed = meshes_world_list;
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        m_MeshesWorldListTransformed = meshes_world_list;
+        m_VerticesSSOut.resize(meshes_world_list[0].vertices.size());
 #elif TODO_5
         Utils::ParseOBJ(m_TuktukPath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        meshes_world_list_transformed = meshes_world_list;
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        m_MeshesWorldListTransformed = meshes_world_list;
+        m_VerticesSSOut.resize(meshes_world_list[0].vertices.size());
 #elif TODO_6
         Utils::ParseOBJ(m_TuktukPath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        meshes_world_list_transformed = meshes_world_list;
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        m_MeshesWorldListTransformed = meshes_world_list;
+        m_VerticesSSOut.resize(meshes_world_list[0].vertices.size());
 #endif
 
         // --- WEEK 4 ---
 #elif W4
 #if TODO_0
         Utils::ParseOBJ(m_VehiclePath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        meshes_world_list_transformed = meshes_world_list;
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        m_MeshesWorldListTransformed = meshes_world_list;
+        m_VerticesSSOut.resize(meshes_world_list[0].vertices.size());
 #elif TODO_1
         Utils::ParseOBJ(m_VehiclePath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        meshes_world_list_transformed = meshes_world_list;
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        m_MeshesWorldListTransformed = meshes_world_list;
+        m_VerticesSSOut.resize(meshes_world_list[0].vertices.size());
 #elif TODO_2
         Utils::ParseOBJ(m_VehiclePath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        meshes_world_list_transformed = meshes_world_list;
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        m_MeshesWorldListTransformed = meshes_world_list;
+        m_VerticesSSOut.resize(meshes_world_list[0].vertices.size());
 #elif TODO_3
         Utils::ParseOBJ(m_VehiclePath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        meshes_world_list_transformed = meshes_world_list;
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        m_MeshesWorldListTransformed = meshes_world_list;
+        m_VerticesSSOut.resize(meshes_world_list[0].vertices.size());
 #elif TODO_4
         Utils::ParseOBJ(m_VehiclePath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        meshes_world_list_transformed = meshes_world_list;
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        m_MeshesWorldListTransformed = meshes_world_list;
+        m_VerticesSSOut.resize(meshes_world_list[0].vertices.size());
 #elif TODO_5
         Utils::ParseOBJ(m_VehiclePath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        meshes_world_list_transformed = meshes_world_list;
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        m_MeshesWorldListTransformed = meshes_world_list;
+        m_VerticesSSOut.resize(meshes_world_list[0].vertices.size());
 #elif TODO_6
         Utils::ParseOBJ(m_VehiclePath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        meshes_world_list_transformed = meshes_world_list;
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        m_MeshesWorldListTransformed = meshes_world_list;
+        m_VerticesSSOut.resize(meshes_world_list[0].vertices.size());
 #elif TODO_7
         Utils::ParseOBJ(m_VehiclePath, meshes_world_list[0].vertices, meshes_world_list[0].indices);
-        meshes_world_list_transformed = meshes_world_list;
-        vertices_ss_out.resize(meshes_world_list[0].vertices.size());
+        meshes_world_list[0].bounds = BoundingBox::FromPoints({std::span<const Vertex>{meshes_world_list[0].vertices}, &Vertex::position});
+        m_MeshesWorldListTransformed = meshes_world_list;
 #endif
 #endif
     }
 
-    void Renderer::InitializeTextures()
+    void Renderer::InitializeTextures(const ImageLoader& imageLoader)
     {
         // --- WEEK 2 ---
 #if W2
 #if TODO_1
-        m_TexturePtr = Texture::LoadFromFile(m_UVGrid2TexturePath);
+        m_TexturePtr = Texture::LoadFromFile(m_UVGrid2TexturePath, imageLoader);
 #elif TODO_2
-        m_TexturePtr = Texture::LoadFromFile(m_UVGrid2TexturePath);
+        m_TexturePtr = Texture::LoadFromFile(m_UVGrid2TexturePath, imageLoader);
 #elif TODO_3
-        m_TexturePtr = Texture::LoadFromFile(m_UVGrid2TexturePath);
+        m_TexturePtr = Texture::LoadFromFile(m_UVGrid2TexturePath, imageLoader);
 #elif TODO_4
-        m_TexturePtr = Texture::LoadFromFile(m_UVGrid2TexturePath);
+        m_TexturePtr = Texture::LoadFromFile(m_UVGrid2TexturePath, imageLoader);
 #elif TODO_5
-        m_TexturePtr = Texture::LoadFromFile(m_UVGrid2TexturePath);
+        m_TexturePtr = Texture::LoadFromFile(m_UVGrid2TexturePath, imageLoader);
 #endif
 
         // --- WEEK 3 ---
 #elif W3
 #if TODO_0
-        m_TexturePtr = Texture::LoadFromFile(m_TuktukTexturePath);
+        m_TexturePtr = Texture::LoadFromFile(m_TuktukTexturePath, imageLoader);
 #elif TODO_1
-        m_TexturePtr = Texture::LoadFromFile(m_UVGrid2TexturePath);
+        m_TexturePtr = Texture::LoadFromFile(m_UVGrid2TexturePath, imageLoader);
 #elif TODO_2
-        m_TexturePtr = Texture::LoadFromFile(m_TuktukTexturePath);
+        m_TexturePtr = Texture::LoadFromFile(m_TuktukTexturePath, imageLoader);
 #elif TODO_3
-        m_TexturePtr = Texture::LoadFromFile(m_TuktukTexturePath);
+        m_TexturePtr = Texture::LoadFromFile(m_TuktukTexturePath, imageLoader);
 #elif TODO_4
-        m_TexturePtr = Texture::LoadFromFile(m_TuktukTexturePath);
+        m_TexturePtr = Texture::LoadFromFile(m_TuktukTexturePath, imageLoader);
 #elif TODO_5
-        m_TexturePtr = Texture::LoadFromFile(m_TuktukTexturePath);
+        m_TexturePtr = Texture::LoadFromFile(m_TuktukTexturePath, imageLoader);
 #elif TODO_6
-        m_TexturePtr = Texture::LoadFromFile(m_TuktukTexturePath);
+        m_TexturePtr = Texture::LoadFromFile(m_TuktukTexturePath, imageLoader);
 #endif
 
         // --- WEEK 4 ---
 #elif W4
 #if TODO_0
-        m_DiffuseTexturePtr    = Texture::LoadFromFile(m_DiffuseTexturePath);
+        m_DiffuseTexturePtr    = Texture::LoadFromFile(m_DiffuseTexturePath, imageLoader);
 #elif TODO_1
 #elif TODO_2
-        m_NormalTexturePtr     = Texture::LoadFromFile(m_NormalTexturePath);
+        m_NormalTexturePtr     = Texture::LoadFromFile(m_NormalTexturePath, imageLoader);
 #elif TODO_3
-        m_DiffuseTexturePtr    = Texture::LoadFromFile(m_DiffuseTexturePath);
-        m_NormalTexturePtr     = Texture::LoadFromFile(m_NormalTexturePath);
+        m_DiffuseTexturePtr    = Texture::LoadFromFile(m_DiffuseTexturePath, imageLoader);
+        m_NormalTexturePtr     = Texture::LoadFromFile(m_NormalTexturePath, imageLoader);
 #elif TODO_4
-        m_NormalTexturePtr     = Texture::LoadFromFile(m_NormalTexturePath);
-        m_SpecularTexturePtr   = Texture::LoadFromFile(m_SpecularTexturePath);
-        m_GlossinessTexturePtr = Texture::LoadFromFile(m_GlossinessTexturePath);
+        m_NormalTexturePtr     = Texture::LoadFromFile(m_NormalTexturePath, imageLoader);
+        m_SpecularTexturePtr   = Texture::LoadFromFile(m_SpecularTexturePath, imageLoader);
+        m_GlossinessTexturePtr = Texture::LoadFromFile(m_GlossinessTexturePath, imageLoader);
 #elif TODO_5
-        m_DiffuseTexturePtr    = Texture::LoadFromFile(m_DiffuseTexturePath);
-        m_NormalTexturePtr     = Texture::LoadFromFile(m_NormalTexturePath);
-        m_SpecularTexturePtr   = Texture::LoadFromFile(m_SpecularTexturePath);
-        m_GlossinessTexturePtr = Texture::LoadFromFile(m_GlossinessTexturePath);
+        m_DiffuseTexturePtr    = Texture::LoadFromFile(m_DiffuseTexturePath, imageLoader);
+        m_NormalTexturePtr     = Texture::LoadFromFile(m_NormalTexturePath, imageLoader);
+        m_SpecularTexturePtr   = Texture::LoadFromFile(m_SpecularTexturePath, imageLoader);
+        m_GlossinessTexturePtr = Texture::LoadFromFile(m_GlossinessTexturePath, imageLoader);
 #elif TODO_6
-        m_DiffuseTexturePtr    = Texture::LoadFromFile(m_DiffuseTexturePath);
-        m_NormalTexturePtr     = Texture::LoadFromFile(m_NormalTexturePath);
-        m_SpecularTexturePtr   = Texture::LoadFromFile(m_SpecularTexturePath);
-        m_GlossinessTexturePtr = Texture::LoadFromFile(m_GlossinessTexturePath);
+        m_DiffuseTexturePtr    = Texture::LoadFromFile(m_DiffuseTexturePath, imageLoader);
+        m_NormalTexturePtr     = Texture::LoadFromFile(m_NormalTexturePath, imageLoader);
+        m_SpecularTexturePtr   = Texture::LoadFromFile(m_SpecularTexturePath, imageLoader);
+        m_GlossinessTexturePtr = Texture::LoadFromFile(m_GlossinessTexturePath, imageLoader);
 #elif TODO_7
-        m_DiffuseTexturePtr    = Texture::LoadFromFile(m_DiffuseTexturePath);
-        m_NormalTexturePtr     = Texture::LoadFromFile(m_NormalTexturePath);
-        m_SpecularTexturePtr   = Texture::LoadFromFile(m_SpecularTexturePath);
-        m_GlossinessTexturePtr = Texture::LoadFromFile(m_GlossinessTexturePath);
+        m_DiffuseTexturePtr    = Texture::LoadFromFile(m_DiffuseTexturePath, imageLoader);
+        m_NormalTexturePtr     = Texture::LoadFromFile(m_NormalTexturePath, imageLoader);
+        m_SpecularTexturePtr   = Texture::LoadFromFile(m_SpecularTexturePath, imageLoader);
+        m_GlossinessTexturePtr = Texture::LoadFromFile(m_GlossinessTexturePath, imageLoader);
 #endif
 #endif
     }
@@ -798,7 +1244,7 @@ namespace dae
             // MODEL/OBJECT
             const Vector4 v4{vertex_in.position.x, vertex_in.position.y, vertex_in.position.z, 1.0f};
             // WORLD -> VIEW
-            const Vector4 v4_view = m_Camera.m_InverseViewMatrix.TransformPoint(v4);
+            const Vector4 v4_view = m_Camera.GetInverseViewMatrix().TransformPoint(v4);
             // DEPTH
             assert(v4_view.z != 0.0f and "Renderer::TransformFromWorldToScreenV1: Division by zero");
             vertex_out.position.z = v4_view.z;
@@ -832,7 +1278,7 @@ namespace dae
             // MODEL/OBJECT
             const Vector4 v4{vertex_in.position.x, vertex_in.position.y, vertex_in.position.z, 1.0f};
             // WORLD -> VIEW - PROJECTION
-            const Vector4 v4_proj = (m_Camera.m_InverseViewMatrix * m_Camera.m_ProjectionMatrix).TransformPoint(v4);
+            const Vector4 v4_proj = m_Camera.GetViewProjectionMatrix().TransformPoint(v4);
             // DEPTH
             assert(v4_proj.w != 0.0f and "Renderer::TransformFromWorldToScreenV2: Division by zero");
             vertex_out.position.w = v4_proj.w;
@@ -864,7 +1310,7 @@ namespace dae
             // MODEL/OBJECT
             const Vector4 positionIn{vertex_in.position.x, vertex_in.position.y, vertex_in.position.z, 1.0f};
             // WORLD -> VIEW - PROJECTION
-            const Vector4 projectedPos = (m_Camera.m_InverseViewMatrix * m_Camera.m_ProjectionMatrix).TransformPoint(positionIn);
+            const Vector4 projectedPos = m_Camera.GetViewProjectionMatrix().TransformPoint(positionIn);
             // DEPTH
             assert(projectedPos.w != 0.0f and "Renderer::TransformFromWorldToScreenV3: Division by zero");
             vertex_out.position.w = 1.0f / projectedPos.w;
@@ -897,7 +1343,7 @@ namespace dae
             // MODEL/OBJECT
             const Vector4 positionIn{vertex_in.position.x, vertex_in.position.y, vertex_in.position.z, 1.0f};
             // WORLD -> VIEW -> PROJECTION
-            const Vector4 projectedPos = (m_Camera.m_InverseViewMatrix * m_Camera.m_ProjectionMatrix).TransformPoint(positionIn);
+            const Vector4 projectedPos = m_Camera.GetViewProjectionMatrix().TransformPoint(positionIn);
             // DEPTH
             assert(projectedPos.w != 0.0f and "Renderer::TransformFromWorldToScreenV4: Division by zero");
             vertex_out.position.w = 1.0f / projectedPos.w;
@@ -937,7 +1383,7 @@ namespace dae
             // MODEL/OBJECT
             const Vector4 positionIn{vertex_in.position.x, vertex_in.position.y, vertex_in.position.z, 1.0f};
             // WORLD -> VIEW -> PROJECTION
-            const Vector4 projectedPos = (m_Camera.m_InverseViewMatrix * m_Camera.m_ProjectionMatrix).TransformPoint(positionIn);
+            const Vector4 projectedPos = m_Camera.GetViewProjectionMatrix().TransformPoint(positionIn);
             // DEPTH
             assert(projectedPos.w != 0.0f and "Renderer::TransformFromWorldToScreenV4: Division by zero");
             vertex_out.position.w = 1.0f / projectedPos.w;
@@ -996,45 +1442,75 @@ namespace dae
         return x + (y * m_Width);
     }
 
+    void Renderer::SetViewport(int width, int height)
+    {
+        m_ViewportWidth      = width;
+        m_ViewportHeight     = height;
+        m_ViewportHalfWidth  = width * 0.5f;
+        m_ViewportHalfHeight = height * 0.5f;
+        m_FrameBufferPtr->SetViewport(width, height);
+    }
+
     void Renderer::UpdateColor(ColorRGB& finalColor, int px, int py) const
     {
         //Update Color in Buffer
         finalColor.MaxToOne();
 
-        m_BackBufferPixelsPtr[px + (py * m_Width)] = SDL_MapRGB(m_BackBufferPtr->format,
-                                                              static_cast<uint8_t>(finalColor.r * 255),
-                                                              static_cast<uint8_t>(finalColor.g * 255),
-                                                              static_cast<uint8_t>(finalColor.b * 255));
+        m_BackBufferPixelsPtr[px + (py * m_Width)] = FrameBuffer::PackColor(static_cast<uint8_t>(finalColor.r * 255),
+                                                                            static_cast<uint8_t>(finalColor.g * 255),
+                                                                            static_cast<uint8_t>(finalColor.b * 255));
     }
 
     void Renderer::UpdateCurrentShadingModeText()
     {
-        switch (m_CurrentShadingMode)
+        m_CurrentShadingModeAsText = GetShadingModeName(m_PendingSettings.currentShadingMode);
+    }
+
+    const char* Renderer::GetShadingModeName(ShadingMode shadingMode)
+    {
+        switch (shadingMode)
         {
-        case ShadingMode::BoundingBox:
-            m_CurrentShadingModeAsText = "BOUNDING BOX";
-            break;
-        case ShadingMode::DepthBuffer:
-            m_CurrentShadingModeAsText = "DEPTH BUFFER";
-            break;
-        case ShadingMode::ObservedArea:
-            m_CurrentShadingModeAsText = "OBSERVED AREA";
-            break;
-        case ShadingMode::Diffuse:
-            m_CurrentShadingModeAsText = "DIFFUSE";
-            break;
-        case ShadingMode::Specular:
-            m_CurrentShadingModeAsText = "SPECULAR";
-            break;
-        case ShadingMode::Combined:
-            m_CurrentShadingModeAsText = "COMBINED";
-            break;
+        case ShadingMode::Overdraw:     return "HEATMAP: OVERDRAW";
+        case ShadingMode::PixelTests:   return "HEATMAP: BOUNDING BOX TESTS";
+        case ShadingMode::ShadingCost:  return "HEATMAP: SHADING COST";
+        case ShadingMode::BoundingBox:  return "BOUNDING BOX";
+        case ShadingMode::DepthBuffer:  return "DEPTH BUFFER";
+        case ShadingMode::ObservedArea: return "OBSERVED AREA";
+        case ShadingMode::Diffuse:      return "DIFFUSE";
+        case ShadingMode::Specular:     return "SPECULAR";
+        case ShadingMode::Combined:     return "COMBINED";
         }
+        return "";
     }
 
-    bool Renderer::SaveBufferToImage() const
+    uint32_t Renderer::GetWorkerCount() const
     {
-        return SDL_SaveBMP(m_BackBufferPtr, "Rasterizer_ColorBuffer.bmp");
+        return m_JobSystemPtr->GetWorkerCount();
+    }
+
+    std::string Renderer::GetRenderPathVariant() const
+    {
+        if (not HasUI()) return "default";
+
+        std::string variant{GetShadingModeName(m_PendingSettings.currentShadingMode)};
+        variant += ", ";
+        variant += DepthBuffer::GetFormatName(m_PendingSettings.depthFormat);
+        if (m_PendingSettings.dynamicResolution) variant += ", dynamic resolution";
+        if (m_PendingSettings.mathPrecision == MathPrecision::Fast) variant += ", fast math";
+        if (m_PendingSettings.toneMapping != ToneMapping::MaxToOne)
+        {
+            variant += ", ";
+            variant += HdrBuffer::GetToneMappingName(m_PendingSettings.toneMapping);
+        }
+        if (m_PendingSettings.encodeSRGB) variant += ", sRGB";
+        return variant;
+    }
+
+    std::string Renderer::GetSceneName()
+    {
+        constexpr int week{W1 ? 1 : W2 ? 2 : W3 ? 3 : 4};
+        constexpr int todo{TODO_0 ? 0 : TODO_1 ? 1 : TODO_2 ? 2 : TODO_3 ? 3 : TODO_4 ? 4 : TODO_5 ? 5 : TODO_6 ? 6 : 7};
+        return "W" + std::to_string(week) + "_TODO_" + std::to_string(todo);
     }
 
 #pragma endregion
@@ -1100,8 +1576,8 @@ namespace dae
     {
         // Light
         Light light;
-        light.direction = Vector3{m_LightDirection[0], m_LightDirection[1], m_LightDirection[2]}.Normalized();
-        light.intensity = m_LightIntensity;
+        light.direction = Vector3{m_Settings.lightDirection[0], m_Settings.lightDirection[1], m_Settings.lightDirection[2]}.Normalized();
+        light.intensity = m_Settings.lightIntensity;
 
         // Observed area
         const float observedArea{Vector3::Dot(vertex.normal, -light.direction)};
@@ -1109,14 +1585,14 @@ namespace dae
         if (observedArea < 0) return;
 
         // Lambert
-        const ColorRGB lambert{diffuseColor * m_KD / PI};
+        const ColorRGB lambert{diffuseColor * m_Settings.kd / PI};
 
         // Phong
         const Vector3 reflectedLight{Vector3::Reflect(-light.direction, vertex.normal)};
         const float cosAlpha{std::max(0.0f, Vector3::Dot(reflectedLight, vertex.viewDirection))};
-        const ColorRGB phong{specularColor * std::pow(cosAlpha, glossiness * m_Shininess)};
+        const ColorRGB phong{specularColor * std::pow(cosAlpha, glossiness * m_Settings.shininess)};
 
-        switch (m_CurrentShadingMode)
+        switch (m_Settings.currentShadingMode)
         {
             case ShadingMode::ObservedArea:
                 finalColor = observedArea;
@@ -1127,8 +1603,12 @@ namespace dae
             case ShadingMode::Specular:
                 finalColor = phong * observedArea;
                 break;
+            // Heatmaps replace the frame afterwards, the full shading keeps the measured cost real
+            case ShadingMode::Overdraw:
+            case ShadingMode::PixelTests:
+            case ShadingMode::ShadingCost:
             case ShadingMode::Combined:
-                finalColor = LightUtils::GetRadiance(light) * (m_Ambient + lambert + phong) * observedArea;
+                finalColor = LightUtils::GetRadiance(light) * (m_Settings.ambient + lambert + phong) * observedArea;
                 break;
         }
     }
@@ -1159,13 +1639,13 @@ namespace dae
      * Loop over all pixels, and then check if triangle covers the given pixel
      * Vertex vector can be defined in the render function itself
      */
-    void Renderer::Render_W1_TODO_1() const
+    void Renderer::Render_W1_TODO_1()
     {
-        TransformFromNDCtoScreenSpace(triangle_vertices_ndc, vertices_ss);
+        TransformFromNDCtoScreenSpace(triangle_vertices_ndc, m_VerticesSS);
 
-        const Vector2 v0{vertices_ss[0].position.GetXY()};
-        const Vector2 v1{vertices_ss[1].position.GetXY()};
-        const Vector2 v2{vertices_ss[2].position.GetXY()};
+        const Vector2 v0{m_VerticesSS[0].position.GetXY()};
+        const Vector2 v1{m_VerticesSS[1].position.GetXY()};
+        const Vector2 v2{m_VerticesSS[2].position.GetXY()};
 
         for (int px{0}; px < m_Width; ++px)
         {
@@ -1194,13 +1674,13 @@ namespace dae
               NDC space vertices (or directly to SCREEN
               space).
      */
-    void Renderer::Render_W1_TODO_2() const
+    void Renderer::Render_W1_TODO_2()
     {
-        TransformFromWorldToScreenV1(triangle_vertices_world_todo_2, vertices_ss);
+        TransformFromWorldToScreenV1(triangle_vertices_world_todo_2, m_VerticesSS);
 
-        const Vector2 v0{vertices_ss[0].position.GetXY()};
-        const Vector2 v1{vertices_ss[1].position.GetXY()};
-        const Vector2 v2{vertices_ss[2].position.GetXY()};
+        const Vector2 v0{m_VerticesSS[0].position.GetXY()};
+        const Vector2 v1{m_VerticesSS[1].position.GetXY()};
+        const Vector2 v2{m_VerticesSS[2].position.GetXY()};
 
         for (int px{0}; px < m_Width; ++px)
         {
@@ -1220,14 +1700,15 @@ namespace dae
         }
     }
 
-    void Renderer::Render_W1_TODO_3() const
+    void Renderer::Render_W1_TODO_3()
     {
-        TransformFromWorldToScreenV1(triangle_vertices_world_todo_3, vertices_ss);
+        TransformFromWorldToScreenV1(triangle_vertices_world_todo_3, m_VerticesSS);
 
-        const Vector2 v0{vertices_ss[0].position.GetXY()};
-        const Vector2 v1{vertices_ss[1].position.GetXY()};
-        const Vector2 v2{vertices_ss[2].position.GetXY()};
+        const Vector2 v0{m_VerticesSS[0].position.GetXY()};
+        const Vector2 v1{m_VerticesSS[1].position.GetXY()};
+        const Vector2 v2{m_VerticesSS[2].position.GetXY()};
 
+        std::array<float, 3> weights{};
         for (int px{0}; px < m_Width; ++px)
         {
             for (int py{0}; py < m_Height; ++py)
@@ -1250,18 +1731,19 @@ namespace dae
 
     void Renderer::Render_W1_TODO_4()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV1(triangle_vertices_world_todo_4, vertices_ss);
+        TransformFromWorldToScreenV1(triangle_vertices_world_todo_4, m_VerticesSS);
 
-        for (size_t triangleIdx{0}; triangleIdx < vertices_ss.size(); triangleIdx += 3)
+        for (size_t triangleIdx{0}; triangleIdx < m_VerticesSS.size(); triangleIdx += 3)
         {
-            const Vector2 v0{vertices_ss[triangleIdx].position.GetXY()};
-            const Vector2 v1{vertices_ss[triangleIdx + 1].position.GetXY()};
-            const Vector2 v2{vertices_ss[triangleIdx + 2].position.GetXY()};
+            const Vector2 v0{m_VerticesSS[triangleIdx].position.GetXY()};
+            const Vector2 v1{m_VerticesSS[triangleIdx + 1].position.GetXY()};
+            const Vector2 v2{m_VerticesSS[triangleIdx + 2].position.GetXY()};
 
+            std::array<float, 3> weights{};
             for (int px{0}; px < m_Width; ++px)
             {
                 for (int py{0}; py < m_Height; ++py)
@@ -1274,14 +1756,14 @@ namespace dae
                     if (IsPointInTriangle(pixel, v0, v1, v2, weights))
                     {
                         // Depth
-                        const float depth = vertices_ss[triangleIdx].position.z * weights[0] +
-                                        vertices_ss[triangleIdx + 1].position.z * weights[1] +
-                                        vertices_ss[triangleIdx + 2].position.z * weights[2];
+                        const float depth = m_VerticesSS[triangleIdx].position.z * weights[0] +
+                                        m_VerticesSS[triangleIdx + 1].position.z * weights[1] +
+                                        m_VerticesSS[triangleIdx + 2].position.z * weights[2];
                         
                         // Z-test
-                        if (depth < m_DepthBuffer[px + (py * m_Width)])
+                        if (depth < m_DepthBufferPixelsPtr[px + (py * m_Width)])
                         {
-                            m_DepthBuffer[px + (py * m_Width)] = depth;
+                            m_DepthBufferPixelsPtr[px + (py * m_Width)] = depth;
 
                             // Color
                             finalColor = triangle_vertices_world_todo_4[triangleIdx].color * weights[0] +
@@ -1297,17 +1779,17 @@ namespace dae
 
     void Renderer::Render_W1_TODO_5()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV1(triangle_vertices_world_todo_4, vertices_ss);
+        TransformFromWorldToScreenV1(triangle_vertices_world_todo_4, m_VerticesSS);
 
-        for (size_t triangleIdx{0}; triangleIdx < vertices_ss.size(); triangleIdx += 3)
+        for (size_t triangleIdx{0}; triangleIdx < m_VerticesSS.size(); triangleIdx += 3)
         {
-            const Vector2 v0{vertices_ss[triangleIdx].position.GetXY()};
-            const Vector2 v1{vertices_ss[triangleIdx + 1].position.GetXY()};
-            const Vector2 v2{vertices_ss[triangleIdx + 2].position.GetXY()};
+            const Vector2 v0{m_VerticesSS[triangleIdx].position.GetXY()};
+            const Vector2 v1{m_VerticesSS[triangleIdx + 1].position.GetXY()};
+            const Vector2 v2{m_VerticesSS[triangleIdx + 2].position.GetXY()};
 
             // Create bounding box
             int minX = static_cast<int>(std::min(v0.x, std::min(v1.x, v2.x)));
@@ -1321,6 +1803,7 @@ namespace dae
             minY = std::max(minY, 0);
             maxY = std::min(maxY, m_Height - 1);
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
@@ -1333,14 +1816,14 @@ namespace dae
                     if (IsPointInTriangle(pixel, v0, v1, v2, weights))
                     {
                         // Depth
-                        const float depth = vertices_ss[triangleIdx].position.z * weights[0] +
-                                        vertices_ss[triangleIdx + 1].position.z * weights[1] +
-                                        vertices_ss[triangleIdx + 2].position.z * weights[2];
+                        const float depth = m_VerticesSS[triangleIdx].position.z * weights[0] +
+                                        m_VerticesSS[triangleIdx + 1].position.z * weights[1] +
+                                        m_VerticesSS[triangleIdx + 2].position.z * weights[2];
 
                         // Z-test
-                        if (depth < m_DepthBuffer[px + (py * m_Width)])
+                        if (depth < m_DepthBufferPixelsPtr[px + (py * m_Width)])
                         {
-                            m_DepthBuffer[px + (py * m_Width)] = depth;
+                            m_DepthBufferPixelsPtr[px + (py * m_Width)] = depth;
 
                             // Color
                             finalColor = triangle_vertices_world_todo_4[triangleIdx].color * weights[0] +
@@ -1358,11 +1841,11 @@ namespace dae
 #pragma region Week 2
     void Renderer::Render_W2_TODO_1()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
         
-        TransformFromWorldToScreenV1(meshes_world_list[0].vertices, vertices_ss);
+        TransformFromWorldToScreenV1(meshes_world_list[0].vertices, m_VerticesSS);
 
         for (size_t idx{0}; idx < meshes_world_list[0].indices.size(); idx += 3)
         {
@@ -1372,9 +1855,9 @@ namespace dae
             const uint32_t idx2{meshes_world_list[0].indices[idx + 2]};
 
             // Triangle's vertices
-            const Vertex& v0{vertices_ss[idx0]};
-            const Vertex& v1{vertices_ss[idx1]};
-            const Vertex& v2{vertices_ss[idx2]};
+            const Vertex& v0{m_VerticesSS[idx0]};
+            const Vertex& v1{m_VerticesSS[idx1]};
+            const Vertex& v2{m_VerticesSS[idx2]};
 
             // Triangle's vertices' positions
             const Vector3& pos0{v0.position};
@@ -1393,6 +1876,7 @@ namespace dae
             minY = std::max(minY, 0);
             maxY = std::min(maxY, m_Height - 1);
             
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
@@ -1409,9 +1893,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (depth < m_DepthBuffer[bufferIdx])
+                        if (depth < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = depth;
+                            m_DepthBufferPixelsPtr[bufferIdx] = depth;
 
                             // Color
                             finalColor = colors::White;
@@ -1425,11 +1909,11 @@ namespace dae
 
     void Renderer::Render_W2_TODO_2()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV1(meshes_world_strip[0].vertices, vertices_ss);
+        TransformFromWorldToScreenV1(meshes_world_strip[0].vertices, m_VerticesSS);
 
         const std::vector<uint32_t>& indices{meshes_world_strip[0].indices};
         for (size_t idx{0}; idx < indices.size() - 2; ++idx)
@@ -1447,18 +1931,18 @@ namespace dae
             // Check for degenarate triangles
             if (idx0 == idx1 or idx1 == idx2 or idx2 == idx0) continue;
                 
-            v0 = vertices_ss[idx0];
+            v0 = m_VerticesSS[idx0];
 
             // idx is odd
             if (idx & 1)
             {
-                v1 = vertices_ss[idx2];
-                v2 = vertices_ss[idx1];
+                v1 = m_VerticesSS[idx2];
+                v2 = m_VerticesSS[idx1];
             }
             else
             {
-                v1 = vertices_ss[idx1];
-                v2 = vertices_ss[idx2];
+                v1 = m_VerticesSS[idx1];
+                v2 = m_VerticesSS[idx2];
             }
 
             // Triangle's vertices' positions
@@ -1478,6 +1962,7 @@ namespace dae
             minY = std::max(minY, 0);
             maxY = std::min(maxY, m_Height - 1);
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
@@ -1494,9 +1979,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (depth < m_DepthBuffer[bufferIdx])
+                        if (depth < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = depth;
+                            m_DepthBufferPixelsPtr[bufferIdx] = depth;
 
                             // Color
                             finalColor = colors::White;
@@ -1510,11 +1995,11 @@ namespace dae
 
     void Renderer::Render_W2_TODO_3()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV1(meshes_world_strip[0].vertices, vertices_ss);
+        TransformFromWorldToScreenV1(meshes_world_strip[0].vertices, m_VerticesSS);
 
         const std::vector<uint32_t>& indices{meshes_world_strip[0].indices};
         for (size_t idx{0}; idx < indices.size() - 2; ++idx)
@@ -1532,18 +2017,18 @@ namespace dae
             // Check for degenarate triangles
             if (idx0 == idx1 or idx1 == idx2 or idx2 == idx0) continue;
                 
-            v0 = vertices_ss[idx0];
+            v0 = m_VerticesSS[idx0];
 
             // idx is odd
             if (idx & 1)
             {
-                v1 = vertices_ss[idx2];
-                v2 = vertices_ss[idx1];
+                v1 = m_VerticesSS[idx2];
+                v2 = m_VerticesSS[idx1];
             }
             else
             {
-                v1 = vertices_ss[idx1];
-                v2 = vertices_ss[idx2];
+                v1 = m_VerticesSS[idx1];
+                v2 = m_VerticesSS[idx2];
             }
 
             // Triangle's vertices' positions
@@ -1563,6 +2048,7 @@ namespace dae
             minY = std::max(minY, 0);
             maxY = std::min(maxY, m_Height - 1);
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
@@ -1582,9 +2068,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (depth < m_DepthBuffer[bufferIdx])
+                        if (depth < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = depth;
+                            m_DepthBufferPixelsPtr[bufferIdx] = depth;
 
                             // Color
                             finalColor = m_TexturePtr->Sample(uv);
@@ -1598,11 +2084,11 @@ namespace dae
 
     void Renderer::Render_W2_TODO_4()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV1(meshes_world_strip[0].vertices, vertices_ss);
+        TransformFromWorldToScreenV1(meshes_world_strip[0].vertices, m_VerticesSS);
 
         const std::vector<uint32_t>& indices{meshes_world_strip[0].indices};
         for (size_t idx{0}; idx < indices.size() - 2; ++idx)
@@ -1620,18 +2106,18 @@ namespace dae
             // Check for degenarate triangles
             if (idx0 == idx1 or idx1 == idx2 or idx2 == idx0) continue;
                 
-            v0 = vertices_ss[idx0];
+            v0 = m_VerticesSS[idx0];
 
             // idx is odd
             if (idx & 1)
             {
-                v1 = vertices_ss[idx2];
-                v2 = vertices_ss[idx1];
+                v1 = m_VerticesSS[idx2];
+                v2 = m_VerticesSS[idx1];
             }
             else
             {
-                v1 = vertices_ss[idx1];
-                v2 = vertices_ss[idx2];
+                v1 = m_VerticesSS[idx1];
+                v2 = m_VerticesSS[idx2];
             }
 
             // Triangle's vertices' positions
@@ -1651,6 +2137,7 @@ namespace dae
             minY = std::max(minY, 0);
             maxY = std::min(maxY, m_Height - 1);
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
@@ -1676,9 +2163,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (depth < m_DepthBuffer[bufferIdx])
+                        if (depth < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = depth;
+                            m_DepthBufferPixelsPtr[bufferIdx] = depth;
 
                             // Color
                             finalColor = m_TexturePtr->Sample(uv);
@@ -1692,11 +2179,11 @@ namespace dae
 
     void Renderer::Render_W2_TODO_5()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV1(meshes_world_strip[0].vertices, vertices_ss);
+        TransformFromWorldToScreenV1(meshes_world_strip[0].vertices, m_VerticesSS);
 
         const std::vector<uint32_t>& indices{meshes_world_strip[0].indices};
         for (size_t idx{0}; idx < indices.size() - 2; ++idx)
@@ -1714,18 +2201,18 @@ namespace dae
             // Check for degenarate triangles
             if (idx0 == idx1 or idx1 == idx2 or idx2 == idx0) continue;
                 
-            v0 = vertices_ss[idx0];
+            v0 = m_VerticesSS[idx0];
 
             // idx is odd
             if (idx & 1)
             {
-                v1 = vertices_ss[idx2];
-                v2 = vertices_ss[idx1];
+                v1 = m_VerticesSS[idx2];
+                v2 = m_VerticesSS[idx1];
             }
             else
             {
-                v1 = vertices_ss[idx1];
-                v2 = vertices_ss[idx2];
+                v1 = m_VerticesSS[idx1];
+                v2 = m_VerticesSS[idx2];
             }
 
             // Triangle's vertices' positions
@@ -1746,6 +2233,7 @@ namespace dae
             minY = std::max(minY, 0);
             maxY = std::min(maxY, m_Height - 1);
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
@@ -1771,9 +2259,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (depth < m_DepthBuffer[bufferIdx])
+                        if (depth < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = depth;
+                            m_DepthBufferPixelsPtr[bufferIdx] = depth;
 
                             // Color
                             finalColor = m_TexturePtr->Sample(uv);
@@ -1789,11 +2277,11 @@ namespace dae
 #pragma region Week 3
     void Renderer::Render_W3_TODO_0()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV1(meshes_world_list[0].vertices, vertices_ss);
+        TransformFromWorldToScreenV1(meshes_world_list[0].vertices, m_VerticesSS);
 
         const std::vector<uint32_t>& indices{meshes_world_list[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
@@ -1804,9 +2292,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            Vertex& v0{vertices_ss[idx0]};
-            Vertex& v1{vertices_ss[idx1]};
-            Vertex& v2{vertices_ss[idx2]};
+            Vertex& v0{m_VerticesSS[idx0]};
+            Vertex& v1{m_VerticesSS[idx1]};
+            Vertex& v2{m_VerticesSS[idx2]};
 
             // Triangle's vertices' positions
             const Vector3& pos0{v0.position};
@@ -1826,6 +2314,7 @@ namespace dae
             minY = std::max(minY, 0);
             maxY = std::min(maxY, m_Height - 1);
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
@@ -1851,9 +2340,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (depth < m_DepthBuffer[bufferIdx])
+                        if (depth < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = depth;
+                            m_DepthBufferPixelsPtr[bufferIdx] = depth;
 
                             // Diffuse
                             finalColor = m_TexturePtr->Sample(uv);
@@ -1867,11 +2356,11 @@ namespace dae
 
     void Renderer::Render_W3_TODO_1()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV2(meshes_world_strip[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV2(meshes_world_strip[0].vertices, m_VerticesSSOut);
 
         const std::vector<uint32_t>& indices{meshes_world_strip[0].indices};
         for (size_t idx{0}; idx < indices.size() - 2; ++idx)
@@ -1889,18 +2378,18 @@ namespace dae
             // Check for degenarate triangles
             if (idx0 == idx1 or idx1 == idx2 or idx2 == idx0) continue;
                 
-            v0 = vertices_ss_out[idx0];
+            v0 = m_VerticesSSOut[idx0];
 
             // idx is odd
             if (idx & 1)
             {
-                v1 = vertices_ss_out[idx2];
-                v2 = vertices_ss_out[idx1];
+                v1 = m_VerticesSSOut[idx2];
+                v2 = m_VerticesSSOut[idx1];
             }
             else
             {
-                v1 = vertices_ss_out[idx1];
-                v2 = vertices_ss_out[idx2];
+                v1 = m_VerticesSSOut[idx1];
+                v2 = m_VerticesSSOut[idx2];
             }
 
             // Triangle's vertices' positions
@@ -1921,6 +2410,7 @@ namespace dae
             minY = std::max(minY, 0);
             maxY = std::min(maxY, m_Height - 1);
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
@@ -1943,9 +2433,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
 
                             // Interpolate View Space depth
                             const float weightedViewSpaceDepthV0{1.0f / pos0.w * weights[0]};
@@ -1971,11 +2461,11 @@ namespace dae
 
     void Renderer::Render_W3_TODO_2()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV2(meshes_world_list[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV2(meshes_world_list[0].vertices, m_VerticesSSOut);
 
         const std::vector<uint32_t>& indices{meshes_world_list[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
@@ -1986,9 +2476,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            Vertex_Out& v0{vertices_ss_out[idx0]};
-            Vertex_Out& v1{vertices_ss_out[idx1]};
-            Vertex_Out& v2{vertices_ss_out[idx2]};
+            Vertex_Out& v0{m_VerticesSSOut[idx0]};
+            Vertex_Out& v1{m_VerticesSSOut[idx1]};
+            Vertex_Out& v2{m_VerticesSSOut[idx2]};
 
             // Triangle's vertices' positions
             const Vector4& pos0{v0.position};
@@ -2008,6 +2498,7 @@ namespace dae
             minY = std::max(minY, 0);
             maxY = std::min(maxY, m_Height - 1);
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
@@ -2030,9 +2521,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
 
                             // Interpolate View Space depth
                             const float weightedViewSpaceDepthV0{1.0f / pos0.w * weights[0]};
@@ -2058,11 +2549,11 @@ namespace dae
 
     void Renderer::Render_W3_TODO_3()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV2(meshes_world_list[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV2(meshes_world_list[0].vertices, m_VerticesSSOut);
 
         const std::vector<uint32_t>& indices{meshes_world_list[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
@@ -2073,9 +2564,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            Vertex_Out& v0{vertices_ss_out[idx0]};
-            Vertex_Out& v1{vertices_ss_out[idx1]};
-            Vertex_Out& v2{vertices_ss_out[idx2]};
+            Vertex_Out& v0{m_VerticesSSOut[idx0]};
+            Vertex_Out& v1{m_VerticesSSOut[idx1]};
+            Vertex_Out& v2{m_VerticesSSOut[idx2]};
 
             // Triangle's vertices' positions
             const Vector4& pos0{v0.position};
@@ -2095,6 +2586,7 @@ namespace dae
             minY = std::max(minY, 0);
             maxY = std::min(maxY, m_Height - 1);
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
@@ -2117,9 +2609,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
                             
                             // Interpolate View Space depth
                             const float weightedViewSpaceDepthV0{1.0f / pos0.w * weights[0]};
@@ -2134,7 +2626,7 @@ namespace dae
                             const Vector2 uv{(weightedV0UV + weightedV1UV + weightedV2UV) * interpolatedViewSpaceDepth};
 
                             // Color
-                            if (m_CurrentShadingMode == ShadingMode::DepthBuffer)
+                            if (m_Settings.currentShadingMode == ShadingMode::DepthBuffer)
                             {
                                 const float remappedZBuffer {Remap(interpolatedZBuffer, 0.9f, 1.0f, 0.0f, 1.0f)};
                                 finalColor = ColorRGB{remappedZBuffer, remappedZBuffer, remappedZBuffer};
@@ -2153,13 +2645,13 @@ namespace dae
 
     void Renderer::Render_W3_TODO_4()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV2(meshes_world_list_transformed[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV2(m_MeshesWorldListTransformed[0].vertices, m_VerticesSSOut);
 
-        const std::vector<uint32_t>& indices{meshes_world_list_transformed[0].indices};
+        const std::vector<uint32_t>& indices{m_MeshesWorldListTransformed[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
         {
             // Triangle's indices
@@ -2168,9 +2660,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            Vertex_Out& v0{vertices_ss_out[idx0]};
-            Vertex_Out& v1{vertices_ss_out[idx1]};
-            Vertex_Out& v2{vertices_ss_out[idx2]};
+            Vertex_Out& v0{m_VerticesSSOut[idx0]};
+            Vertex_Out& v1{m_VerticesSSOut[idx1]};
+            Vertex_Out& v2{m_VerticesSSOut[idx2]};
 
             // Triangle's vertices' positions
             const Vector4& pos0{v0.position};
@@ -2190,6 +2682,7 @@ namespace dae
             if (minY < 0)         continue;
             if (maxY >= m_Height) continue;
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
@@ -2212,9 +2705,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
 
                             // Interpolate View Space depth
                             const float weightedViewSpaceDepthV0{1.0f / pos0.w * weights[0]};
@@ -2229,7 +2722,7 @@ namespace dae
                             const Vector2 uv{(weightedV0UV + weightedV1UV + weightedV2UV) * interpolatedViewSpaceDepth};
                             
                             // Color
-                            if (m_CurrentShadingMode == ShadingMode::DepthBuffer)
+                            if (m_Settings.currentShadingMode == ShadingMode::DepthBuffer)
                             {
                                 const float remappedZBuffer {Remap(interpolatedZBuffer, 0.9f, 1.0f, 0.0f, 1.0f)};
                                 finalColor = ColorRGB{remappedZBuffer, remappedZBuffer, remappedZBuffer};
@@ -2248,13 +2741,13 @@ namespace dae
 
     void Renderer::Render_W3_TODO_5()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV2(meshes_world_list_transformed[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV2(m_MeshesWorldListTransformed[0].vertices, m_VerticesSSOut);
 
-        const std::vector<uint32_t>& indices{meshes_world_list_transformed[0].indices};
+        const std::vector<uint32_t>& indices{m_MeshesWorldListTransformed[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
         {
             // Triangle's indices
@@ -2263,9 +2756,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            Vertex_Out& v0{vertices_ss_out[idx0]};
-            Vertex_Out& v1{vertices_ss_out[idx1]};
-            Vertex_Out& v2{vertices_ss_out[idx2]};
+            Vertex_Out& v0{m_VerticesSSOut[idx0]};
+            Vertex_Out& v1{m_VerticesSSOut[idx1]};
+            Vertex_Out& v2{m_VerticesSSOut[idx2]};
 
             // Triangle's vertices' positions
             const Vector4& pos0{v0.position};
@@ -2286,11 +2779,12 @@ namespace dae
             if (maxY >= m_Height) continue;
 
             ColorRGB finalColor{colors::Black};
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
                 {
-                    if (m_CurrentShadingMode == ShadingMode::BoundingBox)
+                    if (m_Settings.currentShadingMode == ShadingMode::BoundingBox)
                     {
                         finalColor = colors::White;
                         UpdateColor(finalColor, px, py);
@@ -2313,9 +2807,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
 
                             // Interpolate View Space depth
                             const float weightedViewSpaceDepthV0{1.0f / pos0.w * weights[0]};
@@ -2330,7 +2824,7 @@ namespace dae
                             const Vector2 uv{(weightedV0UV + weightedV1UV + weightedV2UV) * interpolatedViewSpaceDepth};
                             
                             // Color
-                            if (m_CurrentShadingMode == ShadingMode::DepthBuffer)
+                            if (m_Settings.currentShadingMode == ShadingMode::DepthBuffer)
                             {
                                 const float remappedZBuffer {Remap(interpolatedZBuffer, 0.9f, 1.0f, 0.0f, 1.0f)};
                                 finalColor = ColorRGB{remappedZBuffer, remappedZBuffer, remappedZBuffer};
@@ -2349,13 +2843,13 @@ namespace dae
 
     void Renderer::Render_W3_TODO_6()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV3(meshes_world_list_transformed[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV3(m_MeshesWorldListTransformed[0].vertices, m_VerticesSSOut);
 
-        const std::vector<uint32_t>& indices{meshes_world_list_transformed[0].indices};
+        const std::vector<uint32_t>& indices{m_MeshesWorldListTransformed[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
         {
             // Triangle's indices
@@ -2364,9 +2858,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            Vertex_Out& v0{vertices_ss_out[idx0]};
-            Vertex_Out& v1{vertices_ss_out[idx1]};
-            Vertex_Out& v2{vertices_ss_out[idx2]};
+            Vertex_Out& v0{m_VerticesSSOut[idx0]};
+            Vertex_Out& v1{m_VerticesSSOut[idx1]};
+            Vertex_Out& v2{m_VerticesSSOut[idx2]};
 
             // Triangle's vertices' positions
             const Vector4& pos0{v0.position};
@@ -2387,11 +2881,12 @@ namespace dae
             if (maxY >= m_Height) continue;
 
             ColorRGB finalColor{colors::Black};
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
                 {
-                    if (m_CurrentShadingMode == ShadingMode::BoundingBox)
+                    if (m_Settings.currentShadingMode == ShadingMode::BoundingBox)
                     {
                         finalColor = colors::White;
                         UpdateColor(finalColor, px, py);
@@ -2414,9 +2909,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
 
                             // Interpolate View Space depth - optimized
                             const float weightedViewSpaceDepthV0{pos0.w * weights[0]};
@@ -2431,7 +2926,7 @@ namespace dae
                             const Vector2 uv{(weightedV0UV + weightedV1UV + weightedV2UV) * interpolatedViewSpaceDepth};
                             
                             // Color
-                            if (m_CurrentShadingMode == ShadingMode::DepthBuffer)
+                            if (m_Settings.currentShadingMode == ShadingMode::DepthBuffer)
                             {
                                 const float remappedZBuffer {Remap(interpolatedZBuffer, 0.9f, 1.0f, 0.0f, 1.0f)};
                                 finalColor = ColorRGB{remappedZBuffer, remappedZBuffer, remappedZBuffer};
@@ -2453,13 +2948,13 @@ namespace dae
 #pragma region Week 4
     void Renderer::Render_W4_TODO_0()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV3(meshes_world_list_transformed[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV3(m_MeshesWorldListTransformed[0].vertices, m_VerticesSSOut);
 
-        const std::vector<uint32_t>& indices{meshes_world_list_transformed[0].indices};
+        const std::vector<uint32_t>& indices{m_MeshesWorldListTransformed[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
         {
             // Triangle's indices
@@ -2468,9 +2963,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            Vertex_Out& v0{vertices_ss_out[idx0]};
-            Vertex_Out& v1{vertices_ss_out[idx1]};
-            Vertex_Out& v2{vertices_ss_out[idx2]};
+            Vertex_Out& v0{m_VerticesSSOut[idx0]};
+            Vertex_Out& v1{m_VerticesSSOut[idx1]};
+            Vertex_Out& v2{m_VerticesSSOut[idx2]};
 
             // Triangle's vertices' positions
             const Vector4& pos0{v0.position};
@@ -2491,11 +2986,12 @@ namespace dae
             if (maxY >= m_Height) continue;
 
             ColorRGB finalColor{colors::Black};
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
                 {
-                    if (m_CurrentShadingMode == ShadingMode::BoundingBox)
+                    if (m_Settings.currentShadingMode == ShadingMode::BoundingBox)
                     {
                         finalColor = colors::White;
                         UpdateColor(finalColor, px, py);
@@ -2518,9 +3014,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
 
                             // Interpolate View Space depth - optimized
                             const float weightedViewSpaceDepthV0{pos0.w * weights[0]};
@@ -2535,7 +3031,7 @@ namespace dae
                             const Vector2 uv{(weightedV0UV + weightedV1UV + weightedV2UV) * interpolatedViewSpaceDepth};
                             
                             // Color
-                            if (m_CurrentShadingMode == ShadingMode::DepthBuffer)
+                            if (m_Settings.currentShadingMode == ShadingMode::DepthBuffer)
                             {
                                 const float remappedZBuffer {Remap(interpolatedZBuffer, 0.99885f, 1.0f, 0.0f, 1.0f)};
                                 finalColor = ColorRGB{remappedZBuffer, remappedZBuffer, remappedZBuffer};
@@ -2554,13 +3050,13 @@ namespace dae
     
     void Renderer::Render_W4_TODO_1()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV4(meshes_world_list_transformed[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV4(m_MeshesWorldListTransformed[0].vertices, m_VerticesSSOut);
 
-        const std::vector<uint32_t>& indices{meshes_world_list_transformed[0].indices};
+        const std::vector<uint32_t>& indices{m_MeshesWorldListTransformed[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
         {
             // Triangle's indices
@@ -2569,9 +3065,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            Vertex_Out& v0{vertices_ss_out[idx0]};
-            Vertex_Out& v1{vertices_ss_out[idx1]};
-            Vertex_Out& v2{vertices_ss_out[idx2]};
+            Vertex_Out& v0{m_VerticesSSOut[idx0]};
+            Vertex_Out& v1{m_VerticesSSOut[idx1]};
+            Vertex_Out& v2{m_VerticesSSOut[idx2]};
 
             // Triangle's vertices' positions
             const Vector4& pos0{v0.position};
@@ -2591,13 +3087,14 @@ namespace dae
             if (minY < 0)         continue;
             if (maxY >= m_Height) continue;
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
                 {
                     ColorRGB finalColor{colors::Black};
                     
-                    if (m_CurrentShadingMode == ShadingMode::BoundingBox)
+                    if (m_Settings.currentShadingMode == ShadingMode::BoundingBox)
                     {
                         finalColor = colors::White;
                         UpdateColor(finalColor, px, py);
@@ -2620,9 +3117,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
 
                             // Interpolate View Space depth - optimized
                             const float weightedViewSpaceDepthV0{pos0.w * weights[0]};
@@ -2643,7 +3140,7 @@ namespace dae
                             const Vector3 normal{(weightedV0Normal + weightedV1Normal + weightedV2Normal).Normalized()};
                             
                             // Color
-                            if (m_CurrentShadingMode == ShadingMode::DepthBuffer)
+                            if (m_Settings.currentShadingMode == ShadingMode::DepthBuffer)
                             {
                                 const float remappedZBuffer {Remap(interpolatedZBuffer, 0.99885f, 1.0f, 0.0f, 1.0f)};
                                 finalColor = ColorRGB{remappedZBuffer, remappedZBuffer, remappedZBuffer};
@@ -2667,13 +3164,13 @@ namespace dae
 
     void Renderer::Render_W4_TODO_2()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV4(meshes_world_list_transformed[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV4(m_MeshesWorldListTransformed[0].vertices, m_VerticesSSOut);
 
-        const std::vector<uint32_t>& indices{meshes_world_list_transformed[0].indices};
+        const std::vector<uint32_t>& indices{m_MeshesWorldListTransformed[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
         {
             // Triangle's indices
@@ -2682,9 +3179,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            Vertex_Out& v0{vertices_ss_out[idx0]};
-            Vertex_Out& v1{vertices_ss_out[idx1]};
-            Vertex_Out& v2{vertices_ss_out[idx2]};
+            Vertex_Out& v0{m_VerticesSSOut[idx0]};
+            Vertex_Out& v1{m_VerticesSSOut[idx1]};
+            Vertex_Out& v2{m_VerticesSSOut[idx2]};
 
             // Triangle's vertices' positions
             const Vector4& pos0{v0.position};
@@ -2704,13 +3201,14 @@ namespace dae
             if (minY < 0)         continue;
             if (maxY >= m_Height) continue;
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
                 {
                     ColorRGB finalColor{colors::Black};
                     
-                    if (m_CurrentShadingMode == ShadingMode::BoundingBox)
+                    if (m_Settings.currentShadingMode == ShadingMode::BoundingBox)
                     {
                         finalColor = colors::White;
                         UpdateColor(finalColor, px, py);
@@ -2733,9 +3231,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
 
                             // Interpolate View Space depth - optimized
                             const float weightedViewSpaceDepthV0{pos0.w * weights[0]};
@@ -2768,7 +3266,7 @@ namespace dae
                             const Matrix tangentSpaceAxis{tangent, binormal, normal, Vector3::Zero};
                             
                             // Color
-                            if (m_CurrentShadingMode == ShadingMode::DepthBuffer)
+                            if (m_Settings.currentShadingMode == ShadingMode::DepthBuffer)
                             {
                                 const float remappedZBuffer {Remap(interpolatedZBuffer, 0.99885f, 1.0f, 0.0f, 1.0f)};
                                 finalColor = ColorRGB{remappedZBuffer, remappedZBuffer, remappedZBuffer};
@@ -2801,13 +3299,13 @@ namespace dae
     
     void Renderer::Render_W4_TODO_3()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV4(meshes_world_list_transformed[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV4(m_MeshesWorldListTransformed[0].vertices, m_VerticesSSOut);
 
-        const std::vector<uint32_t>& indices{meshes_world_list_transformed[0].indices};
+        const std::vector<uint32_t>& indices{m_MeshesWorldListTransformed[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
         {
             // Triangle's indices
@@ -2816,9 +3314,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            Vertex_Out& v0{vertices_ss_out[idx0]};
-            Vertex_Out& v1{vertices_ss_out[idx1]};
-            Vertex_Out& v2{vertices_ss_out[idx2]};
+            Vertex_Out& v0{m_VerticesSSOut[idx0]};
+            Vertex_Out& v1{m_VerticesSSOut[idx1]};
+            Vertex_Out& v2{m_VerticesSSOut[idx2]};
 
             // Triangle's vertices' positions
             const Vector4& pos0{v0.position};
@@ -2838,13 +3336,14 @@ namespace dae
             if (minY < 0)         continue;
             if (maxY >= m_Height) continue;
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
                 {
                     ColorRGB finalColor{colors::Black};
                     
-                    if (m_CurrentShadingMode == ShadingMode::BoundingBox)
+                    if (m_Settings.currentShadingMode == ShadingMode::BoundingBox)
                     {
                         finalColor = colors::White;
                         UpdateColor(finalColor, px, py);
@@ -2867,9 +3366,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
 
                             // Interpolate View Space depth - optimized
                             const float weightedViewSpaceDepthV0{pos0.w * weights[0]};
@@ -2902,7 +3401,7 @@ namespace dae
                             const Matrix tangentSpaceAxis{tangent, binormal, normal, Vector3::Zero};
                             
                             // Color
-                            if (m_CurrentShadingMode == ShadingMode::DepthBuffer)
+                            if (m_Settings.currentShadingMode == ShadingMode::DepthBuffer)
                             {
                                 const float remappedZBuffer {Remap(interpolatedZBuffer, 0.99885f, 1.0f, 0.0f, 1.0f)};
                                 finalColor = ColorRGB{remappedZBuffer, remappedZBuffer, remappedZBuffer};
@@ -2938,13 +3437,13 @@ namespace dae
 
     void Renderer::Render_W4_TODO_4()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV4(meshes_world_list_transformed[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV4(m_MeshesWorldListTransformed[0].vertices, m_VerticesSSOut);
 
-        const std::vector<uint32_t>& indices{meshes_world_list_transformed[0].indices};
+        const std::vector<uint32_t>& indices{m_MeshesWorldListTransformed[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
         {
             // Triangle's indices
@@ -2953,9 +3452,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            Vertex_Out& v0{vertices_ss_out[idx0]};
-            Vertex_Out& v1{vertices_ss_out[idx1]};
-            Vertex_Out& v2{vertices_ss_out[idx2]};
+            Vertex_Out& v0{m_VerticesSSOut[idx0]};
+            Vertex_Out& v1{m_VerticesSSOut[idx1]};
+            Vertex_Out& v2{m_VerticesSSOut[idx2]};
 
             // Triangle's vertices' positions
             const Vector4& pos0{v0.position};
@@ -2975,13 +3474,14 @@ namespace dae
             if (minY < 0)         continue;
             if (maxY >= m_Height) continue;
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
                 {
                     ColorRGB finalColor{colors::Black};
                     
-                    if (m_CurrentShadingMode == ShadingMode::BoundingBox)
+                    if (m_Settings.currentShadingMode == ShadingMode::BoundingBox)
                     {
                         finalColor = colors::White;
                         UpdateColor(finalColor, px, py);
@@ -3004,9 +3504,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
 
                             // Interpolate View Space depth - optimized
                             const float weightedViewSpaceDepthV0{pos0.w * weights[0]};
@@ -3039,7 +3539,7 @@ namespace dae
                             const Matrix tangentSpaceAxis{tangent, binormal, normal, Vector3::Zero};
                             
                             // Color
-                            if (m_CurrentShadingMode == ShadingMode::DepthBuffer)
+                            if (m_Settings.currentShadingMode == ShadingMode::DepthBuffer)
                             {
                                 const float remappedZBuffer {Remap(interpolatedZBuffer, 0.99885f, 1.0f, 0.0f, 1.0f)};
                                 finalColor = ColorRGB{remappedZBuffer, remappedZBuffer, remappedZBuffer};
@@ -3080,13 +3580,13 @@ namespace dae
 
     void Renderer::Render_W4_TODO_5()
     {
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, 100, 100, 100));
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(100, 100, 100));
 
-        TransformFromWorldToScreenV4(meshes_world_list_transformed[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV4(m_MeshesWorldListTransformed[0].vertices, m_VerticesSSOut);
 
-        const std::vector<uint32_t>& indices{meshes_world_list_transformed[0].indices};
+        const std::vector<uint32_t>& indices{m_MeshesWorldListTransformed[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
         {
             // Triangle's indices
@@ -3095,9 +3595,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            Vertex_Out& v0{vertices_ss_out[idx0]};
-            Vertex_Out& v1{vertices_ss_out[idx1]};
-            Vertex_Out& v2{vertices_ss_out[idx2]};
+            Vertex_Out& v0{m_VerticesSSOut[idx0]};
+            Vertex_Out& v1{m_VerticesSSOut[idx1]};
+            Vertex_Out& v2{m_VerticesSSOut[idx2]};
 
             // Triangle's vertices' positions
             const Vector4& pos0{v0.position};
@@ -3117,13 +3617,14 @@ namespace dae
             if (minY < 0)         continue;
             if (maxY >= m_Height) continue;
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
                 {
                     ColorRGB finalColor{colors::Black};
                     
-                    if (m_CurrentShadingMode == ShadingMode::BoundingBox)
+                    if (m_Settings.currentShadingMode == ShadingMode::BoundingBox)
                     {
                         finalColor = colors::White;
                         UpdateColor(finalColor, px, py);
@@ -3146,9 +3647,9 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
 
                             // Interpolate View Space depth - optimized
                             const float weightedViewSpaceDepthV0{pos0.w * weights[0]};
@@ -3181,7 +3682,7 @@ namespace dae
                             const Matrix tangentSpaceAxis{tangent, binormal, normal, Vector3::Zero};
                             
                             // Color
-                            if (m_CurrentShadingMode == ShadingMode::DepthBuffer)
+                            if (m_Settings.currentShadingMode == ShadingMode::DepthBuffer)
                             {
                                 // std::cout << interpolatedZBuffer << '\n';
                                 const float remappedZBuffer {Remap(interpolatedZBuffer, 0.99885f, 1.0f, 0.0f, 1.0f)};
@@ -3226,19 +3727,19 @@ namespace dae
     void Renderer::Render_W4_TODO_6()
     {
         // Clear depth buffer
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        m_FrameBufferPtr->ClearDepth(std::numeric_limits<float>::max());
 
         // Background color
-        Uint8 r, g, b;
-        r = static_cast<Uint8>(m_BackgroundColor[0] * 255.0f);
-        g = static_cast<Uint8>(m_BackgroundColor[1] * 255.0f);
-        b = static_cast<Uint8>(m_BackgroundColor[2] * 255.0f);
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, r, g, b));
+        uint8_t r, g, b;
+        r = static_cast<uint8_t>(m_Settings.backgroundColor[0] * 255.0f);
+        g = static_cast<uint8_t>(m_Settings.backgroundColor[1] * 255.0f);
+        b = static_cast<uint8_t>(m_Settings.backgroundColor[2] * 255.0f);
+        m_FrameBufferPtr->ClearColor(FrameBuffer::PackColor(r, g, b));
 
         // Transform vertices from world to screen space
-        TransformFromWorldToScreenV5(meshes_world_list_transformed[0].vertices, vertices_ss_out);
+        TransformFromWorldToScreenV5(m_MeshesWorldListTransformed[0].vertices, m_VerticesSSOut);
 
-        const std::vector<uint32_t>& indices{meshes_world_list_transformed[0].indices};
+        const std::vector<uint32_t>& indices{m_MeshesWorldListTransformed[0].indices};
         for (size_t idx{0}; idx < indices.size(); idx+=3)
         {
             // Triangle's indices
@@ -3247,9 +3748,9 @@ namespace dae
             const uint32_t idx2{indices[idx + 2]};
 
             // Triangle's vertices
-            const Vertex_Out& v0{vertices_ss_out[idx0]};
-            const Vertex_Out& v1{vertices_ss_out[idx1]};
-            const Vertex_Out& v2{vertices_ss_out[idx2]};
+            const Vertex_Out& v0{m_VerticesSSOut[idx0]};
+            const Vertex_Out& v1{m_VerticesSSOut[idx1]};
+            const Vertex_Out& v2{m_VerticesSSOut[idx2]};
 
             if (v0.isFrustumCulled or v1.isFrustumCulled or v2.isFrustumCulled) continue;
 
@@ -3271,13 +3772,14 @@ namespace dae
             if (minY < 0)         continue;
             if (maxY >= m_Height) continue;
 
+            std::array<float, 3> weights{};
             for (int px{minX}; px <= maxX; ++px)
             {
                 for (int py{minY}; py <= maxY; ++py)
                 {
                     ColorRGB finalColor{colors::Black};
                     
-                    if (m_CurrentShadingMode == ShadingMode::BoundingBox)
+                    if (m_Settings.currentShadingMode == ShadingMode::BoundingBox)
                     {
                         finalColor = colors::White;
                         UpdateColor(finalColor, px, py);
@@ -3297,11 +3799,11 @@ namespace dae
 
                         // Z-test
                         const int bufferIdx {GetBufferIndex(px, py)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+                        if (interpolatedZBuffer < m_DepthBufferPixelsPtr[bufferIdx])
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
+                            m_DepthBufferPixelsPtr[bufferIdx] = interpolatedZBuffer;
                             
-                            if (m_CurrentShadingMode == ShadingMode::DepthBuffer)
+                            if (m_Settings.currentShadingMode == ShadingMode::DepthBuffer)
                             {
                                 const float remappedZBuffer {Remap(interpolatedZBuffer, 0.99885f, 1.0f, 0.0f, 1.0f)};
                                 finalColor = remappedZBuffer;
@@ -3357,7 +3859,7 @@ namespace dae
                             
                             // --- PIXEL VERTEX ---
                             Vertex_Out pixelVertex;
-                            pixelVertex.normal = m_UseNormalMap ? normalMap : normal;
+                            pixelVertex.normal = m_Settings.useNormalMap ? normalMap : normal;
                             pixelVertex.viewDirection = (v0.viewDirection * weights[0] + v1.viewDirection * weights[1] + v2.viewDirection * weights[2]).Normalized();
 
                             // Final shading
@@ -3373,264 +3875,480 @@ namespace dae
 
     inline void Renderer::Render_W4_TODO_7()
     {
-        // Clear depth buffer
-        std::fill_n(m_DepthBuffer.begin(), m_DepthBuffer.size(), std::numeric_limits<float>::max());
+        // Every thread's group is read, the workers' chunks of a stage count as much as the render thread's
+        assert(m_HardwareCountersPtrs[0] and "Renderer::Render_W4_TODO_7: InitializeRenderThread was not called");
+        const auto readCounters = [this]()
+        {
+            HardwareCounterValues counters{};
+            for (const HardwareCounters* countersPtr : m_HardwareCountersPtrs)
+            {
+                counters += countersPtr->Read();
+            }
+            return counters;
+        };
+        HardwareCounterValues stageCounters{readCounters()};
+        const auto nextStageCounters = [&readCounters, &stageCounters]()
+        {
+            const HardwareCounterValues counters{readCounters()};
+            const HardwareCounterValues stage{counters - stageCounters};
+            stageCounters = counters;
+            return stage;
+        };
 
-        // Background color
-        Uint8 r, g, b;
-        r = static_cast<Uint8>(m_BackgroundColor[0] * 255.0f);
-        g = static_cast<Uint8>(m_BackgroundColor[1] * 255.0f);
-        b = static_cast<Uint8>(m_BackgroundColor[2] * 255.0f);
-        SDL_FillRect(m_BackBufferPtr, nullptr, SDL_MapRGB(m_BackBufferPtr->format, r, g, b));
+        auto stageStart{Clock::now()};
 
-        // Transform vertices from world to screen space
-        const std::vector<Vertex>& vertices_in = meshes_world_list_transformed[0].vertices;
-        std::vector<Vertex_Out>& vertices_out = vertices_ss_out;
-        for (size_t i{0}; i < vertices_in.size(); ++i)
         {
-            const Vertex& vertex_in = vertices_in[i];
-            Vertex_Out& vertex_out = vertices_out[i];
+            PROFILE_SCOPE("Clear");
+            ALLOCATION_SCOPE("Clear");
 
-            // MODEL/OBJECT
-            const Vector4 positionIn{vertex_in.position.x, vertex_in.position.y, vertex_in.position.z, 1.0f};
-            // WORLD -> VIEW -> PROJECTION
-            const Vector4 projectedPos = (m_Camera.m_InverseViewMatrix * m_Camera.m_ProjectionMatrix).TransformPoint(positionIn);
-            // DEPTH
-            assert(projectedPos.w != 0.0f and "Renderer::TransformFromWorldToScreenV4: Division by zero");
-            vertex_out.position.w = 1.0f / projectedPos.w;
-            // NDC
-            vertex_out.position.x = projectedPos.x * vertex_out.position.w;
-            vertex_out.position.y = projectedPos.y * vertex_out.position.w;
-            vertex_out.position.z = projectedPos.z * vertex_out.position.w;
-            vertex_out.position.z = 1.0f / vertex_out.position.z;
-            // SCREEN
-            vertex_out.position.x = (vertex_out.position.x + 1.0f) * m_HalfWidth;
-            vertex_out.position.y = (1.0f - vertex_out.position.y) * m_HalfHeight;
-            // UV
-            vertex_out.uv = vertex_in.uv;
-            // WORLD NORMAL
-            vertex_out.normal = vertex_in.normal;
-            // WORLD TANGENT
-            vertex_out.tangent = vertex_in.tangent;
-            // VIEW-DIRECTION
-            vertex_out.viewDirection = vertex_in.position - m_Camera.GetPosition();
+            // Clear depth buffer, only flags the tiles
+            if (m_DepthBufferPtr->GetFormat() != m_Settings.depthFormat)
+            {
+                m_DepthBufferPtr->SetFormat(m_Settings.depthFormat);
+            }
+            m_DepthBufferPtr->SetDepthRange(m_Camera.GetNearPlane(), m_Camera.GetFarPlane());
+            m_DepthBufferPtr->Clear();
+
+            // Background color, goes through the same tone mapping as the shaded pixels in the resolve
+            const ColorRGB backgroundColor{m_Settings.backgroundColor[0], m_Settings.backgroundColor[1], m_Settings.backgroundColor[2]};
+            m_HdrBufferPtr->ClearDeferred(backgroundColor, m_ViewportWidth, m_ViewportHeight);
         }
 
-        const std::vector<uint32_t>& indices{meshes_world_list_transformed[0].indices};
-        for (size_t idx{0}; idx < indices.size(); idx+=3)
+        m_FrameTimings.clear = MillisecondsSince(stageStart);
+        m_StageCounters.clear = nextStageCounters();
+        stageStart = Clock::now();
+
+        // A mesh entirely outside the frustum skips the vertex, setup and raster work, the resolve still runs
+        const Mesh& mesh{m_MeshesWorldListTransformed[0]};
+        const bool isMeshVisible{m_Camera.IsBoxVisible(mesh.bounds.Transformed(mesh.worldMatrix))};
+
+        // Transform vertices from world to screen space, vertices are independent so they are spread over the workers
+        const std::vector<Vertex>& vertices_in = mesh.vertices;
+        Vertex_Out* vertices_out = m_FrameArenaPtr->GetMain().Allocate<Vertex_Out>(vertices_in.size());
+        const Matrix worldViewProjection{m_Camera.GetViewProjectionMatrix()};
+        const StridedSpan<const Vector3> positions_in{std::span{vertices_in}, &Vertex::position};
+        const StridedSpan<Vector4> positions_out{std::span{vertices_out, vertices_in.size()}, &Vertex_Out::position};
+        m_JobSystemPtr->ParallelFor(isMeshVisible ? static_cast<uint32_t>(vertices_in.size()) : 0, 1024, [&](uint32_t begin, uint32_t end, uint32_t workerIndex)
         {
-            // Triangle's indices
-            const uint32_t idx0{indices[idx]};
-            const uint32_t idx1{indices[idx + 1]};
-            const uint32_t idx2{indices[idx + 2]};
+            // One zone per batch, shows up on the worker that ran it
+            PROFILE_SCOPE("Vertex");
+            ALLOCATION_SCOPE("Vertex");
+            m_WorkerStats[workerIndex].verticesTransformed += end - begin;
 
-            // Triangle's vertices
-            const Vertex_Out& vert0{vertices_ss_out[idx0]};
-            const Vertex_Out& vert1{vertices_ss_out[idx1]};
-            const Vertex_Out& vert2{vertices_ss_out[idx2]};
+            // MODEL/OBJECT -> WORLD -> VIEW -> PROJECTION, the whole batch at once
+            worldViewProjection.TransformPointsToClip(positions_in.subspan(begin, end - begin), positions_out.subspan(begin, end - begin));
 
-            // Triangle's vertices' positions
-            const Vector4& pos0{vert0.position};
-            const Vector4& pos1{vert1.position};
-            const Vector4& pos2{vert2.position};
+            for (size_t i{begin}; i < end; ++i)
+            {
+                const Vertex& vertex_in = vertices_in[i];
+                Vertex_Out& vertex_out = vertices_out[i];
+
+                const Vector4 projectedPos = vertex_out.position;
+                // DEPTH
+                assert(projectedPos.w != 0.0f and "Renderer::TransformFromWorldToScreenV4: Division by zero");
+                vertex_out.position.w = 1.0f / projectedPos.w;
+                // NDC
+                vertex_out.position.x = projectedPos.x * vertex_out.position.w;
+                vertex_out.position.y = projectedPos.y * vertex_out.position.w;
+                vertex_out.position.z = projectedPos.z * vertex_out.position.w;
+                vertex_out.position.z = 1.0f / vertex_out.position.z;
+                // SCREEN
+                vertex_out.position.x = (vertex_out.position.x + 1.0f) * m_ViewportHalfWidth;
+                vertex_out.position.y = (1.0f - vertex_out.position.y) * m_ViewportHalfHeight;
+                // UV
+                vertex_out.uv = vertex_in.uv;
+                // WORLD NORMAL
+                vertex_out.normal = vertex_in.normal;
+                // WORLD TANGENT
+                vertex_out.tangent = vertex_in.tangent;
+                // VIEW-DIRECTION
+                vertex_out.viewDirection = vertex_in.position - m_Camera.GetPosition();
+            }
+        });
 
-            // Create bounding box + stretch by 1 pixel
-            constexpr int offset{1};
-            const int minX {static_cast<int>(std::min(pos0.x, std::min(pos1.x, pos2.x))) - offset};
-            const int maxX {static_cast<int>(std::max(pos0.x, std::max(pos1.x, pos2.x))) + offset};
-            const int minY {static_cast<int>(std::min(pos0.y, std::min(pos1.y, pos2.y))) - offset};
-            const int maxY {static_cast<int>(std::max(pos0.y, std::max(pos1.y, pos2.y))) + offset};
+        m_FrameTimings.vertex = MillisecondsSince(stageStart);
+        m_StageCounters.vertex = nextStageCounters();
+        stageStart = Clock::now();
 
-            // Clamp bounding box
-            if (minX < 0)         continue;
-            if (maxX >= m_Width)  continue;
-            if (minY < 0)         continue;
-            if (maxY >= m_Height) continue;
+        // Raster runs on this thread, it counts into its own slot
+        PipelineStats& stats{m_WorkerStats[m_JobSystemPtr->GetCurrentWorkerIndex()]};
 
-            for (int px{minX}; px <= maxX; ++px)
+        // Heatmap modes count per pixel on the side, the null pointers / false keep the normal path at one branch
+        const ShadingMode shadingMode{m_Settings.currentShadingMode};
+        const bool isHeatmap{shadingMode == ShadingMode::Overdraw or shadingMode == ShadingMode::PixelTests or shadingMode == ShadingMode::ShadingCost};
+        if (isHeatmap)
+        {
+            m_HeatmapPtr->Clear();
+        }
+        uint32_t* overdrawHeatPtr{shadingMode == ShadingMode::Overdraw ? m_HeatmapPtr->GetData() : nullptr};
+        const bool measureShading{shadingMode == ShadingMode::ShadingCost};
+        // Reciprocals, normalizations and the Phong lobe per pixel, see FastMath.h
+        const MathPrecision precision{m_Settings.mathPrecision};
+
+        // Triangle setup: bounding boxes and culling in one pass, the raster loop only sees what survived.
+        // Triangles are independent here as well, each batch keeps its survivors in the sub-arena of the worker that ran it
+        const std::vector<uint32_t>& indices{mesh.indices};
+        const uint32_t triangleCount{isMeshVisible ? static_cast<uint32_t>(indices.size() / 3) : 0};
+        const uint32_t batchCount{(triangleCount + s_SetupBatchSize - 1) / s_SetupBatchSize};
+        SetupBatch* batches{m_FrameArenaPtr->GetMain().Allocate<SetupBatch>(batchCount)};
+
+        stats.trianglesSubmitted += indices.size() / 3;
+        if (not isMeshVisible)
+        {
+            stats.trianglesFrustumCulled += indices.size() / 3;
+        }
+        m_JobSystemPtr->ParallelFor(triangleCount, s_SetupBatchSize, [&](uint32_t begin, uint32_t end, uint32_t workerIndex)
+        {
+            PROFILE_SCOPE("Setup");
+            ALLOCATION_SCOPE("Setup");
+            PipelineStats& workerStats{m_WorkerStats[workerIndex]};
+            LinearArena& workerArena{m_FrameArenaPtr->GetWorker(workerIndex)};
+            // Survivors are collected in the worker's scratch memory, the arena only gets the ones that are kept
+            TriangleSetup* stagedTriangles{reinterpret_cast<TriangleSetup*>(m_JobSystemPtr->GetScratchMemory(workerIndex))};
+
+            // A serial run gets the whole range in one call, the batch table still needs one entry per batch
+            for (uint32_t batchBegin{begin}; batchBegin < end; batchBegin += s_SetupBatchSize)
             {
-                for (int py{minY}; py <= maxY; ++py)
+                const uint32_t batchEnd{std::min(batchBegin + s_SetupBatchSize, end)};
+                uint32_t count{0};
+                for (uint32_t triangleIdx{batchBegin}; triangleIdx < batchEnd; ++triangleIdx)
                 {
-                    ColorRGB finalColor{colors::Black};
-                    
-                    if (m_CurrentShadingMode == ShadingMode::BoundingBox)
+                    const size_t idx{static_cast<size_t>(triangleIdx) * 3};
+                    const Vector4& pos0{vertices_out[indices[idx]].position};
+                    const Vector4& pos1{vertices_out[indices[idx + 1]].position};
+                    const Vector4& pos2{vertices_out[indices[idx + 2]].position};
+
+                    // Depth is linear in 1/w and so is its interpolation: all corners on the same side, no pixel is inside
+                    const float depth0{m_DepthBufferPtr->GetReversedDepth(pos0.w)};
+                    const float depth1{m_DepthBufferPtr->GetReversedDepth(pos1.w)};
+                    const float depth2{m_DepthBufferPtr->GetReversedDepth(pos2.w)};
+                    if ((depth0 < 0.0f and depth1 < 0.0f and depth2 < 0.0f) or (depth0 > 1.0f and depth1 > 1.0f and depth2 > 1.0f))
                     {
-                        finalColor = colors::White;
-                        UpdateColor(finalColor, px, py);
+                        ++workerStats.trianglesFrustumCulled;
                         continue;
                     }
-                    
-                    const Vector2 pixel{static_cast<float>(px) + 0.5f, static_cast<float>(py) + 0.5f};
 
-                    bool triangle;
-                    float area;
-                    Vector2 v0v1, v1v2, v2v0;
-                    const Vector2& point = pixel;
-                    const Vector2& v0 = pos0.GetXY();
-                    const Vector2& v1 = pos1.GetXY();
-                    const Vector2& v2 = pos2.GetXY();
-                    std::array<float,3>& inlined_weights = weights;
-                    if (point == v0 or point == v1 or point == v2) {
-                        triangle = true;
-                        goto triangle_initialization_finish;
-                    }
-                    v0v1 = v1 - v0;
-                    v1v2 = v2 - v1;
-                    v2v0 = v0 - v2;
-                    inlined_weights[0] = Vector2::Cross(v1v2, point - v1);
-                    inlined_weights[1] = Vector2::Cross(v2v0, point - v2);
-                    inlined_weights[2] = Vector2::Cross(v0v1, point - v0);
-                    if (inlined_weights[0] < 0) {
-                        triangle = false;
-                        goto triangle_initialization_finish;
-                    }
-                    if (inlined_weights[1] < 0) {
-                        triangle = false;
-                        goto triangle_initialization_finish;
+                    // Same edge function as the coverage test: only a positive area can have pixels inside
+                    const float signedArea{Vector2::Cross(pos1.GetXY() - pos0.GetXY(), pos2.GetXY() - pos1.GetXY())};
+                    if (signedArea == 0.0f)
+                    {
+                        ++workerStats.trianglesDegenerate;
+                        continue;
                     }
-                    if (inlined_weights[2] < 0) {
-                        triangle = false;
-                        goto triangle_initialization_finish;
+                    if (signedArea < 0.0f)
+                    {
+                        ++workerStats.trianglesBackfaceCulled;
+                        continue;
                     }
-                    area = 1.0f / Vector2::Cross(v0v1, v1v2);
-                    inlined_weights[0] *= area;
-                    inlined_weights[1] *= area;
-                    inlined_weights[2] *= area;
-                    triangle = true;
-                triangle_initialization_finish:
-                    
-                    // Point - Triangle test
-                    if (triangle)
+
+                    // Create bounding box + stretch by 1 pixel
+                    constexpr int offset{1};
+                    const int minX {static_cast<int>(std::min(pos0.x, std::min(pos1.x, pos2.x))) - offset};
+                    const int maxX {static_cast<int>(std::max(pos0.x, std::max(pos1.x, pos2.x))) + offset};
+                    const int minY {static_cast<int>(std::min(pos0.y, std::min(pos1.y, pos2.y))) - offset};
+                    const int maxY {static_cast<int>(std::max(pos0.y, std::max(pos1.y, pos2.y))) + offset};
+
+                    // Clamp bounding box
+                    if (minX < 0 or maxX >= m_ViewportWidth or minY < 0 or maxY >= m_ViewportHeight)
                     {
-                        // Interpolate Z-Buffer - optimized
-                        const float weightedZBufferV0{pos0.z * weights[0]};
-                        const float weightedZBufferV1{pos1.z * weights[1]};
-                        const float weightedZBufferV2{pos2.z * weights[2]};
-                        const float interpolatedZBuffer{1.0f / (weightedZBufferV0 + weightedZBufferV1 + weightedZBufferV2)};
+                        ++workerStats.trianglesOffScreen;
+                        continue;
+                    }
 
-                        // Frustum culling
-                        if (interpolatedZBuffer < 0.0f or interpolatedZBuffer > 1.0f) continue;
+                    stagedTriangles[count++] = {static_cast<uint32_t>(idx), minX, minY, maxX, maxY};
+                }
+                TriangleSetup* triangles{workerArena.Allocate<TriangleSetup>(count)};
+                std::copy_n(stagedTriangles, count, triangles);
+                batches[batchBegin / s_SetupBatchSize] = {triangles, count};
+            }
+        });
 
-                        // Z-test
-                        const int bufferIdx {px + (py * m_Width)};
-                        if (interpolatedZBuffer < m_DepthBuffer[bufferIdx])
+        m_FrameTimings.setup = MillisecondsSince(stageStart);
+        m_StageCounters.setup = nextStageCounters();
+        stageStart = Clock::now();
+
+        // Shading is inlined per pixel, it is part of the raster zone
+        {
+            PROFILE_SCOPE("Raster");
+            ALLOCATION_SCOPE("Raster");
+
+            // Counted in registers, added to the stats once
+            uint64_t pixelsTested{0};
+            uint64_t pixelsCovered{0};
+            uint64_t depthTestsPassed{0};
+            uint64_t pixelsShaded{0};
+
+            for (uint32_t batchIdx{0}; batchIdx < batchCount; ++batchIdx)
+            {
+                const SetupBatch& batch{batches[batchIdx]};
+                for (uint32_t triangleIdx{0}; triangleIdx < batch.count; ++triangleIdx)
+                {
+                    const TriangleSetup& triangle_setup{batch.trianglesPtr[triangleIdx]};
+                    const int minX{triangle_setup.minX};
+                    const int minY{triangle_setup.minY};
+                    const int maxX{triangle_setup.maxX};
+                    const int maxY{triangle_setup.maxY};
+
+                    // First touch of a tile writes its clear values, the tiles are shared so this stays out of the parallel setup
+                    m_DepthBufferPtr->PrepareTiles(minX, minY, maxX, maxY);
+                    m_HdrBufferPtr->PrepareTiles(minX, minY, maxX, maxY);
+
+                    // Triangle's vertices
+                    const Vertex_Out& vert0{vertices_out[indices[triangle_setup.firstIndex]]};
+                    const Vertex_Out& vert1{vertices_out[indices[triangle_setup.firstIndex + 1]]};
+                    const Vertex_Out& vert2{vertices_out[indices[triangle_setup.firstIndex + 2]]};
+
+                    // Triangle's vertices' positions
+                    const Vector4& pos0{vert0.position};
+                    const Vector4& pos1{vert1.position};
+                    const Vector4& pos2{vert2.position};
+
+                    pixelsTested += static_cast<uint64_t>(maxX - minX + 1) * static_cast<uint64_t>(maxY - minY + 1);
+                    if (shadingMode == ShadingMode::PixelTests)
+                    {
+                        m_HeatmapPtr->AddRect(minX, minY, maxX, maxY);
+                    }
+                    // The triangle's own, nothing the raster loop writes is shared between triangles
+                    std::array<float, 3> weights{};
+                    for (int px{minX}; px <= maxX; ++px)
+                    {
+                        for (int py{minY}; py <= maxY; ++py)
                         {
-                            m_DepthBuffer[bufferIdx] = interpolatedZBuffer;
-                            
-                            if (m_CurrentShadingMode == ShadingMode::DepthBuffer)
+                            ColorRGB finalColor{colors::Black};
+                    
+                            if (m_Settings.currentShadingMode == ShadingMode::BoundingBox)
                             {
-                                const float remappedZBuffer {Remap(interpolatedZBuffer, 0.99885f, 1.0f, 0.0f, 1.0f)};
-                                finalColor = remappedZBuffer;
-                                UpdateColor(finalColor, px, py);
+                                finalColor = colors::White;
+                                m_HdrBufferPtr->Write(px + (py * m_Width), finalColor);
                                 continue;
                             }
+                    
+                            const Vector2 pixel{static_cast<float>(px) + 0.5f, static_cast<float>(py) + 0.5f};
+
+                            bool triangle;
+                            float area;
+                            Vector2 v0v1, v1v2, v2v0;
+                            const Vector2& point = pixel;
+                            const Vector2& v0 = pos0.GetXY();
+                            const Vector2& v1 = pos1.GetXY();
+                            const Vector2& v2 = pos2.GetXY();
+                            std::array<float,3>& inlined_weights = weights;
+                            if (point == v0 or point == v1 or point == v2) {
+                                triangle = true;
+                                goto triangle_initialization_finish;
+                            }
+                            v0v1 = v1 - v0;
+                            v1v2 = v2 - v1;
+                            v2v0 = v0 - v2;
+                            inlined_weights[0] = Vector2::Cross(v1v2, point - v1);
+                            inlined_weights[1] = Vector2::Cross(v2v0, point - v2);
+                            inlined_weights[2] = Vector2::Cross(v0v1, point - v0);
+                            if (inlined_weights[0] < 0) {
+                                triangle = false;
+                                goto triangle_initialization_finish;
+                            }
+                            if (inlined_weights[1] < 0) {
+                                triangle = false;
+                                goto triangle_initialization_finish;
+                            }
+                            if (inlined_weights[2] < 0) {
+                                triangle = false;
+                                goto triangle_initialization_finish;
+                            }
+                            area = Reciprocal(Vector2::Cross(v0v1, v1v2), precision);
+                            inlined_weights[0] *= area;
+                            inlined_weights[1] *= area;
+                            inlined_weights[2] *= area;
+                            triangle = true;
+                        triangle_initialization_finish:
+                    
+                            // Point - Triangle test
+                            if (triangle)
+                            {
+                                ++pixelsCovered;
 
-                            // Interpolate View Space depth - optimized
-                            const float weightedViewSpaceDepthV0{pos0.w * weights[0]};
-                            const float weightedViewSpaceDepthV1{pos1.w * weights[1]};
-                            const float weightedViewSpaceDepthV2{pos2.w * weights[2]};
-                            const float interpolatedViewSpaceDepth{1.0f / (weightedViewSpaceDepthV0 + weightedViewSpaceDepthV1 + weightedViewSpaceDepthV2)};
-
-                            // Interpolate UV - optimized
-                            const Vector2 weightedV0UV{vert0.uv * pos0.w * weights[0]};
-                            const Vector2 weightedV1UV{vert1.uv * pos1.w * weights[1]};
-                            const Vector2 weightedV2UV{vert2.uv * pos2.w * weights[2]};
-                            const Vector2 uv{(weightedV0UV + weightedV1UV + weightedV2UV) * interpolatedViewSpaceDepth};
-                            
-                            // --- TEXTURE ---
-                            // Diffuse
-                            const ColorRGB diffuseColor{m_DiffuseTexturePtr->Sample(uv)};
-                            // Normal map
-                            ColorRGB normalMapColor{m_NormalTexturePtr->Sample(uv)};
-                            // Glossiness
-                            const float glossiness{m_GlossinessTexturePtr->Sample(uv).r};
-                            // Specular
-                            const ColorRGB specularColor{m_SpecularTexturePtr->Sample(uv)};
-
-                            // --- NORMAL ---
-                            // Interpolate Normal + Normalization
-                            const Vector3 weightedV0Normal{vert0.normal * weights[0]};
-                            const Vector3 weightedV1Normal{vert1.normal * weights[1]};
-                            const Vector3 weightedV2Normal{vert2.normal * weights[2]};
-                            const Vector3 normal{(weightedV0Normal + weightedV1Normal + weightedV2Normal).Normalized()};
-
-                            // Interpolate Tangent + Normalization
-                            const Vector3 weightedV0Tangent{vert0.tangent * weights[0]};
-                            const Vector3 weightedV1Tangent{vert1.tangent * weights[1]};
-                            const Vector3 weightedV2Tangent{vert2.tangent * weights[2]};
-                            const Vector3 tangent{(weightedV0Tangent + weightedV1Tangent + weightedV2Tangent).Normalized()};
+                                // Interpolate 1/w, linear in screen space
+                                const float weightedInvWV0{pos0.w * weights[0]};
+                                const float weightedInvWV1{pos1.w * weights[1]};
+                                const float weightedInvWV2{pos2.w * weights[2]};
+                                const float interpolatedInvW{weightedInvWV0 + weightedInvWV1 + weightedInvWV2};
 
-                            // Binormal
-                            const Vector3 binormal{Vector3::Cross(normal, tangent)};
+                                // Frustum culling
+                                const float reversedDepth{m_DepthBufferPtr->GetReversedDepth(interpolatedInvW)};
+                                if (reversedDepth < 0.0f or reversedDepth > 1.0f) continue;
 
-                            // Tangent-space transformation matrix
-                            const Matrix tangentSpaceAxis{tangent, binormal, normal, Vector3::Zero};
+                                // Z-test
+                                const int bufferIdx {px + (py * m_Width)};
+                                if (m_DepthBufferPtr->TestAndWrite(bufferIdx, interpolatedInvW))
+                                {
+                                    ++depthTestsPassed;
+                                    if (overdrawHeatPtr)
+                                    {
+                                        ++overdrawHeatPtr[bufferIdx];
+                                    }
+
+                                    // View Space depth
+                                    const float interpolatedViewSpaceDepth{Reciprocal(interpolatedInvW, precision)};
+
+                                    if (m_Settings.currentShadingMode == ShadingMode::DepthBuffer)
+                                    {
+                                        // Linear between the planes, no hand-tuned range needed
+                                        const float remappedZBuffer {Remap(interpolatedViewSpaceDepth, m_Camera.GetNearPlane(), m_Camera.GetFarPlane(), 0.0f, 1.0f)};
+                                        finalColor = remappedZBuffer;
+                                        m_HdrBufferPtr->Write(px + (py * m_Width), finalColor);
+                                        continue;
+                                    }
+
+                                    ++pixelsShaded;
+                                    const uint64_t shadingStart{measureShading ? ReadCycleCounter() : 0};
+
+                                    // Interpolate UV - optimized
+                                    const Vector2 weightedV0UV{vert0.uv * pos0.w * weights[0]};
+                                    const Vector2 weightedV1UV{vert1.uv * pos1.w * weights[1]};
+                                    const Vector2 weightedV2UV{vert2.uv * pos2.w * weights[2]};
+                                    const Vector2 uv{(weightedV0UV + weightedV1UV + weightedV2UV) * interpolatedViewSpaceDepth};
                             
-                            // Remap from [0, 1] to [-1, 1]
-                            normalMapColor = 2.0f * normalMapColor - colors::White;
-                            // Transform to tangent space, where normal and tangent of the vertex are defined in the world space
-                            const Vector3 normalMap{tangentSpaceAxis.TransformVector({normalMapColor.r, normalMapColor.g, normalMapColor.b})};
+                                    // --- TEXTURE ---
+                                    // Diffuse
+                                    const ColorRGB diffuseColor{m_DiffuseTexturePtr->Sample(uv)};
+                                    // Normal map
+                                    ColorRGB normalMapColor{m_NormalTexturePtr->Sample(uv)};
+                                    // Glossiness
+                                    const float glossiness{m_GlossinessTexturePtr->Sample(uv).r};
+                                    // Specular
+                                    const ColorRGB specularColor{m_SpecularTexturePtr->Sample(uv)};
+
+                                    // --- NORMAL ---
+                                    // Interpolate Normal + Normalization
+                                    const Vector3 weightedV0Normal{vert0.normal * weights[0]};
+                                    const Vector3 weightedV1Normal{vert1.normal * weights[1]};
+                                    const Vector3 weightedV2Normal{vert2.normal * weights[2]};
+                                    const Vector3 normal{Normalized(weightedV0Normal + weightedV1Normal + weightedV2Normal, precision)};
+
+                                    // Interpolate Tangent + Normalization
+                                    const Vector3 weightedV0Tangent{vert0.tangent * weights[0]};
+                                    const Vector3 weightedV1Tangent{vert1.tangent * weights[1]};
+                                    const Vector3 weightedV2Tangent{vert2.tangent * weights[2]};
+                                    const Vector3 tangent{Normalized(weightedV0Tangent + weightedV1Tangent + weightedV2Tangent, precision)};
+
+                                    // Binormal
+                                    const Vector3 binormal{Vector3::Cross(normal, tangent)};
+
+                                    // Tangent-space transformation matrix
+                                    const Matrix tangentSpaceAxis{tangent, binormal, normal, Vector3::Zero};
                             
-                            // --- PIXEL VERTEX ---
-                            Vertex_Out pixelVertex;
-                            pixelVertex.normal = m_UseNormalMap ? normalMap : normal;
-                            pixelVertex.viewDirection = (vert0.viewDirection * weights[0] + vert1.viewDirection * weights[1] + vert2.viewDirection * weights[2]).Normalized();
-
-                            // Final shading
-                            {
-                                const Vertex_Out& vertex = pixelVertex;
-                                // Light
-                                Light light;
-                                light.direction = Vector3{m_LightDirection[0], m_LightDirection[1], m_LightDirection[2]}.Normalized();
-                                light.intensity = m_LightIntensity;
-
-                                // Observed area
-                                const float observedArea{Vector3::Dot(vertex.normal, -light.direction)};
+                                    // Remap from [0, 1] to [-1, 1]
+                                    normalMapColor = 2.0f * normalMapColor - colors::White;
+                                    // Transform to tangent space, where normal and tangent of the vertex are defined in the world space
+                                    const Vector3 normalMap{tangentSpaceAxis.TransformVector({normalMapColor.r, normalMapColor.g, normalMapColor.b})};
+                            
+                                    // --- PIXEL VERTEX ---
+                                    Vertex_Out pixelVertex;
+                                    pixelVertex.normal = m_Settings.useNormalMap ? normalMap : normal;
+                                    pixelVertex.viewDirection = Normalized(vert0.viewDirection * weights[0] + vert1.viewDirection * weights[1] + vert2.viewDirection * weights[2], precision);
+
+                                    // Final shading
+                                    {
+                                        const Vertex_Out& vertex = pixelVertex;
+                                        // Light
+                                        Light light;
+                                        light.direction = Normalized(Vector3{m_Settings.lightDirection[0], m_Settings.lightDirection[1], m_Settings.lightDirection[2]}, precision);
+                                        light.intensity = m_Settings.lightIntensity;
+
+                                        // Observed area
+                                        const float observedArea{Vector3::Dot(vertex.normal, -light.direction)};
+
+                                        if (observedArea < 0) goto ShadePixelV3_exit;
+
+                                        // Lambert
+                                        const ColorRGB lambert{diffuseColor * m_Settings.kd / PI};
+
+                                        // Phong
+                                        const Vector3 reflectedLight{Vector3::Reflect(-light.direction, vertex.normal)};
+                                        const float cosAlpha{std::max(0.0f, Vector3::Dot(reflectedLight, vertex.viewDirection))};
+                                        const ColorRGB phong{specularColor * Pow(cosAlpha, glossiness * m_Settings.shininess, precision)};
+
+                                        switch (m_Settings.currentShadingMode)
+                                        {
+                                        case ShadingMode::ObservedArea:
+                                            finalColor = observedArea;
+                                            break;
+                                        case ShadingMode::Diffuse:
+                                            finalColor = lambert * observedArea;
+                                            break;
+                                        case ShadingMode::Specular:
+                                            finalColor = phong * observedArea;
+                                            break;
+                                        // Heatmaps replace the frame afterwards, the full shading keeps the measured cost real
+                                        case ShadingMode::Overdraw:
+                                        case ShadingMode::PixelTests:
+                                        case ShadingMode::ShadingCost:
+                                        case ShadingMode::Combined:
+                                            finalColor = light.color * light.intensity * (m_Settings.ambient + lambert + phong) * observedArea;
+                                            break;
+                                        }
+                                    }
+                                ShadePixelV3_exit:
+
+                                    // Linear and unclamped, the resolve tone maps and packs it
+                                    m_HdrBufferPtr->Write(bufferIdx, finalColor);
+
+                                    if (measureShading)
+                                    {
+                                        const uint64_t cycles{ReadCycleCounter() - shadingStart};
+                                        m_HeatmapPtr->Add(bufferIdx, static_cast<uint32_t>(std::min<uint64_t>(cycles, UINT32_MAX)));
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
 
-                                if (observedArea < 0) goto ShadePixelV3_exit;
+            stats.pixelsTested     += pixelsTested;
+            stats.pixelsCovered    += pixelsCovered;
+            stats.depthTestsPassed += depthTestsPassed;
+            stats.pixelsShaded     += pixelsShaded;
+        }
 
-                                // Lambert
-                                const ColorRGB lambert{diffuseColor * m_KD / PI};
+        m_FrameTimings.raster = MillisecondsSince(stageStart);
+        m_StageCounters.raster = nextStageCounters();
+        stageStart = Clock::now();
 
-                                // Phong
-                                const Vector3 reflectedLight{Vector3::Reflect(-light.direction, vertex.normal)};
-                                const float cosAlpha{std::max(0.0f, Vector3::Dot(reflectedLight, vertex.viewDirection))};
-                                const ColorRGB phong{specularColor * pow(cosAlpha, glossiness * m_Shininess)};
+        // Tone map and pack the HDR buffer into the back buffer, tiles no triangle touched only have their clear flag
+        {
+            PROFILE_SCOPE("Resolve");
+            ALLOCATION_SCOPE("Resolve");
 
-                                switch (m_CurrentShadingMode)
-                                {
-                                case ShadingMode::ObservedArea:
-                                    finalColor = observedArea;
-                                    break;
-                                case ShadingMode::Diffuse:
-                                    finalColor = lambert * observedArea;
-                                    break;
-                                case ShadingMode::Specular:
-                                    finalColor = phong * observedArea;
-                                    break;
-                                case ShadingMode::Combined:
-                                    finalColor = light.color * light.intensity * (m_Ambient + lambert + phong) * observedArea;
-                                    break;
-                                }
-                            }
-                        ShadePixelV3_exit:
+            const HdrBuffer::ResolveSettings resolveSettings{m_Settings.toneMapping, m_Settings.encodeSRGB};
+            m_JobSystemPtr->ParallelFor(static_cast<uint32_t>(m_ViewportHeight), 16, [&](uint32_t begin, uint32_t end, uint32_t)
+            {
+                PROFILE_SCOPE("Resolve");
+                ALLOCATION_SCOPE("Resolve");
+                m_HdrBufferPtr->Resolve(m_BackBufferPixelsPtr, static_cast<int>(begin), static_cast<int>(end), resolveSettings);
+            });
 
-                            {
-                                //Update Color in Buffer
-                                const float maxValue = std::max(finalColor.r, std::max(finalColor.g, finalColor.b));
-                                if (maxValue > 1.f)
-                                    finalColor /= maxValue;
-
-                                m_BackBufferPixelsPtr[px + (py * m_Width)] = SDL_MapRGB(m_BackBufferPtr->format,
-                                                                                        static_cast<uint8_t>(finalColor.r * 255),
-                                                                                        static_cast<uint8_t>(finalColor.g * 255),
-                                                                                        static_cast<uint8_t>(finalColor.b * 255));
-                            }
-                        }
-                    }
+            if (isHeatmap)
+            {
+                switch (shadingMode)
+                {
+                case ShadingMode::Overdraw:
+                    m_HeatMax = s_OverdrawHeatMax;
+                    break;
+                case ShadingMode::PixelTests:
+                    m_HeatMax = s_PixelTestsHeatMax;
+                    break;
+                default:
+                    // Cycles depend on the machine, there is no fixed scale
+                    m_HeatMax = m_HeatmapPtr->GetPercentile(m_ViewportWidth, m_ViewportHeight, 99.0f);
+                    break;
                 }
+                m_HeatmapPtr->Resolve(m_BackBufferPixelsPtr, m_ViewportWidth, m_ViewportHeight, m_HeatMax);
             }
         }
+
+        m_FrameTimings.resolve = MillisecondsSince(stageStart);
+        m_StageCounters.resolve = nextStageCounters();
     }
 
 #pragma endregion
@@ -0,0 +1,383 @@
+#pragma once
+
+// Project includes
+#include "Camera.h"
+#include "DataTypes.h"
+#include "DepthBuffer.h"
+#include "FastMath.h"
+#include "HdrBuffer.h"
+#include "HardwareCounters.h"
+#include "PipelineStats.h"
+#include "SceneSelector.h"
+
+// Standard includes
+#include <cstdint>
+#include <vector>
+#include <string>
+
+namespace dae
+{
+    // Forward Declarations
+    class DynamicResolution;
+    class FrameArena;
+    class FrameBuffer;
+    class Heatmap;
+    class ImageLoader;
+    class JobSystem;
+    class Texture;
+    class Scene;
+
+    class Renderer final
+    {
+        // The microbenchmarks time the transform and shading variants in isolation (Benchmarks/src/RendererBenchmarks.cpp)
+        friend struct RendererKernels;
+        // Records and replays the pending camera and settings (Recording.h)
+        friend class Recording;
+
+    private:
+        enum class PrimitiveTopology
+        {
+            TriangleList,
+            TriangleStrip
+        };
+
+    public:
+        enum class ShadingMode
+        {
+            // Heatmaps, the frame is shaded as before and then replaced by a per-pixel counter
+            Overdraw = -5, // Depth-test passes
+            PixelTests,    // Bounding box pixels tested
+            ShadingCost,   // Cycles spent shading (including pixels drawn over later)
+
+            BoundingBox,
+            DepthBuffer,
+            ObservedArea, // Lambert Cosine Law
+            Diffuse,
+            Specular, 
+            Combined, // (Diffuse + Specular) * ObservedArea
+
+            COUNT = 4
+        };
+
+    private:
+        /**
+         * \brief Everything the UI and the key bindings can change.
+         * The main thread edits a pending copy, the render thread reads a frame copy
+         * that is only refreshed at frame boundaries (see BeginFrame).
+         */
+        struct Settings
+        {
+            ShadingMode previousShadingMode {ShadingMode::Combined};
+            ShadingMode currentShadingMode  {ShadingMode::Combined};
+
+            bool useNormalMap {true};
+            bool rotate       {true};
+
+            float ambient[3]        {0.03f, 0.03f, 0.03f}; // 8, 8, 8
+            float lightDirection[3] {0.577f,  -0.577f, 0.577f}; 
+            float lightIntensity    {1.0f};
+            float kd                {7.0f}; // Diffuse  reflection coefficient
+            float shininess         {25.0f};
+
+            float backgroundColor[3] {0.3921f, 0.3921f, 0.3921f}; // 100, 100, 100
+
+            DepthFormat depthFormat {DepthFormat::Float32ReversedZ};
+
+            // Off by default so offline rendering stays deterministic
+            bool  dynamicResolution  {false};
+            float frameBudgetMs      {16.6f}; // Raster time, not frame time
+            float minResolutionScale {0.5f};
+
+            // Exact keeps the images bit for bit, see FastMath.h
+            MathPrecision mathPrecision {MathPrecision::Exact};
+
+            // Resolve of the final vehicle path's HdrBuffer, MaxToOne without sRGB is what shading packed per pixel before
+            ToneMapping toneMapping {ToneMapping::MaxToOne};
+            bool        encodeSRGB  {false};
+        };
+
+    public:
+        // CPU time per stage of one frame (ms), clear/vertex/raster/resolve are only split up by the final vehicle path
+        struct FrameTimings
+        {
+            float update  {0.0f};
+            float clear   {0.0f};
+            float vertex  {0.0f};
+            float setup   {0.0f}; // Bounding boxes, culling, tile preparation
+            float raster  {0.0f}; // Includes shading, it is inlined in the triangle loop
+            float resolve {0.0f};
+            float render  {0.0f}; // Whole Render()
+        };
+
+        // Hardware counters per stage, summed over the render thread and the workers. Only the final vehicle path samples them (see HardwareCounters.h)
+        struct StageCounters
+        {
+            HardwareCounterValues clear   {};
+            HardwareCounterValues vertex  {};
+            HardwareCounterValues setup   {};
+            HardwareCounterValues raster  {};
+            HardwareCounterValues resolve {};
+        };
+
+        // Internal resolution of the last finished frame
+        struct ResolutionStats
+        {
+            float scale    {1.0f};
+            int   width    {0};
+            int   height   {0};
+            float rasterMs {0.0f};
+        };
+
+        Renderer(int width, int height, const ImageLoader& imageLoader);
+        ~Renderer();
+
+        Renderer(const Renderer&)                = delete;
+        Renderer(Renderer&&) noexcept            = delete;
+        Renderer& operator=(const Renderer&)     = delete;
+        Renderer& operator=(Renderer&&) noexcept = delete;
+
+        // Call on the thread that renders, before its first frame
+        void InitializeRenderThread();
+        void UpdateHeadless(float elapsedSec);
+        void Render();
+        void CreateUI();
+
+        // Frame pipelining
+        void BeginFrame(float elapsedSec);
+        void RenderFrame();
+        void EndFrame();
+
+        inline Camera& GetCamera()                       { return m_PendingCamera; }
+        inline const FrameBuffer& GetFrameBuffer() const { return *m_FrameBufferPtrs[m_FrontBufferIndex]; }
+        inline bool HasUI()                        const { return W4 and (TODO_6 or TODO_7); }
+        inline bool IsBenchmarking()               const { return m_StartBenchmark; }
+        inline bool IsTakingScreenshot()           const { return m_TakeScreenshot; }
+        inline bool IsCapturingSequence()          const { return m_CaptureSequence; }
+        inline bool IsDynamicResolutionEnabled()   const { return m_PendingSettings.dynamicResolution; }
+        inline float GetFrameBudget()              const { return m_PendingSettings.frameBudgetMs; }
+        inline MathPrecision GetMathPrecision()    const { return m_PendingSettings.mathPrecision; }
+        inline uint64_t GetSteadyStateArenaAllocations() const { return m_SteadyStateArenaAllocations; }
+        // Heap allocations of every thread between the frame boundaries, see AllocationTracker.h
+        inline uint64_t GetSteadyStateHeapAllocations()  const { return m_SteadyStateHeapAllocations; }
+        inline const ResolutionStats& GetResolutionStats() const { return m_ResolutionStats; }
+        inline const FrameTimings&    GetFrameTimings()    const { return m_LastFrameTimings; }
+        inline const PipelineStats&   GetPipelineStats()   const { return m_LastPipelineStats; }
+        inline const StageCounters&   GetStageCounters()   const { return m_LastStageCounters; }
+        uint32_t GetWorkerCount() const;
+        // Shading mode and depth format of the final vehicle path, they change what a frame costs
+        std::string GetRenderPathVariant() const;
+        // Compiled scene (see SceneSelector.h), e.g. "W4_TODO_7"
+        static std::string GetSceneName();
+        static const char* GetShadingModeName(ShadingMode shadingMode);
+        // The render thread's group, nullptr until the first frame that sampled the counters has finished
+        inline const HardwareCounters* GetHardwareCounters() const { return m_LastHardwareCountersPtr; }
+
+        // Setters
+        void ToggleDepthBufferVisibility();
+        void ToggleBoundingBoxVisibility();
+        void ToggleNormalVisibility();
+        void ToggleRotation();
+        void CycleShadingMode();
+        void CycleHeatmap();
+        void SetShadingMode(ShadingMode shadingMode);
+        void SetDynamicResolution(bool isEnabled, float frameBudgetMs);
+        void SetMathPrecision(MathPrecision precision);
+        void SetColorResolve(ToneMapping toneMapping, bool encodeSRGB);
+        void ResetTimeline();
+        
+        inline void StartBenchmark()       { m_StartBenchmark = true;  }
+        inline void StopBenchmark()        { m_StartBenchmark = false; }
+        inline void TakeScreenshot()       { m_TakeScreenshot = true;  }
+        inline void StopTakingScreenshot() { m_TakeScreenshot = false; }
+        inline void ToggleSequenceCapture() { m_CaptureSequence = not m_CaptureSequence; }
+
+    private:
+        // Initialization
+        void InitializeCamera();
+        void InitializeOutputVertices();
+        void InitializeTextures(const ImageLoader& imageLoader);
+
+        // Animation
+        void UpdateMeshes(float elapsedSec);
+
+        // Vertex Transformation
+        void TransformFromWorldToScreenV1( const std::vector<Vertex>& vertices_in, std::vector<Vertex>&     vertices_out) const;
+        void TransformFromWorldToScreenV2( const std::vector<Vertex>& vertices_in, std::vector<Vertex_Out>& vertices_out) const;
+        void TransformFromWorldToScreenV3( const std::vector<Vertex>& vertices_in, std::vector<Vertex_Out>& vertices_out) const;
+        void TransformFromWorldToScreenV4( const std::vector<Vertex>& vertices_in, std::vector<Vertex_Out>& vertices_out) const;
+        void TransformFromWorldToScreenV5( const std::vector<Vertex>& vertices_in, std::vector<Vertex_Out>& vertices_out) const;
+        void TransformFromNDCtoScreenSpace(const std::vector<Vertex>& vertices_in, std::vector<Vertex>&     vertices_out) const;
+        
+        // Helper functions
+        void SetViewport(int width, int height);
+        int GetBufferIndex(int x, int y) const;
+        void UpdateColor(ColorRGB& finalColor, int px, int py) const;
+        void UpdateCurrentShadingModeText();
+        void CreateProfilerUI() const;
+
+        // Shading
+        void ShadePixelV0(const Vertex_Out& vertex, ColorRGB& finalColor) const;
+        void ShadePixelV1(const Vertex_Out& vertex, ColorRGB& finalColor, const  ColorRGB& diffuseColor = colors::White) const;
+        void ShadePixelV2(const Vertex_Out& vertex, ColorRGB& finalColor, const  ColorRGB& diffuseColor = colors::White, const  ColorRGB& specularColor = colors::White, float glossiness = 0.0f) const;
+        void ShadePixelV3(const Vertex_Out& vertex, ColorRGB& finalColor, const  ColorRGB& diffuseColor = colors::White, const  ColorRGB& specularColor = colors::White, float glossiness = 0.0f) const;
+        
+        // --- Week 1 ---
+        void Render_W1_TODO_0() const;
+        void Render_W1_TODO_1();
+        void Render_W1_TODO_2();
+        void Render_W1_TODO_3();
+        void Render_W1_TODO_4();
+        void Render_W1_TODO_5();
+
+        // --- Week 2 ---
+        void Render_W2_TODO_1();
+        void Render_W2_TODO_2();
+        void Render_W2_TODO_3();
+        void Render_W2_TODO_4();
+        void Render_W2_TODO_5();
+
+        // --- Week 3 ---
+        void Render_W3_TODO_0();
+        void Render_W3_TODO_1();
+        void Render_W3_TODO_2();
+        void Render_W3_TODO_3();
+        void Render_W3_TODO_4();
+        void Render_W3_TODO_5();
+        void Render_W3_TODO_6();
+
+        // --- Week 4 ---
+        void Render_W4_TODO_0();
+        void Render_W4_TODO_1();
+        void Render_W4_TODO_2();
+        void Render_W4_TODO_3();
+        void Render_W4_TODO_4();
+        void Render_W4_TODO_5();
+        void Render_W4_TODO_6();
+        inline void Render_W4_TODO_7();
+
+    private:
+        // Double buffered: the render thread fills the back buffer while the front buffer is presented
+        FrameBuffer* m_FrameBufferPtrs[2]   {nullptr, nullptr};
+        FrameBuffer* m_FrameBufferPtr       {nullptr}; // Back buffer
+        uint32_t*    m_BackBufferPixelsPtr  {nullptr};
+        float*       m_DepthBufferPixelsPtr {nullptr};
+        int          m_FrontBufferIndex     {1};
+
+        JobSystem*  m_JobSystemPtr  {nullptr};
+        FrameArena* m_FrameArenaPtr {nullptr}; // Transient per-frame pipeline data, reset in Render
+
+        // Final vehicle path: culled triangles with their bounding box, set up in batches on the workers
+        struct TriangleSetup
+        {
+            uint32_t firstIndex;
+            int      minX, minY, maxX, maxY;
+        };
+        struct SetupBatch
+        {
+            const TriangleSetup* trianglesPtr;
+            uint32_t             count;
+        };
+        static constexpr uint32_t s_SetupBatchSize {1024};
+
+        // SS = Screen Space. Output vertices and the animated meshes of the week paths, sized once in InitializeOutputVertices.
+        // The final vehicle path takes its output vertices from the frame arena
+        std::vector<Vertex>     m_VerticesSS                 {};
+        std::vector<Vertex_Out> m_VerticesSSOut              {};
+        std::vector<Mesh>       m_MeshesWorldListTransformed {};
+        DepthBuffer* m_DepthBufferPtr {nullptr}; // Used by the final vehicle path, the others keep the float depth of the FrameBuffer
+        HdrBuffer*   m_HdrBufferPtr   {nullptr}; // Linear color of the final vehicle path, resolved into the back buffer
+
+        // Heatmap shading modes of the final vehicle path, counts are mapped to red at the max
+        static constexpr uint32_t s_OverdrawHeatMax   {8};
+        static constexpr uint32_t s_PixelTestsHeatMax {64};
+        Heatmap* m_HeatmapPtr     {nullptr};
+        uint32_t m_HeatMax        {0}; // Render thread, shading cost uses the frame's max
+        uint32_t m_LastHeatMax    {0}; // Copied in EndFrame for the UI
+
+        // Render thread, picks the viewport of the next frame from the raster time of this one
+        DynamicResolution* m_DynamicResolutionPtr {nullptr};
+        ResolutionStats    m_ResolutionStats      {}; // Copied in EndFrame for the UI
+
+        FrameTimings m_FrameTimings     {}; // Render thread
+        FrameTimings m_LastFrameTimings {}; // Last finished frame, copied in EndFrame
+
+        std::vector<PipelineStats> m_WorkerStats       {}; // One per job system worker, merged at the end of Render
+        PipelineStats              m_PipelineStats     {}; // Render thread
+        PipelineStats              m_LastPipelineStats {}; // Last finished frame, copied in EndFrame
+
+        // A group only counts the thread that opens it: one per job system worker, opened by the worker itself as it starts.
+        // Slot 0 belongs to the render thread and is opened in InitializeRenderThread
+        std::vector<HardwareCounters*> m_HardwareCountersPtrs    {};
+        const HardwareCounters*        m_LastHardwareCountersPtr {nullptr}; // Copied in EndFrame for the UI
+        StageCounters                  m_StageCounters           {}; // Render thread
+        StageCounters                  m_LastStageCounters       {}; // Last finished frame, copied in EndFrame
+
+        // Frames kept by the "Capture Chrome trace" button
+        static constexpr uint32_t s_TraceFrames {120};
+
+        // The first frames may still grow the arena (and create the lazy resources), after that the frame loop must not touch the heap anymore
+        static constexpr uint64_t s_WarmUpFrames {2};
+        uint64_t m_RenderedFrames              {0};
+        uint64_t m_SteadyStateArenaAllocations {0};
+        uint64_t m_SteadyStateHeapAllocations  {0};
+
+        // General texture
+        Texture* m_TexturePtr {nullptr};
+
+        // Vehicle
+        Texture* m_DiffuseTexturePtr    {nullptr};
+        Texture* m_GlossinessTexturePtr {nullptr};
+        Texture* m_NormalTexturePtr     {nullptr};
+        Texture* m_SpecularTexturePtr   {nullptr};
+
+        // Path
+#if CUSTOM_PATH
+        const std::string m_ResourcesPath         {"../_Resources/"};
+#else
+        const std::string m_ResourcesPath         {"Resources/"};
+#endif
+        const std::string m_DiffuseTexturePath    {m_ResourcesPath + "vehicle_diffuse.png"};
+        const std::string m_GlossinessTexturePath {m_ResourcesPath + "vehicle_gloss.png"};
+        const std::string m_NormalTexturePath     {m_ResourcesPath + "vehicle_normal.png"};
+        const std::string m_SpecularTexturePath   {m_ResourcesPath + "vehicle_specular.png"};
+        const std::string m_TuktukTexturePath     {m_ResourcesPath + "tuktuk.png"};
+        const std::string m_UVGridTexturePath     {m_ResourcesPath + "uv_grid.png"};
+        const std::string m_UVGrid2TexturePath    {m_ResourcesPath + "uv_grid_2.png"};
+        const std::string m_VehiclePath           {m_ResourcesPath + "vehicle.obj"};
+        const std::string m_TuktukPath            {m_ResourcesPath + "tuktuk.obj"};
+
+        // Debug
+        bool m_TakeScreenshot       {false};
+        bool m_CaptureSequence      {false};
+        bool m_StartBenchmark       {false};
+
+        // Frame copies (render thread) and pending copies (main thread)
+        Camera   m_Camera          {};
+        Camera   m_PendingCamera   {};
+        Settings m_Settings        {};
+        Settings m_PendingSettings {};
+        float    m_FrameElapsedSec {0.0f};
+        bool     m_PendingTimelineReset {false};
+
+        // Animation
+        float   m_RotationAngleDeg {5.0f};
+        float   m_RotationAngleRad {1.0f};
+        float   m_RotationSpeed    {10.0f};
+        float   m_AccTime          {0.0f};
+        Matrix  m_Transform        {};
+        Vector3 m_Translation      {0.0f,  0.0f, 0.0f};
+
+        int   m_Width      {0};
+        int   m_Height     {0};
+        float m_HalfWidth  {0.0f};
+        float m_HalfHeight {0.0f};
+
+        // Top-left region of the back buffer that is rendered this frame (only the final vehicle path scales it)
+        int   m_ViewportWidth      {0};
+        int   m_ViewportHeight     {0};
+        float m_ViewportHalfWidth  {0.0f};
+        float m_ViewportHalfHeight {0.0f};
+
+        std::string m_CurrentShadingModeAsText {"COMBINED"};
+    };
+}
@@ -0,0 +1,80 @@
+#include "gtest/gtest.h"
+#include "AllocationTracker.h"
+
+#include <memory>
+#include <string_view>
+#include <vector>
+
+
+namespace dae
+{
+	namespace
+	{
+		const TaggedAllocationCounts* FindTag(const AllocationFrame& frame, const char* tag)
+		{
+			for (int idx{0}; idx < frame.tagCount; ++idx)
+			{
+				if (std::string_view{frame.tags[idx].tag} == tag) return &frame.tags[idx];
+			}
+			return nullptr;
+		}
+	}
+
+	TEST(AllocationTracker, TagsAreComparedByContent) {
+		// Registered names are kept, they need static storage
+		static const char copy[]{"SameName"};
+		EXPECT_EQ(AllocationTracker::GetTagIndex("SameName"), AllocationTracker::GetTagIndex(copy));
+		EXPECT_NE(AllocationTracker::GetTagIndex("SameName"), AllocationTracker::GetTagIndex("OtherName"));
+		EXPECT_EQ(AllocationTracker::GetTagIndex(nullptr), 0);
+	}
+
+	TEST(AllocationTracker, ScopeBooksOperatorNew) {
+		if constexpr (not AllocationTracker::IsEnabled()) GTEST_SKIP() << "ENABLE_ALLOCATION_TRACKING is 0";
+
+		const int outerTagIndex{AllocationTracker::GetCurrentTagIndex()};
+		AllocationTracker::EndFrame();
+		{
+			ALLOCATION_SCOPE("ScopeTest");
+			const auto valuePtr{std::make_unique<double>(1.0)};
+			EXPECT_NE(valuePtr, nullptr);
+		}
+		EXPECT_EQ(AllocationTracker::GetCurrentTagIndex(), outerTagIndex);
+		AllocationTracker::EndFrame();
+
+		const AllocationFrame& frame{AllocationTracker::GetLastFrame()};
+		const TaggedAllocationCounts* tagPtr{FindTag(frame, "ScopeTest")};
+		ASSERT_NE(tagPtr, nullptr);
+		EXPECT_EQ(tagPtr->allocations, 1u);
+		EXPECT_EQ(tagPtr->bytes, sizeof(double));
+		EXPECT_GE(frame.total.allocations, 1u);
+		EXPECT_GE(frame.total.frees, 1u);
+
+		// Only the last frame is reported
+		AllocationTracker::EndFrame();
+		EXPECT_EQ(FindTag(AllocationTracker::GetLastFrame(), "ScopeTest")->allocations, 0u);
+	}
+
+	TEST(AllocationTracker, TaggedAllocatorIgnoresTheScope) {
+		AllocationTracker::EndFrame();
+		{
+			ALLOCATION_SCOPE("OuterScope");
+			std::vector<int, TaggedAllocator<int>> values{TaggedAllocator<int>{"VectorTag"}};
+			values.reserve(100);
+			values.push_back(1);
+			EXPECT_EQ(values.capacity(), 100u);
+		}
+		AllocationTracker::EndFrame();
+
+		const AllocationFrame& frame{AllocationTracker::GetLastFrame()};
+		const TaggedAllocationCounts* tagPtr{FindTag(frame, "VectorTag")};
+		ASSERT_NE(tagPtr, nullptr);
+		EXPECT_EQ(tagPtr->allocations, 1u);
+		EXPECT_EQ(tagPtr->bytes, 100 * sizeof(int));
+		EXPECT_GE(frame.total.frees, 1u);
+
+		// Entering the scope registered its tag, the allocator's tag took the allocation
+		const TaggedAllocationCounts* outerPtr{FindTag(frame, "OuterScope")};
+		ASSERT_NE(outerPtr, nullptr);
+		EXPECT_EQ(outerPtr->allocations, 0u);
+	}
+}
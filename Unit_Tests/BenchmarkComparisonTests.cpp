@@ -0,0 +1,62 @@
+#include "gtest/gtest.h"
+#include "BenchmarkComparison.h"
+
+#include <random>
+
+
+namespace dae
+{
+	namespace
+	{
+		// Noisy frame times around a mean
+		BenchmarkResults CreateRun(double meanMs, uint32_t seed)
+		{
+			std::mt19937 generator{seed};
+			std::normal_distribution<double> noise{0.0, meanMs * 0.02};
+
+			BenchmarkResults results{{"frame"}};
+			for (int frame{0}; frame < 200; ++frame)
+			{
+				results.AddFrame({meanMs + noise(generator)});
+			}
+			return results;
+		}
+
+		MetricComparison CompareFrame(const BenchmarkResults& baseline, const BenchmarkResults& candidate)
+		{
+			const std::vector<MetricComparison> comparisons{BenchmarkComparison::Compare(baseline, candidate, {})};
+			EXPECT_EQ(comparisons.size(), 1u);
+			return comparisons.empty() ? MetricComparison{} : comparisons.front();
+		}
+	}
+
+	TEST(BenchmarkComparison, NoiseIsUnchanged) {
+		const MetricComparison comparison{CompareFrame(CreateRun(10.0, 1), CreateRun(10.0, 2))};
+		EXPECT_EQ(comparison.verdict, MetricComparison::Verdict::Unchanged);
+		EXPECT_LT(comparison.lowerPercent, comparison.upperPercent);
+		EXPECT_NEAR(comparison.deltaPercent, 0.0, 1.0);
+	}
+
+	TEST(BenchmarkComparison, FlagsRegressionsAndImprovements) {
+		const BenchmarkResults baseline{CreateRun(10.0, 1)};
+
+		const MetricComparison slower{CompareFrame(baseline, CreateRun(11.0, 2))};
+		EXPECT_EQ(slower.verdict, MetricComparison::Verdict::Regression);
+		EXPECT_NEAR(slower.deltaPercent, 10.0, 1.0);
+		EXPECT_GT(slower.lowerPercent, 0.0);
+		EXPECT_LE(slower.lowerPercent, slower.deltaPercent);
+		EXPECT_GE(slower.upperPercent, slower.deltaPercent);
+
+		const MetricComparison faster{CompareFrame(baseline, CreateRun(9.0, 2))};
+		EXPECT_EQ(faster.verdict, MetricComparison::Verdict::Improvement);
+		EXPECT_TRUE(BenchmarkComparison::HasRegression({slower, faster}));
+		EXPECT_FALSE(BenchmarkComparison::HasRegression({faster}));
+	}
+
+	TEST(BenchmarkComparison, SmallEffectIsNotARegression) {
+		// Significant with this little noise, but below the minimum effect of 1%
+		const MetricComparison comparison{CompareFrame(CreateRun(10.0, 1), CreateRun(10.05, 1))};
+		EXPECT_GT(comparison.lowerPercent, 0.0);
+		EXPECT_EQ(comparison.verdict, MetricComparison::Verdict::Unchanged);
+	}
+}
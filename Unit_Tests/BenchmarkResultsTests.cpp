@@ -0,0 +1,71 @@
+#include "gtest/gtest.h"
+#include "BenchmarkResults.h"
+
+#include <sstream>
+
+
+namespace dae
+{
+	namespace
+	{
+		BenchmarkResults CreateResults()
+		{
+			BenchmarkResults results{{"frame", "raster"}};
+			results.SetMetadata("scene", "W4_TODO_7");
+			results.SetMetadata("cpu", "Some \"quoted\" CPU, 8 cores");
+			results.AddFrame({16.5, 10.25});
+			results.AddFrame({17.0, 11.0});
+			return results;
+		}
+
+		void ExpectEqual(const BenchmarkResults& actual, const BenchmarkResults& expected)
+		{
+			EXPECT_EQ(actual.GetAllMetadata(), expected.GetAllMetadata());
+			EXPECT_EQ(actual.GetMetricNames(), expected.GetMetricNames());
+			ASSERT_EQ(actual.GetFrameCount(), expected.GetFrameCount());
+			for (size_t frame{0}; frame < expected.GetFrameCount(); ++frame)
+			{
+				EXPECT_EQ(actual.GetFrame(frame), expected.GetFrame(frame));
+			}
+		}
+	}
+
+	TEST(BenchmarkResults, JSONRoundTrip) {
+		const BenchmarkResults results{CreateResults()};
+		std::stringstream stream{};
+		results.WriteJSON(stream);
+
+		BenchmarkResults loaded{};
+		ASSERT_TRUE(BenchmarkResults::ReadJSON(stream, loaded));
+		ExpectEqual(loaded, results);
+		EXPECT_EQ(loaded.GetSamples("raster"), (std::vector<double>{10.25, 11.0}));
+		EXPECT_TRUE(loaded.GetSamples("vertex").empty());
+	}
+
+	TEST(BenchmarkResults, CSVRoundTrip) {
+		const BenchmarkResults results{CreateResults()};
+		std::stringstream stream{};
+		results.WriteCSV(stream);
+
+		BenchmarkResults loaded{};
+		ASSERT_TRUE(BenchmarkResults::ReadCSV(stream, loaded));
+		ExpectEqual(loaded, results);
+		EXPECT_EQ(loaded.GetMetadata("scene"), "W4_TODO_7");
+	}
+
+	TEST(BenchmarkResults, ReadRejectsMalformedFiles) {
+		BenchmarkResults results{CreateResults()};
+
+		std::stringstream truncated{R"({"metrics": ["frame"], "frames": [[1.0], )"};
+		EXPECT_FALSE(BenchmarkResults::ReadJSON(truncated, results));
+
+		std::stringstream wrongWidth{R"({"metrics": ["frame", "raster"], "frames": [[1.0]]})"};
+		EXPECT_FALSE(BenchmarkResults::ReadJSON(wrongWidth, results));
+
+		std::stringstream notANumber{"frame,raster\n1.0,abc\n"};
+		EXPECT_FALSE(BenchmarkResults::ReadCSV(notANumber, results));
+
+		// Untouched on failure
+		EXPECT_EQ(results.GetFrameCount(), 2u);
+	}
+}
@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+#include "DepthBuffer.h"
+
+
+namespace dae
+{
+	TEST(DepthBuffer, ReversedDepthMapsNearToOneAndFarToZero) {
+		DepthBuffer depthBuffer{16, 16};
+		depthBuffer.SetDepthRange(0.1f, 100.0f);
+
+		EXPECT_NEAR(depthBuffer.GetReversedDepth(1.0f / 0.1f), 1.0f, 1e-5f);
+		EXPECT_NEAR(depthBuffer.GetReversedDepth(1.0f / 100.0f), 0.0f, 1e-6f);
+		EXPECT_LT(depthBuffer.GetReversedDepth(1.0f / 200.0f), 0.0f);
+	}
+
+	TEST(DepthBuffer, Float32KeepsTheClosestSample) {
+		DepthBuffer depthBuffer{16, 16, DepthFormat::Float32ReversedZ};
+		depthBuffer.SetDepthRange(0.1f, 100.0f);
+		depthBuffer.Clear();
+		depthBuffer.PrepareTiles(0, 0, 15, 15);
+
+		EXPECT_TRUE(depthBuffer.TestAndWrite(0, 1.0f / 50.0f));
+		EXPECT_TRUE(depthBuffer.TestAndWrite(0, 1.0f / 10.0f));
+		EXPECT_FALSE(depthBuffer.TestAndWrite(0, 1.0f / 20.0f));
+		EXPECT_FALSE(depthBuffer.TestAndWrite(0, 1.0f / 10.0f));
+		EXPECT_NEAR(depthBuffer.GetViewDepth(0, 0), 10.0f, 1e-3f);
+	}
+
+	TEST(DepthBuffer, Unorm16KeepsTheClosestSample) {
+		DepthBuffer depthBuffer{16, 16, DepthFormat::Unorm16Linear};
+		depthBuffer.SetDepthRange(0.1f, 100.0f);
+		depthBuffer.Clear();
+		depthBuffer.PrepareTiles(0, 0, 15, 15);
+
+		EXPECT_EQ(depthBuffer.GetBytesPerPixel(), 2);
+		EXPECT_TRUE(depthBuffer.TestAndWrite(5, 1.0f / 50.0f));
+		EXPECT_TRUE(depthBuffer.TestAndWrite(5, 1.0f / 10.0f));
+		EXPECT_FALSE(depthBuffer.TestAndWrite(5, 1.0f / 20.0f));
+		// Linear storage: the step is (far - near) / 65535 everywhere
+		EXPECT_NEAR(depthBuffer.GetViewDepth(5, 0), 10.0f, 100.0f / 65535.0f);
+	}
+
+	TEST(DepthBuffer, ClearOnlyTouchesPreparedTiles) {
+		DepthBuffer depthBuffer{32, 32};
+		depthBuffer.SetDepthRange(1.0f, 10.0f);
+		depthBuffer.Clear();
+
+		// Write in the first tile, the second tile is never prepared and reads as the far plane
+		depthBuffer.PrepareTiles(0, 0, 3, 3);
+		EXPECT_TRUE(depthBuffer.TestAndWrite(0, 1.0f / 2.0f));
+		EXPECT_NEAR(depthBuffer.GetViewDepth(0, 0), 2.0f, 1e-4f);
+		EXPECT_EQ(depthBuffer.GetViewDepth(DepthBuffer::s_TileSize, 0), 10.0f);
+
+		// After a clear the written tile reads as the far plane again, and passes the test once prepared
+		depthBuffer.Clear();
+		EXPECT_EQ(depthBuffer.GetViewDepth(0, 0), 10.0f);
+		depthBuffer.PrepareTiles(0, 0, 0, 0);
+		EXPECT_TRUE(depthBuffer.TestAndWrite(0, 1.0f / 5.0f));
+		EXPECT_NEAR(depthBuffer.GetViewDepth(0, 0), 5.0f, 1e-4f);
+	}
+
+	TEST(DepthBuffer, PrepareTilesClampsToTheBuffer) {
+		DepthBuffer depthBuffer{10, 10};
+		depthBuffer.SetDepthRange(1.0f, 10.0f);
+		depthBuffer.Clear();
+		depthBuffer.PrepareTiles(-5, -5, 50, 50);
+
+		EXPECT_TRUE(depthBuffer.TestAndWrite(9 + 9 * 10, 1.0f / 3.0f));
+		EXPECT_NEAR(depthBuffer.GetViewDepth(9, 9), 3.0f, 1e-4f);
+	}
+
+	TEST(DepthBuffer, SetFormatClears) {
+		DepthBuffer depthBuffer{16, 16};
+		depthBuffer.SetDepthRange(1.0f, 10.0f);
+		depthBuffer.PrepareTiles(0, 0, 15, 15);
+		depthBuffer.TestAndWrite(0, 1.0f / 2.0f);
+
+		depthBuffer.SetFormat(DepthFormat::Unorm16Linear);
+		EXPECT_EQ(depthBuffer.GetFormat(), DepthFormat::Unorm16Linear);
+		EXPECT_EQ(depthBuffer.GetViewDepth(0, 0), 10.0f);
+	}
+}
@@ -0,0 +1,92 @@
+#include "gtest/gtest.h"
+#include "DynamicResolution.h"
+
+
+namespace dae
+{
+	namespace
+	{
+		// Raster cost proportional to the pixel count
+		float SimulateRasterMs(const DynamicResolution& resolution, float msPerMegapixel)
+		{
+			return static_cast<float>(resolution.GetWidth() * resolution.GetHeight()) / 1'000'000.0f * msPerMegapixel;
+		}
+	}
+
+	TEST(DynamicResolution, StartsAtFullResolution) {
+		const DynamicResolution resolution{640, 480};
+
+		EXPECT_EQ(resolution.GetWidth(), 640);
+		EXPECT_EQ(resolution.GetHeight(), 480);
+		EXPECT_EQ(resolution.GetScale(), 1.0f);
+	}
+
+	TEST(DynamicResolution, ConvergesBelowTheBudget) {
+		DynamicResolution resolution{640, 480};
+		resolution.SetBudget(10.0f);
+		resolution.SetScaleRange(0.25f, 1.0f);
+
+		// 640x480 costs ~18.4 ms, so about 70% of the pixels fit
+		constexpr float msPerMegapixel{60.0f};
+		for (int frame{0}; frame < 200; ++frame)
+		{
+			resolution.Update(SimulateRasterMs(resolution, msPerMegapixel));
+		}
+
+		const float rasterMs{SimulateRasterMs(resolution, msPerMegapixel)};
+		EXPECT_LE(rasterMs, 10.0f);
+		EXPECT_GE(rasterMs, 8.0f);
+		EXPECT_EQ(resolution.GetWidth() % 8, 0);
+		EXPECT_NEAR(static_cast<float>(resolution.GetWidth()) / resolution.GetHeight(), 640.0f / 480.0f, 0.02f);
+
+		// Settled: no more changes
+		EXPECT_FALSE(resolution.Update(rasterMs));
+	}
+
+	TEST(DynamicResolution, RespectsTheMinimumScale) {
+		DynamicResolution resolution{640, 480};
+		resolution.SetBudget(1.0f);
+		resolution.SetScaleRange(0.5f, 1.0f);
+
+		for (int frame{0}; frame < 200; ++frame)
+		{
+			resolution.Update(100.0f);
+		}
+
+		EXPECT_EQ(resolution.GetWidth(), 320);
+		EXPECT_EQ(resolution.GetHeight(), 240);
+	}
+
+	TEST(DynamicResolution, ScalesBackUpWhenThereIsHeadroom) {
+		DynamicResolution resolution{640, 480};
+		resolution.SetBudget(10.0f);
+		resolution.SetScaleRange(0.25f, 1.0f);
+
+		for (int frame{0}; frame < 100; ++frame)
+		{
+			resolution.Update(SimulateRasterMs(resolution, 200.0f));
+		}
+		ASSERT_LT(resolution.GetWidth(), 640);
+
+		for (int frame{0}; frame < 200; ++frame)
+		{
+			resolution.Update(SimulateRasterMs(resolution, 5.0f));
+		}
+		EXPECT_EQ(resolution.GetWidth(), 640);
+		EXPECT_EQ(resolution.GetHeight(), 480);
+	}
+
+	TEST(DynamicResolution, ResetGoesBackToFullResolution) {
+		DynamicResolution resolution{640, 480};
+		resolution.SetBudget(1.0f);
+		for (int frame{0}; frame < 20; ++frame)
+		{
+			resolution.Update(100.0f);
+		}
+		ASSERT_LT(resolution.GetWidth(), 640);
+
+		resolution.Reset();
+		EXPECT_EQ(resolution.GetWidth(), 640);
+		EXPECT_EQ(resolution.GetHeight(), 480);
+	}
+}
@@ -0,0 +1,71 @@
+#include "gtest/gtest.h"
+#include "FastMath.h"
+
+#include <cfloat>
+#include <cmath>
+
+
+namespace dae
+{
+	// The bounds documented in FastMath.h, checked over a range instead of a few points
+	TEST(FastMath, WithinDocumentedError) {
+		double rsqrtError{0.0}, reciprocalError{0.0}, log2Error{0.0};
+		for (float x{1e-4f}; x < 1e4f; x *= 1.001f)
+		{
+			rsqrtError      = std::fmax(rsqrtError, std::fabs(FastRsqrt(x) * std::sqrt(static_cast<double>(x)) - 1.0));
+			reciprocalError = std::fmax(reciprocalError, std::fabs(FastReciprocal(x) * static_cast<double>(x) - 1.0));
+		}
+		for (float x{0.5f}; x < 2.0f; x += 1e-4f)
+		{
+			log2Error = std::fmax(log2Error, std::fabs(FastLog2(x) - std::log2(static_cast<double>(x))));
+		}
+		EXPECT_LT(rsqrtError, 3e-7);
+		EXPECT_LT(reciprocalError, 2e-7);
+		EXPECT_LT(log2Error, 1e-7);
+
+		double exp2Error{0.0};
+		for (float x{-100.0f}; x < 100.0f; x += 0.01f)
+		{
+			exp2Error = std::fmax(exp2Error, std::fabs(FastExp2(x) / std::exp2(static_cast<double>(x)) - 1.0));
+		}
+		EXPECT_LT(exp2Error, 1e-7);
+
+		// Phong lobe: cos in (0, 1], exponent up to 25
+		double powError{0.0};
+		for (float x{0.01f}; x <= 1.0f; x += 0.001f)
+		{
+			for (float y{1.0f}; y <= 25.0f; y += 1.0f)
+			{
+				const double expected{std::pow(static_cast<double>(x), static_cast<double>(y))};
+				if (expected < FLT_MIN) continue;
+				powError = std::fmax(powError, std::fabs(FastPow(x, y) / expected - 1.0));
+			}
+		}
+		EXPECT_LT(powError, 7e-6);
+	}
+
+	TEST(FastMath, EdgeCases) {
+		EXPECT_EQ(FastPow(0.0f, 25.0f), 0.0f);
+		EXPECT_EQ(FastPow(0.0f, 0.0f), 1.0f);
+		EXPECT_NEAR(FastPow(1.0f, 25.0f), 1.0f, 1e-6f);
+		EXPECT_EQ(FastExp2(0.0f), 1.0f);
+		EXPECT_EQ(FastExp2(3.0f), 8.0f);
+		EXPECT_EQ(FastExp2(-1000.0f), 0.0f);
+		EXPECT_TRUE(std::isfinite(FastExp2(1000.0f)));
+		EXPECT_EQ(FastLog2(1.0f), 0.0f);
+		EXPECT_EQ(FastLog2(1024.0f), 10.0f);
+	}
+
+	TEST(FastMath, PrecisionDispatch) {
+		const Vector3 v{3.0f, -4.0f, 12.0f};
+
+		// Exact is what the renderer did before, bit for bit
+		EXPECT_EQ(Normalized(v, MathPrecision::Exact).x, v.Normalized().x);
+		EXPECT_EQ(Reciprocal(7.0f, MathPrecision::Exact), 1.0f / 7.0f);
+		EXPECT_EQ(Pow(0.5f, 3.0f, MathPrecision::Exact), 0.125f);
+
+		EXPECT_NEAR(Normalized(v, MathPrecision::Fast).Magnitude(), 1.0f, 1e-6f);
+		EXPECT_NEAR(Reciprocal(7.0f, MathPrecision::Fast), 1.0f / 7.0f, 1e-7f);
+		EXPECT_NEAR(Pow(0.5f, 3.0f, MathPrecision::Fast), 0.125f, 1e-6f);
+	}
+}
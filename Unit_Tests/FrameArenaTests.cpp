@@ -0,0 +1,87 @@
+#include "gtest/gtest.h"
+#include "FrameArena.h"
+
+#include <cstdint>
+
+
+namespace dae
+{
+	TEST(LinearArena, AllocationsAreAlignedAndDisjoint) {
+		LinearArena arena{1024};
+
+		auto* bytePtr    = static_cast<std::byte*>(arena.Allocate(3, 1));
+		auto* floatPtr   = arena.Allocate<float>(5);
+		auto* alignedPtr = arena.Allocate(16, 64);
+
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(floatPtr) % alignof(float), 0u);
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(alignedPtr) % 64, 0u);
+		EXPECT_GE(reinterpret_cast<std::byte*>(floatPtr), bytePtr + 3);
+		EXPECT_GE(static_cast<std::byte*>(alignedPtr), reinterpret_cast<std::byte*>(floatPtr + 5));
+	}
+
+	TEST(LinearArena, AllocateDefaultConstructs) {
+		struct Pod { int a{7}; float b{2.0f}; };
+
+		LinearArena arena{256};
+		const Pod* podPtr = arena.Allocate<Pod>(4);
+		for (int idx{0}; idx < 4; ++idx)
+		{
+			EXPECT_EQ(podPtr[idx].a, 7);
+			EXPECT_EQ(podPtr[idx].b, 2.0f);
+		}
+	}
+
+	TEST(LinearArena, ResetRewinds) {
+		LinearArena arena{256};
+
+		void* firstPtr = arena.Allocate(100);
+		arena.Reset();
+		EXPECT_EQ(arena.GetUsedBytes(), 0u);
+		EXPECT_EQ(arena.Allocate(100), firstPtr);
+		EXPECT_EQ(arena.GetUpstreamAllocations(), 1u);
+	}
+
+	TEST(LinearArena, OverflowIsMergedOnReset) {
+		LinearArena arena{64};
+
+		// Same "frame" every time, bigger than the initial block
+		const auto frame = [&arena]
+		{
+			for (int idx{0}; idx < 10; ++idx) arena.Allocate(48);
+			arena.Reset();
+		};
+
+		frame();
+		const uint64_t afterWarmUp{arena.GetUpstreamAllocations()};
+		EXPECT_GT(afterWarmUp, 1u);
+		EXPECT_GE(arena.GetCapacity(), 10u * 48u);
+
+		for (int idx{0}; idx < 10; ++idx) frame();
+		EXPECT_EQ(arena.GetUpstreamAllocations(), afterWarmUp);
+	}
+
+	TEST(FrameArena, SteadyStateFramesDoNotAllocate) {
+		FrameArena frameArena{4, 128, 32};
+
+		const auto frame = [&frameArena]
+		{
+			frameArena.GetMain().Allocate<float>(1000);
+			for (uint32_t idx{0}; idx < frameArena.GetWorkerCount(); ++idx)
+			{
+				frameArena.GetWorker(idx).Allocate<int>(100 * (idx + 1));
+			}
+			frameArena.Reset();
+		};
+
+		frame();
+		EXPECT_GT(frameArena.GetLastFrameUpstreamAllocations(), 0u);
+
+		for (int idx{0}; idx < 5; ++idx)
+		{
+			frame();
+			EXPECT_EQ(frameArena.GetLastFrameUpstreamAllocations(), 0u);
+		}
+		EXPECT_EQ(frameArena.GetUsedBytes(), 0u);
+	}
+
+}
@@ -0,0 +1,226 @@
+#include "gtest/gtest.h"
+#include "FrameCapture.h"
+#include "FrameBuffer.h"
+#include "Image.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+
+namespace dae
+{
+	namespace
+	{
+		// A gradient so that every pixel and channel differs
+		void FillGradient(FrameBuffer& frameBuffer)
+		{
+			for (int y{0}; y < frameBuffer.GetHeight(); ++y)
+			{
+				for (int x{0}; x < frameBuffer.GetWidth(); ++x)
+				{
+					frameBuffer.GetColorBuffer()[x + y * frameBuffer.GetWidth()] = FrameBuffer::PackColor(static_cast<uint8_t>(x * 7), static_cast<uint8_t>(y * 11), static_cast<uint8_t>(x + y));
+				}
+			}
+		}
+
+		std::vector<uint8_t> ReadFile(const std::string& path)
+		{
+			std::ifstream file(path, std::ios::binary);
+			return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+		}
+
+		uint32_t ReadBigEndian(const uint8_t* dataPtr)
+		{
+			return (static_cast<uint32_t>(dataPtr[0]) << 24) | (static_cast<uint32_t>(dataPtr[1]) << 16) | (static_cast<uint32_t>(dataPtr[2]) << 8) | dataPtr[3];
+		}
+
+		// Bit by bit, independent of the table the writer uses
+		uint32_t ReferenceCrc(const uint8_t* dataPtr, size_t size)
+		{
+			uint32_t crc{~0u};
+			for (size_t idx{0}; idx < size; ++idx)
+			{
+				crc ^= dataPtr[idx];
+				for (int bit{0}; bit < 8; ++bit) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+			}
+			return ~crc;
+		}
+	}
+
+	TEST(FrameCapture, NumberedPPM) {
+		FrameBuffer frameBuffer{13, 7};
+		FillGradient(frameBuffer);
+		frameBuffer.SetViewport(10, 5);
+
+		FrameCapture::Settings settings{};
+		settings.format       = CaptureFormat::PPM;
+		settings.outputPrefix = "FrameCaptureTest";
+		{
+			FrameCapture capture{13, 7, settings};
+			EXPECT_TRUE(capture.Submit(frameBuffer));
+			capture.Flush();
+			EXPECT_EQ(capture.GetFramesWritten(), 1u);
+		}
+
+		Image image{};
+		ASSERT_TRUE(Image::LoadPPM("FrameCaptureTest_000001.ppm", image));
+		ASSERT_EQ(image.GetWidth(), 10);
+		ASSERT_EQ(image.GetHeight(), 5);
+		const Image expected{Image::FromFrameBuffer(frameBuffer)};
+		EXPECT_EQ(Image::Compare(image, expected, 0).differentPixels, 0u);
+		std::remove("FrameCaptureTest_000001.ppm");
+	}
+
+	// Walks the chunks, checks their CRCs and unpacks the stored deflate blocks back into the rows
+	TEST(FrameCapture, StoredPNG) {
+		// 3 bytes per pixel + the filter byte: more than one 65535 byte deflate block
+		FrameBuffer frameBuffer{160, 150};
+		FillGradient(frameBuffer);
+
+		FrameCapture::Settings settings{};
+		settings.format       = CaptureFormat::PNG;
+		settings.outputPrefix = "FrameCaptureTest";
+		{
+			FrameCapture capture{160, 150, settings};
+			capture.Submit(frameBuffer);
+		}
+
+		const std::vector<uint8_t> file{ReadFile("FrameCaptureTest_000001.png")};
+		std::remove("FrameCaptureTest_000001.png");
+		ASSERT_GT(file.size(), 8u);
+		const uint8_t signature[]{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+		ASSERT_TRUE(std::equal(std::begin(signature), std::end(signature), file.begin()));
+
+		std::vector<uint8_t> zlib{};
+		bool hasEnd{false};
+		for (size_t offset{8}; offset + 12 <= file.size();)
+		{
+			const uint32_t size{ReadBigEndian(&file[offset])};
+			const std::string type(reinterpret_cast<const char*>(&file[offset + 4]), 4);
+			ASSERT_LE(offset + 12 + size, file.size());
+			EXPECT_EQ(ReadBigEndian(&file[offset + 8 + size]), ReferenceCrc(&file[offset + 4], size + 4)) << type;
+
+			if (type == "IHDR")
+			{
+				EXPECT_EQ(ReadBigEndian(&file[offset + 8]), 160u);
+				EXPECT_EQ(ReadBigEndian(&file[offset + 12]), 150u);
+			}
+			else if (type == "IDAT")
+			{
+				zlib.insert(zlib.end(), file.begin() + static_cast<std::ptrdiff_t>(offset + 8), file.begin() + static_cast<std::ptrdiff_t>(offset + 8 + size));
+			}
+			hasEnd = type == "IEND";
+			offset += 12 + size;
+		}
+		EXPECT_TRUE(hasEnd);
+
+		std::vector<uint8_t> rows{};
+		size_t offset{2};
+		bool isFinal{false};
+		int blockCount{0};
+		while (not isFinal and offset + 5 <= zlib.size())
+		{
+			isFinal = zlib[offset] & 1;
+			const uint16_t size{static_cast<uint16_t>(zlib[offset + 1] | (zlib[offset + 2] << 8))};
+			const uint16_t inverted{static_cast<uint16_t>(zlib[offset + 3] | (zlib[offset + 4] << 8))};
+			EXPECT_EQ(static_cast<uint16_t>(~size), inverted);
+			rows.insert(rows.end(), zlib.begin() + static_cast<std::ptrdiff_t>(offset + 5), zlib.begin() + static_cast<std::ptrdiff_t>(offset + 5 + size));
+			offset += 5 + size;
+			++blockCount;
+		}
+		EXPECT_TRUE(isFinal);
+		EXPECT_GT(blockCount, 1);
+		EXPECT_EQ(offset + 4, zlib.size()); // Adler-32 is all that is left
+
+		ASSERT_EQ(rows.size(), 150u * (1 + 160 * 3));
+		for (int y{0}; y < 150; ++y)
+		{
+			const uint8_t* rowPtr{&rows[y * (1 + 160 * 3)]};
+			EXPECT_EQ(rowPtr[0], 0);
+			for (int x{0}; x < 160; ++x)
+			{
+				const uint32_t pixel{frameBuffer.GetColorBuffer()[x + y * 160]};
+				EXPECT_EQ(rowPtr[1 + x * 3], FrameBuffer::UnpackR(pixel));
+				EXPECT_EQ(rowPtr[2 + x * 3], FrameBuffer::UnpackG(pixel));
+				EXPECT_EQ(rowPtr[3 + x * 3], FrameBuffer::UnpackB(pixel));
+			}
+		}
+	}
+
+	// Header once, a FRAME per frame with three full planes, a frame of another size is dropped
+	TEST(FrameCapture, Y4MStream) {
+		FrameBuffer frameBuffer{4, 2};
+		FrameCapture::Settings settings{};
+		settings.format       = CaptureFormat::Y4M;
+		settings.streamPath   = "FrameCaptureTest.y4m";
+		settings.frameRate    = 30;
+		settings.backpressure = FrameCapture::Backpressure::Wait;
+		{
+			FrameCapture capture{4, 2, settings};
+			frameBuffer.ClearColor(FrameBuffer::PackColor(255, 255, 255));
+			capture.Submit(frameBuffer);
+			frameBuffer.ClearColor(FrameBuffer::PackColor(0, 0, 0));
+			capture.Submit(frameBuffer);
+			frameBuffer.SetViewport(2, 2);
+			capture.Submit(frameBuffer);
+			capture.Flush();
+			EXPECT_EQ(capture.GetFramesWritten(), 2u);
+			EXPECT_EQ(capture.GetFramesDropped(), 1u);
+		}
+
+		const std::vector<uint8_t> stream{ReadFile("FrameCaptureTest.y4m")};
+		std::remove("FrameCaptureTest.y4m");
+		const std::string header{"YUV4MPEG2 W4 H2 F30:1 Ip A1:1 C444\n"};
+		ASSERT_EQ(stream.size(), header.size() + 2 * (6 + 4 * 2 * 3));
+		EXPECT_EQ(std::string(stream.begin(), stream.begin() + static_cast<std::ptrdiff_t>(header.size())), header);
+
+		const uint8_t* framePtr{&stream[header.size()]};
+		for (const uint8_t luma : {uint8_t{235}, uint8_t{16}})
+		{
+			EXPECT_EQ(std::string(reinterpret_cast<const char*>(framePtr), 6), "FRAME\n");
+			for (int idx{0}; idx < 8; ++idx)
+			{
+				EXPECT_EQ(framePtr[6 + idx], luma);
+				EXPECT_EQ(framePtr[6 + 8 + idx], 128);
+				EXPECT_EQ(framePtr[6 + 16 + idx], 128);
+			}
+			framePtr += 6 + 4 * 2 * 3;
+		}
+	}
+
+	// Every frame ends up written or dropped, waiting never drops
+	TEST(FrameCapture, Backpressure) {
+		FrameBuffer frameBuffer{64, 64};
+		FillGradient(frameBuffer);
+
+		for (const FrameCapture::Backpressure backpressure : {FrameCapture::Backpressure::Drop, FrameCapture::Backpressure::Wait})
+		{
+			FrameCapture::Settings settings{};
+			settings.format       = CaptureFormat::Raw;
+			settings.streamPath   = "FrameCaptureTest.raw";
+			settings.bufferCount  = 1;
+			settings.backpressure = backpressure;
+			{
+				FrameCapture capture{64, 64, settings};
+				uint64_t accepted{0};
+				for (int frame{0}; frame < 20; ++frame)
+				{
+					accepted += capture.Submit(frameBuffer) ? 1 : 0;
+				}
+				capture.Flush();
+				EXPECT_EQ(capture.GetFramesSubmitted(), 20u);
+				EXPECT_EQ(capture.GetFramesWritten(), accepted);
+				EXPECT_EQ(capture.GetFramesWritten() + capture.GetFramesDropped(), 20u);
+				if (backpressure == FrameCapture::Backpressure::Wait)
+				{
+					EXPECT_EQ(capture.GetFramesDropped(), 0u);
+				}
+			}
+			EXPECT_EQ(ReadFile("FrameCaptureTest.raw").size() % (64 * 64 * 4), 0u);
+			std::remove("FrameCaptureTest.raw");
+		}
+	}
+}
@@ -0,0 +1,38 @@
+#include "gtest/gtest.h"
+#include "FrameStatistics.h"
+
+#include <vector>
+
+
+namespace dae
+{
+	TEST(FrameStatistics, PercentileInterpolatesBetweenRanks) {
+		const std::vector<double> samples{1.0, 2.0, 3.0, 4.0, 5.0};
+
+		EXPECT_DOUBLE_EQ(Percentile(samples, 0.0), 1.0);
+		EXPECT_DOUBLE_EQ(Percentile(samples, 50.0), 3.0);
+		EXPECT_DOUBLE_EQ(Percentile(samples, 100.0), 5.0);
+		EXPECT_DOUBLE_EQ(Percentile(samples, 90.0), 4.6);
+	}
+
+	TEST(FrameStatistics, SummarizeUnsortedSamples) {
+		// 99 smooth frames and one hitch: the mean barely moves, p99 and max show it
+		std::vector<double> samples(100, 10.0);
+		samples[42] = 50.0;
+
+		const SampleSummary summary{Summarize(samples)};
+		EXPECT_EQ(summary.count, 100u);
+		EXPECT_DOUBLE_EQ(summary.min, 10.0);
+		EXPECT_DOUBLE_EQ(summary.max, 50.0);
+		EXPECT_DOUBLE_EQ(summary.mean, 10.4);
+		EXPECT_DOUBLE_EQ(summary.p50, 10.0);
+		EXPECT_DOUBLE_EQ(summary.p95, 10.0);
+		EXPECT_NEAR(summary.p99, 10.0 + 40.0 * 0.01, 1e-9);
+	}
+
+	TEST(FrameStatistics, SummarizeEmpty) {
+		const SampleSummary summary{Summarize({})};
+		EXPECT_EQ(summary.count, 0u);
+		EXPECT_EQ(summary.mean, 0.0);
+	}
+}
@@ -0,0 +1,115 @@
+#include "gtest/gtest.h"
+#include "Camera.h"
+#include "Frustum.h"
+
+
+namespace dae
+{
+	namespace
+	{
+		// The final vehicle path's camera: 45 degrees, 4:3, planes at 0.1 and 100, looking down +z from the origin
+		Camera CreateCamera()
+		{
+			Camera camera{};
+			camera.SetAspectRatio(4.0f / 3.0f);
+			camera.Initialize(45.0f, {0.0f, 0.0f, 0.0f}, 0.1f, 100.0f);
+			camera.UpdateMatrices();
+			return camera;
+		}
+	}
+
+	TEST(Frustum, PlanesFromViewProjection) {
+		const Camera camera{CreateCamera()};
+		const Frustum& frustum{camera.GetFrustum()};
+
+		for (int idx{0}; idx < static_cast<int>(Frustum::Plane::COUNT); ++idx)
+		{
+			EXPECT_NEAR(frustum.GetPlane(static_cast<Frustum::Plane>(idx)).GetXYZ().Magnitude(), 1.0f, 1e-5f);
+		}
+		EXPECT_NEAR(frustum.GetDistance(Frustum::Plane::Near, {0.0f, 0.0f, 1.0f}), 0.9f, 1e-4f);
+		EXPECT_NEAR(frustum.GetDistance(Frustum::Plane::Far, {0.0f, 0.0f, 1.0f}), 99.0f, 1e-3f);
+
+		EXPECT_TRUE(frustum.IsPointVisible({0.0f, 0.0f, 10.0f}));
+		EXPECT_FALSE(frustum.IsPointVisible({0.0f, 0.0f, -1.0f}));   // Behind
+		EXPECT_FALSE(frustum.IsPointVisible({0.0f, 0.0f, 0.05f}));   // In front of the near plane
+		EXPECT_FALSE(frustum.IsPointVisible({0.0f, 0.0f, 101.0f}));  // Behind the far plane
+		EXPECT_FALSE(frustum.IsPointVisible({-20.0f, 0.0f, 10.0f})); // Left
+		EXPECT_FALSE(frustum.IsPointVisible({0.0f, 10.0f, 10.0f}));  // Above
+	}
+
+	TEST(Frustum, SphereAndBox) {
+		const Camera camera{CreateCamera()};
+
+		// Straddling the left plane vs just past it
+		EXPECT_TRUE(camera.IsSphereVisible({-5.0f, 0.0f, 10.0f}, 1.0f));
+		EXPECT_FALSE(camera.IsSphereVisible({-20.0f, 0.0f, 10.0f}, 1.0f));
+		EXPECT_TRUE(camera.IsSphereVisible({0.0f, 0.0f, -1.0f}, 2.0f));
+
+		// Half width at z = 5 and 7 is tan(22.5) * 4 / 3 * z = 2.76 and 3.87
+		EXPECT_TRUE(camera.IsBoxVisible({{-1.0f, -1.0f, 5.0f}, {1.0f, 1.0f, 7.0f}}));
+		EXPECT_TRUE(camera.IsBoxVisible({{-100.0f, -1.0f, 5.0f}, {-2.0f, 1.0f, 7.0f}}));
+		EXPECT_FALSE(camera.IsBoxVisible({{-100.0f, -1.0f, 5.0f}, {-4.0f, 1.0f, 7.0f}}));
+		EXPECT_FALSE(camera.IsBoxVisible({{-1.0f, -1.0f, -7.0f}, {1.0f, 1.0f, -5.0f}}));
+		EXPECT_FALSE(camera.IsBoxVisible({{-1.0f, -1.0f, 200.0f}, {1.0f, 1.0f, 300.0f}}));
+	}
+
+	TEST(Frustum, TransformedBoundingBox) {
+		const Vector3 points[]{{-1.0f, 0.0f, 2.0f}, {3.0f, -2.0f, 1.0f}, {0.5f, 4.0f, -1.0f}};
+		const BoundingBox box{BoundingBox::FromPoints(std::span<const Vector3>{points})};
+		EXPECT_EQ(box.min, Vector3(-1.0f, -2.0f, -1.0f));
+		EXPECT_EQ(box.max, Vector3(3.0f, 4.0f, 2.0f));
+
+		// A translation moves the box as is
+		const BoundingBox translated{box.Transformed(Matrix::CreateTranslation(10.0f, 0.0f, -5.0f))};
+		EXPECT_EQ(translated.min, Vector3(9.0f, -2.0f, -6.0f));
+		EXPECT_EQ(translated.max, Vector3(13.0f, 4.0f, -3.0f));
+
+		// A rotated box still contains every transformed point
+		const Matrix rotation{Matrix::CreateRotationY(0.7f) * Matrix::CreateTranslation(0.0f, 5.0f, 20.0f)};
+		const BoundingBox rotated{box.Transformed(rotation)};
+		for (const Vector3& point : points)
+		{
+			const Vector3 transformed{rotation.TransformPoint(point)};
+			for (int axis{0}; axis < 3; ++axis)
+			{
+				EXPECT_GE(transformed[axis], rotated.min[axis] - 1e-5f);
+				EXPECT_LE(transformed[axis], rotated.max[axis] + 1e-5f);
+			}
+		}
+	}
+
+	// Cached matrices must be what a camera that recomputes everything would have
+	TEST(Frustum, CameraDirtyTracking) {
+		Camera camera{CreateCamera()};
+		const Matrix projection{camera.GetProjectionMatrix()};
+		EXPECT_EQ(camera.GetViewProjectionMatrix(), camera.GetInverseViewMatrix() * camera.GetProjectionMatrix());
+
+		camera.SetPose({1.0f, 2.0f, -30.0f}, 10.0f, 20.0f);
+		camera.UpdateMatrices();
+		EXPECT_EQ(camera.GetProjectionMatrix(), projection);
+		EXPECT_EQ(camera.GetViewProjectionMatrix(), camera.GetInverseViewMatrix() * camera.GetProjectionMatrix());
+
+		camera.SetFOVAngle(60.0f);
+		camera.SetAspectRatio(16.0f / 9.0f);
+		camera.UpdateMatrices();
+
+		Camera reference{};
+		reference.SetAspectRatio(16.0f / 9.0f);
+		reference.Initialize(60.0f, {0.0f, 0.0f, 0.0f}, 0.1f, 100.0f);
+		reference.SetPose({1.0f, 2.0f, -30.0f}, 10.0f, 20.0f);
+		reference.UpdateMatrices();
+		EXPECT_EQ(camera.GetViewMatrix(), reference.GetViewMatrix());
+		EXPECT_EQ(camera.GetInverseViewMatrix(), reference.GetInverseViewMatrix());
+		EXPECT_EQ(camera.GetProjectionMatrix(), reference.GetProjectionMatrix());
+		EXPECT_EQ(camera.GetViewProjectionMatrix(), reference.GetViewProjectionMatrix());
+
+		// The angle setters flag the view like SetPose does
+		camera.SetTotalPitch(-15.0f);
+		camera.SetTotalYaw(45.0f);
+		camera.UpdateMatrices();
+		reference.SetPose({1.0f, 2.0f, -30.0f}, -15.0f, 45.0f);
+		reference.UpdateMatrices();
+		EXPECT_EQ(camera.GetViewMatrix(), reference.GetViewMatrix());
+		EXPECT_EQ(camera.GetViewProjectionMatrix(), reference.GetViewProjectionMatrix());
+	}
+}
@@ -0,0 +1,61 @@
+#include "gtest/gtest.h"
+#include "HardwareCounters.h"
+
+
+namespace dae
+{
+	TEST(HardwareCounters, ValuesSubtractWithoutWrapping) {
+		HardwareCounterValues start{};
+		start.counts[static_cast<int>(HardwareEvent::Cycles)]       = 100;
+		start.counts[static_cast<int>(HardwareEvent::Instructions)] = 50;
+		HardwareCounterValues end{start};
+		end.counts[static_cast<int>(HardwareEvent::Cycles)]       = 300;
+		end.counts[static_cast<int>(HardwareEvent::Instructions)] = 450;
+
+		const HardwareCounterValues range{end - start};
+		EXPECT_EQ(range[HardwareEvent::Cycles], 200u);
+		EXPECT_EQ(range[HardwareEvent::Instructions], 400u);
+		EXPECT_FLOAT_EQ(range.GetIPC(), 2.0f);
+
+		// A counter that was reopened in between must not turn into a huge count
+		EXPECT_EQ((start - end)[HardwareEvent::Cycles], 0u);
+		EXPECT_FLOAT_EQ(HardwareCounterValues{}.GetIPC(), 0.0f);
+	}
+
+	TEST(HardwareCounters, DegradesGracefully) {
+		const HardwareCounters counters{};
+		if (not counters.IsAvailable())
+		{
+			// Nothing opened: every read is zero and the status tells why
+			EXPECT_FALSE(counters.GetStatus().empty());
+			const HardwareCounterValues values{counters.Read()};
+			for (int idx{0}; idx < HardwareCounterValues::s_EventCount; ++idx)
+			{
+				EXPECT_FALSE(counters.IsAvailable(static_cast<HardwareEvent>(idx)));
+				EXPECT_EQ(values.counts[idx], 0u);
+			}
+			return;
+		}
+
+		const HardwareCounterValues start{counters.Read()};
+		volatile uint64_t sum{0};
+		for (uint64_t idx{0}; idx < 100'000; ++idx)
+		{
+			sum = sum + idx;
+		}
+		const HardwareCounterValues range{counters.Read() - start};
+
+		for (int idx{0}; idx < HardwareCounterValues::s_EventCount; ++idx)
+		{
+			if (not counters.IsAvailable(static_cast<HardwareEvent>(idx)))
+			{
+				EXPECT_EQ(range.counts[idx], 0u);
+			}
+		}
+		// The group may not have been scheduled at all when the PMU is busy, then everything reads 0
+		if (counters.IsAvailable(HardwareEvent::Instructions) and range[HardwareEvent::Cycles] > 0)
+		{
+			EXPECT_GT(range[HardwareEvent::Instructions], 100'000u);
+		}
+	}
+}
@@ -0,0 +1,151 @@
+#include "gtest/gtest.h"
+#include "HdrBuffer.h"
+#include "FrameBuffer.h"
+
+#include <algorithm>
+#include <vector>
+
+
+namespace dae
+{
+	namespace
+	{
+		const ToneMapping s_ToneMappings[]{ToneMapping::MaxToOne, ToneMapping::Clamp, ToneMapping::Reinhard, ToneMapping::ACES};
+	}
+
+	// The vectorized span and the scalar pixel path must pack the same bits, 19 pixels also run the 8, 4 and 1 wide loops
+	TEST(HdrBuffer, SpanMatchesPixel) {
+		constexpr int count{19};
+		float red[count], green[count], blue[count];
+		for (int idx{0}; idx < count; ++idx)
+		{
+			red[idx]   = static_cast<float>(idx) * 0.17f - 0.3f;
+			green[idx] = static_cast<float>(count - idx) * 0.09f;
+			blue[idx]  = static_cast<float>(idx % 5) * 0.61f;
+		}
+
+		for (const ToneMapping toneMapping : s_ToneMappings)
+		{
+			for (const bool encodeSRGB : {false, true})
+			{
+				const HdrBuffer::ResolveSettings settings{toneMapping, encodeSRGB};
+				uint32_t packed[count]{};
+				HdrBuffer::ResolveSpan(red, green, blue, packed, count, settings);
+				for (int idx{0}; idx < count; ++idx)
+				{
+					EXPECT_EQ(packed[idx], HdrBuffer::ResolvePixel({red[idx], green[idx], blue[idx]}, settings))
+						<< HdrBuffer::GetToneMappingName(toneMapping) << (encodeSRGB ? " sRGB" : "") << " pixel " << idx;
+				}
+			}
+		}
+	}
+
+	// The default resolve is what shading packed per pixel before the HDR buffer
+	TEST(HdrBuffer, MaxToOneMatchesPerPixelPacking) {
+		for (const ColorRGB color : {ColorRGB{0.2f, 0.5f, 0.9f}, ColorRGB{2.0f, 1.0f, 0.5f}, ColorRGB{1.0f, 1.0f, 1.0f}, ColorRGB{0.0f, 3.7f, 0.1f}})
+		{
+			ColorRGB expected{color};
+			expected.MaxToOne();
+			EXPECT_EQ(HdrBuffer::ResolvePixel(color, {}), FrameBuffer::PackColor(static_cast<uint8_t>(expected.r * 255),
+			                                                                     static_cast<uint8_t>(expected.g * 255),
+			                                                                     static_cast<uint8_t>(expected.b * 255)));
+		}
+	}
+
+	TEST(HdrBuffer, ToneMappingRange) {
+		const ColorRGB bright{100.0f, 100.0f, 100.0f};
+		EXPECT_EQ(HdrBuffer::ResolvePixel(bright, {ToneMapping::Clamp, false}), FrameBuffer::PackColor(255, 255, 255));
+		EXPECT_EQ(HdrBuffer::ResolvePixel(bright, {ToneMapping::ACES, false}), FrameBuffer::PackColor(255, 255, 255));
+		// 100 / 101 * 255
+		EXPECT_EQ(HdrBuffer::ResolvePixel(bright, {ToneMapping::Reinhard, false}), FrameBuffer::PackColor(252, 252, 252));
+
+		const ColorRGB negative{-1.0f, -0.5f, 0.0f};
+		for (const ToneMapping toneMapping : {ToneMapping::MaxToOne, ToneMapping::Clamp, ToneMapping::ACES})
+		{
+			EXPECT_EQ(HdrBuffer::ResolvePixel(negative, {toneMapping, false}), FrameBuffer::PackColor(0, 0, 0));
+		}
+	}
+
+	TEST(HdrBuffer, SRGBEncoding) {
+		EXPECT_EQ(HdrBuffer::EncodeSRGB(0.0f), 0);
+		EXPECT_EQ(HdrBuffer::EncodeSRGB(1.0f), 255);
+		EXPECT_EQ(HdrBuffer::EncodeSRGB(2.0f), 255);
+		// Linear 0.5 is 188 in sRGB, 18% grey is 118
+		EXPECT_EQ(HdrBuffer::EncodeSRGB(0.5f), 188);
+		EXPECT_EQ(HdrBuffer::EncodeSRGB(0.18f), 118);
+
+		uint8_t previous{0};
+		for (float linear{0.0f}; linear <= 1.0f; linear += 1.0f / 1024.0f)
+		{
+			const uint8_t encoded{HdrBuffer::EncodeSRGB(linear)};
+			EXPECT_GE(encoded, previous);
+			previous = encoded;
+		}
+	}
+
+	// Tiles nothing wrote resolve to the clear color, a prepared tile to what was written, nothing outside the viewport is touched
+	TEST(HdrBuffer, ResolveTiles) {
+		constexpr int width{37}, height{20}, viewportWidth{30}, viewportHeight{18};
+		HdrBuffer buffer{width, height};
+		const ColorRGB clearColor{0.25f, 0.5f, 0.75f};
+		buffer.ClearDeferred(clearColor, viewportWidth, viewportHeight);
+
+		buffer.PrepareTiles(8, 8, 10, 9);
+		const ColorRGB written{4.0f, 2.0f, 1.0f};
+		buffer.Write(9 + 8 * width, written);
+
+		constexpr uint32_t untouched{0xDEADBEEF};
+		std::vector<uint32_t> pixels(width * height, untouched);
+		const HdrBuffer::ResolveSettings settings{};
+		buffer.Resolve(pixels.data(), 0, 10, settings);
+		buffer.Resolve(pixels.data(), 10, viewportHeight, settings);
+
+		const uint32_t clearPixel{HdrBuffer::ResolvePixel(clearColor, settings)};
+		for (int y{0}; y < height; ++y)
+		{
+			for (int x{0}; x < width; ++x)
+			{
+				uint32_t expected{untouched};
+				if (x == 9 and y == 8)                                  expected = HdrBuffer::ResolvePixel(written, settings);
+				else if (x < viewportWidth and y < viewportHeight)      expected = clearPixel;
+				EXPECT_EQ(pixels[x + y * width], expected) << x << ", " << y;
+			}
+		}
+	}
+
+	// Tiles are filled when first touched or in Resolve, the result is what filling the whole viewport up front gives
+	TEST(HdrBuffer, DeferredClearMatchesEagerClear) {
+		constexpr int width{37}, height{21};
+		const ColorRGB background{0.4f, 0.4f, 0.4f};
+		const ColorRGB drawn{1.0f, 0.0f, 0.0f};
+
+		HdrBuffer eager{width, height};
+		HdrBuffer deferred{width, height};
+
+		// Start from garbage in both
+		for (HdrBuffer* bufferPtr : {&eager, &deferred})
+		{
+			bufferPtr->ClearDeferred({7.0f, 3.0f, 5.0f}, width, height);
+			bufferPtr->PrepareTiles(0, 0, width - 1, height - 1);
+		}
+
+		eager.ClearDeferred(background, width, height);
+		eager.PrepareTiles(0, 0, width - 1, height - 1);
+		deferred.ClearDeferred(background, width, height);
+
+		for (HdrBuffer* bufferPtr : {&eager, &deferred})
+		{
+			bufferPtr->PrepareTiles(10, 5, 12, 6);
+			bufferPtr->Write(11 + 5 * width, drawn);
+		}
+
+		const HdrBuffer::ResolveSettings settings{};
+		std::vector<uint32_t> expected(width * height);
+		std::vector<uint32_t> actual(width * height);
+		eager.Resolve(expected.data(), 0, height, settings);
+		deferred.Resolve(actual.data(), 0, height, settings);
+		EXPECT_EQ(actual, expected);
+		EXPECT_EQ(actual[11 + 5 * width], HdrBuffer::ResolvePixel(drawn, settings));
+		EXPECT_EQ(actual[0], HdrBuffer::ResolvePixel(background, settings));
+	}
+}
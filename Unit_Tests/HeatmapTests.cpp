@@ -0,0 +1,52 @@
+#include "gtest/gtest.h"
+#include "FrameBuffer.h"
+#include "Heatmap.h"
+
+#include <vector>
+
+
+namespace dae
+{
+	TEST(Heatmap, RampGoesFromBlackToRed) {
+		EXPECT_EQ(Heatmap::GetHeatColor(0.0f), FrameBuffer::PackColor(0, 0, 0));
+		EXPECT_EQ(Heatmap::GetHeatColor(0.2f), FrameBuffer::PackColor(0, 0, 255));
+		EXPECT_EQ(Heatmap::GetHeatColor(1.0f), FrameBuffer::PackColor(255, 0, 0));
+
+		// Saturates instead of wrapping
+		EXPECT_EQ(Heatmap::GetHeatColor(5.0f), FrameBuffer::PackColor(255, 0, 0));
+		EXPECT_EQ(Heatmap::GetHeatColor(-1.0f), FrameBuffer::PackColor(0, 0, 0));
+	}
+
+	TEST(Heatmap, ResolveOnlyWritesTheViewport) {
+		Heatmap heatmap{8, 4};
+		heatmap.AddRect(0, 0, 1, 1);
+		heatmap.AddRect(1, 1, 2, 1);
+
+		constexpr uint32_t untouched{0x12345678};
+		std::vector<uint32_t> colors(8 * 4, untouched);
+		heatmap.Resolve(colors.data(), 4, 2, 2);
+
+		EXPECT_EQ(colors[0 + 0 * 8], Heatmap::GetHeatColor(0.5f));
+		EXPECT_EQ(colors[1 + 1 * 8], Heatmap::GetHeatColor(1.0f));
+		EXPECT_EQ(colors[3 + 1 * 8], Heatmap::GetHeatColor(0.0f));
+		EXPECT_EQ(colors[4 + 0 * 8], untouched);
+		EXPECT_EQ(colors[0 + 2 * 8], untouched);
+	}
+
+	TEST(Heatmap, PercentileIgnoresEmptyPixels) {
+		Heatmap heatmap{10, 10};
+		EXPECT_EQ(heatmap.GetPercentile(10, 10, 99.0f), 0u);
+
+		for (int idx{0}; idx < 9; ++idx)
+		{
+			heatmap.Add(idx, 10);
+		}
+		heatmap.Add(9, 1000);
+
+		EXPECT_EQ(heatmap.GetPercentile(10, 10, 50.0f), 10u);
+		EXPECT_EQ(heatmap.GetPercentile(10, 10, 100.0f), 1000u);
+
+		heatmap.Clear();
+		EXPECT_EQ(heatmap.GetPercentile(10, 10, 100.0f), 0u);
+	}
+}
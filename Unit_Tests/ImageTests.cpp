@@ -0,0 +1,94 @@
+#include "gtest/gtest.h"
+#include "FrameBuffer.h"
+#include "Image.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+
+namespace dae
+{
+	TEST(Image, FromFrameBufferCopiesTheViewport) {
+		FrameBuffer frameBuffer{8, 4};
+		frameBuffer.ClearColor(FrameBuffer::PackColor(1, 2, 3));
+		frameBuffer.GetColorBuffer()[1 + 1 * 8] = FrameBuffer::PackColor(200, 100, 50);
+		frameBuffer.SetViewport(4, 2);
+
+		const Image image{Image::FromFrameBuffer(frameBuffer)};
+		ASSERT_EQ(image.GetWidth(), 4);
+		ASSERT_EQ(image.GetHeight(), 2);
+		EXPECT_EQ(image.GetPixels()[0], FrameBuffer::PackColor(1, 2, 3));
+		EXPECT_EQ(image.GetPixels()[1 + 1 * 4], FrameBuffer::PackColor(200, 100, 50));
+	}
+
+	TEST(Image, PPMRoundTrip) {
+		Image image{3, 2};
+		for (uint64_t idx{0}; idx < image.GetPixelCount(); ++idx)
+		{
+			const auto value{static_cast<uint8_t>(idx * 40)};
+			image.GetPixels()[idx] = FrameBuffer::PackColor(value, static_cast<uint8_t>(255 - value), 10);
+		}
+
+		const std::string path{(std::filesystem::temp_directory_path() / "dae_image_test.ppm").string()};
+		ASSERT_TRUE(image.SavePPM(path));
+
+		Image loaded{};
+		ASSERT_TRUE(Image::LoadPPM(path, loaded));
+		std::remove(path.c_str());
+
+		ASSERT_EQ(loaded.GetWidth(), 3);
+		ASSERT_EQ(loaded.GetHeight(), 2);
+		for (uint64_t idx{0}; idx < image.GetPixelCount(); ++idx)
+		{
+			EXPECT_EQ(loaded.GetPixels()[idx], image.GetPixels()[idx]);
+		}
+	}
+
+	TEST(Image, LoadRejectsOtherFormats) {
+		const std::string path{(std::filesystem::temp_directory_path() / "dae_image_test_p3.ppm").string()};
+		{
+			std::ofstream file(path);
+			file << "P3\n1 1\n255\n0 0 0\n";
+		}
+
+		Image image{2, 2};
+		EXPECT_FALSE(Image::LoadPPM(path, image));
+		EXPECT_EQ(image.GetWidth(), 2);
+		std::remove(path.c_str());
+
+		EXPECT_FALSE(Image::LoadPPM(path, image));
+	}
+
+	TEST(Image, CompareCountsPixelsAboveTheTolerance) {
+		Image reference{4, 1};
+		for (uint64_t idx{0}; idx < reference.GetPixelCount(); ++idx)
+		{
+			reference.GetPixels()[idx] = FrameBuffer::PackColor(100, 100, 100);
+		}
+		Image actual{4, 1};
+		actual.GetPixels()[0] = FrameBuffer::PackColor(100, 100, 100);
+		actual.GetPixels()[1] = FrameBuffer::PackColor(102, 100, 100); // Within the tolerance
+		actual.GetPixels()[2] = FrameBuffer::PackColor(100, 103, 100);
+		actual.GetPixels()[3] = FrameBuffer::PackColor(100, 100, 0);
+
+		Image diffImage{};
+		const ImageDiff diff{Image::Compare(actual, reference, 2, &diffImage)};
+		EXPECT_TRUE(diff.sizeMatches);
+		EXPECT_EQ(diff.differentPixels, 2u);
+		EXPECT_EQ(diff.maxChannelDelta, 100);
+		EXPECT_FLOAT_EQ(diff.meanChannelDelta, 105.0f / 12.0f);
+		EXPECT_FLOAT_EQ(diff.GetDifferentFraction(reference.GetPixelCount()), 0.5f);
+
+		// Different pixels are red, the others a gray version of the reference
+		ASSERT_EQ(diffImage.GetWidth(), 4);
+		EXPECT_EQ(FrameBuffer::UnpackG(diffImage.GetPixels()[2]), 0);
+		EXPECT_GT(FrameBuffer::UnpackR(diffImage.GetPixels()[3]), FrameBuffer::UnpackR(diffImage.GetPixels()[2]));
+		EXPECT_EQ(diffImage.GetPixels()[1], diffImage.GetPixels()[0]);
+	}
+
+	TEST(Image, CompareRejectsDifferentSizes) {
+		const ImageDiff diff{Image::Compare(Image{4, 2}, Image{2, 4}, 0)};
+		EXPECT_FALSE(diff.sizeMatches);
+	}
+}
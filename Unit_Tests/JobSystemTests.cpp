@@ -0,0 +1,156 @@
+#include "gtest/gtest.h"
+#include "JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+
+namespace dae
+{
+	TEST(JobSystem, WorkerCountIncludesSubmittingThread) {
+		JobSystem jobSystem{3};
+		EXPECT_EQ(jobSystem.GetWorkerCount(), 4u);
+		EXPECT_EQ(jobSystem.GetCurrentWorkerIndex(), 0u);
+	}
+
+	TEST(JobSystem, ParallelForVisitsEveryIndexOnce) {
+		JobSystem jobSystem{4};
+
+		for (const uint32_t count : {0u, 1u, 7u, 1000u, 100000u})
+		{
+			for (const uint32_t grainSize : {0u, 1u, 64u, 5000u})
+			{
+				std::vector<std::atomic<int>> visits(count);
+				jobSystem.ParallelFor(count, grainSize, [&visits](uint32_t begin, uint32_t end, uint32_t)
+				{
+					for (uint32_t idx{begin}; idx < end; ++idx)
+					{
+						visits[idx].fetch_add(1);
+					}
+				});
+
+				for (uint32_t idx{0}; idx < count; ++idx)
+				{
+					ASSERT_EQ(visits[idx].load(), 1) << "count " << count << ", grain " << grainSize << ", index " << idx;
+				}
+			}
+		}
+	}
+
+	TEST(JobSystem, ParallelForReportsValidWorkerIndices) {
+		JobSystem jobSystem{3};
+
+		std::atomic<uint32_t> maxIndex{0};
+		jobSystem.ParallelFor(10000, 16, [&maxIndex, &jobSystem](uint32_t, uint32_t, uint32_t workerIndex)
+		{
+			EXPECT_EQ(workerIndex, jobSystem.GetCurrentWorkerIndex());
+			uint32_t current{maxIndex.load()};
+			while (workerIndex > current and not maxIndex.compare_exchange_weak(current, workerIndex)) {}
+		});
+		EXPECT_LT(maxIndex.load(), jobSystem.GetWorkerCount());
+	}
+
+	TEST(JobSystem, ScratchMemoryIsPerWorker) {
+		JobSystem jobSystem{2, false, 1024};
+		EXPECT_EQ(jobSystem.GetScratchSize(), 1024u);
+
+		std::set<std::byte*> scratches{};
+		for (uint32_t idx{0}; idx < jobSystem.GetWorkerCount(); ++idx)
+		{
+			ASSERT_NE(jobSystem.GetScratchMemory(idx), nullptr);
+			scratches.insert(jobSystem.GetScratchMemory(idx));
+		}
+		EXPECT_EQ(scratches.size(), jobSystem.GetWorkerCount());
+	}
+
+	TEST(JobSystem, WorkerInitRunsOnEveryWorkerThreadBeforeConstructionReturns) {
+		std::mutex                mutex{};
+		std::vector<uint32_t>     workerIndices{};
+		std::set<std::thread::id> threadIds{};
+		JobSystem jobSystem{3, false, 1024, [&](uint32_t workerIndex)
+		{
+			std::lock_guard lock{mutex};
+			workerIndices.push_back(workerIndex);
+			threadIds.insert(std::this_thread::get_id());
+		}};
+
+		std::lock_guard lock{mutex};
+		std::sort(workerIndices.begin(), workerIndices.end());
+		EXPECT_EQ(workerIndices, (std::vector<uint32_t>{1, 2, 3}));
+		EXPECT_EQ(threadIds.size(), 3u);
+		EXPECT_EQ(threadIds.count(std::this_thread::get_id()), 0u);
+	}
+
+	TEST(JobSystem, PinnedWorkersStillRunJobs) {
+		JobSystem jobSystem{2, true};
+
+		std::atomic<uint32_t> sum{0};
+		jobSystem.ParallelFor(1000, 10, [&sum](uint32_t begin, uint32_t end, uint32_t)
+		{
+			sum.fetch_add(end - begin);
+		});
+		EXPECT_EQ(sum.load(), 1000u);
+	}
+
+	TEST(JobGraph, RunsNodesAfterTheirDependencies) {
+		JobSystem jobSystem{4};
+		JobGraph  graph{};
+
+		// vertex -> (bin A, bin B) -> raster -> resolve
+		std::atomic<int> step{0};
+		int vertexStep{-1}, binAStep{-1}, binBStep{-1}, rasterStep{-1}, resolveStep{-1};
+		const auto vertex  = graph.AddNode([&](uint32_t) { vertexStep  = step++; });
+		const auto binA    = graph.AddNode([&](uint32_t) { binAStep    = step++; });
+		const auto binB    = graph.AddNode([&](uint32_t) { binBStep    = step++; });
+		const auto raster  = graph.AddNode([&](uint32_t) { rasterStep  = step++; });
+		const auto resolve = graph.AddNode([&](uint32_t) { resolveStep = step++; });
+		graph.AddDependency(vertex, binA);
+		graph.AddDependency(vertex, binB);
+		graph.AddDependency(binA, raster);
+		graph.AddDependency(binB, raster);
+		graph.AddDependency(raster, resolve);
+
+		for (int run{0}; run < 50; ++run)
+		{
+			step = 0;
+			graph.Run(jobSystem);
+
+			ASSERT_EQ(step.load(), 5);
+			EXPECT_EQ(vertexStep, 0);
+			EXPECT_LT(vertexStep, binAStep);
+			EXPECT_LT(vertexStep, binBStep);
+			EXPECT_GT(rasterStep, binAStep);
+			EXPECT_GT(rasterStep, binBStep);
+			EXPECT_EQ(resolveStep, 4);
+		}
+	}
+
+	TEST(JobGraph, NodesCanUseParallelFor) {
+		JobSystem jobSystem{3};
+		JobGraph  graph{};
+
+		std::vector<int> values(4096, 0);
+		const auto fill = graph.AddNode([&](uint32_t)
+		{
+			jobSystem.ParallelFor(static_cast<uint32_t>(values.size()), 128, [&values](uint32_t begin, uint32_t end, uint32_t)
+			{
+				for (uint32_t idx{begin}; idx < end; ++idx) values[idx] = static_cast<int>(idx);
+			});
+		});
+		long long sum{0};
+		const auto reduce = graph.AddNode([&](uint32_t)
+		{
+			sum = 0;
+			for (const int value : values) sum += value;
+		});
+		graph.AddDependency(fill, reduce);
+
+		graph.Run(jobSystem);
+		EXPECT_EQ(sum, 4095LL * 4096LL / 2LL);
+	}
+
+}
@@ -0,0 +1,209 @@
+#include "gtest/gtest.h"
+#include "Maths.h"
+
+#include <vector>
+
+
+namespace dae
+{
+	namespace
+	{
+		// The scalar formulas the header-inline versions replaced
+		Matrix ReferenceMultiply(const Matrix& a, const Matrix& b)
+		{
+			Matrix result{};
+			for (int r{0}; r < 4; ++r)
+			{
+				for (int c{0}; c < 4; ++c)
+				{
+					result[r][c] = a[r].x * b[0][c] + a[r].y * b[1][c] + a[r].z * b[2][c] + a[r].w * b[3][c];
+				}
+			}
+			return result;
+		}
+
+		Vector4 ReferenceTransform(const Matrix& m, const Vector4& p)
+		{
+			Vector4 result{};
+			for (int c{0}; c < 4; ++c)
+			{
+				result[c] = m[0][c] * p.x + m[1][c] * p.y + m[2][c] * p.z + m[3][c] * p.w;
+			}
+			return result;
+		}
+
+		void ExpectNear(const Matrix& actual, const Matrix& expected, float tolerance)
+		{
+			for (int r{0}; r < 4; ++r)
+			{
+				for (int c{0}; c < 4; ++c)
+				{
+					EXPECT_NEAR(actual[r][c], expected[r][c], tolerance) << "row " << r << ", column " << c;
+				}
+			}
+		}
+
+		Matrix CreateWorld()
+		{
+			return Matrix::CreateScale(2.0f, 0.5f, 1.5f) * Matrix::CreateRotation(0.3f, -1.2f, 0.7f) * Matrix::CreateTranslation(4.0f, -2.0f, 10.0f);
+		}
+	}
+
+	TEST(Maths, VectorOperators) {
+		const Vector3 a{1.0f, 2.0f, 3.0f};
+		const Vector3 b{-4.0f, 0.5f, 2.0f};
+		EXPECT_EQ(a + b, Vector3(-3.0f, 2.5f, 5.0f));
+		EXPECT_EQ(a - b, Vector3(5.0f, 1.5f, 1.0f));
+		EXPECT_EQ(2.0f * a, a * 2.0f);
+		EXPECT_FLOAT_EQ(Vector3::Dot(a, b), 3.0f);
+		EXPECT_FLOAT_EQ(Vector3::Dot(Vector3::Cross(a, b), a), 0.0f);
+		EXPECT_FLOAT_EQ(b.Normalized().Magnitude(), 1.0f);
+		EXPECT_EQ(Vector3::Reflect({1.0f, -1.0f, 0.0f}, Vector3::UnitY), Vector3(1.0f, 1.0f, 0.0f));
+
+		EXPECT_EQ(a.ToPoint4(), Vector4(1.0f, 2.0f, 3.0f, 1.0f));
+		EXPECT_EQ(Vector4(a, 0.0f).GetXYZ(), a);
+		EXPECT_EQ(Vector3{a.ToVector4()}, a);
+		EXPECT_FLOAT_EQ(Vector2::Cross(a.GetXY(), b.GetXY()), 8.5f);
+	}
+
+	TEST(Maths, MatchesScalarFormulas) {
+		const Matrix world{CreateWorld()};
+		const Matrix projection{Matrix::CreatePerspectiveFovLH(0.8f, 4.0f / 3.0f, 0.1f, 100.0f)};
+
+		// Same operations in the same order: exact, not just close
+		const Matrix product{world * projection};
+		const Matrix reference{ReferenceMultiply(world, projection)};
+		for (int r{0}; r < 4; ++r)
+		{
+			for (int c{0}; c < 4; ++c)
+			{
+				EXPECT_EQ(product[r][c], reference[r][c]);
+			}
+		}
+
+		Matrix accumulated{world};
+		accumulated *= projection;
+		EXPECT_EQ(accumulated, product);
+
+		const Vector4 point{1.5f, -3.0f, 7.25f, 1.0f};
+		const Vector4 transformed{product.TransformPoint(point)};
+		const Vector4 expected{ReferenceTransform(product, point)};
+		EXPECT_EQ(transformed.x, expected.x);
+		EXPECT_EQ(transformed.y, expected.y);
+		EXPECT_EQ(transformed.z, expected.z);
+		EXPECT_EQ(transformed.w, expected.w);
+
+		EXPECT_EQ(world.TransformPoint(point.GetXYZ()), ReferenceTransform(world, point).GetXYZ());
+		EXPECT_EQ(world.TransformVector(point.GetXYZ()), ReferenceTransform(world, {point.x, point.y, point.z, 0.0f}).GetXYZ());
+	}
+
+	TEST(Maths, InverseAndTranspose) {
+		const Matrix world{CreateWorld()};
+		ExpectNear(world * Matrix::Inverse(world), Matrix{}, 1e-5f);
+
+		// Not affine: the last column is not (0, 0, 0, 1)
+		const Matrix projection{Matrix::CreatePerspectiveFovLH(0.8f, 4.0f / 3.0f, 0.1f, 100.0f)};
+		ExpectNear(projection * Matrix::Inverse(projection), Matrix{}, 1e-5f);
+		ExpectNear(Matrix::Inverse(world * projection) * (world * projection), Matrix{}, 1e-4f);
+
+		const Matrix transposed{Matrix::Transpose(world)};
+		for (int r{0}; r < 4; ++r)
+		{
+			for (int c{0}; c < 4; ++c)
+			{
+				EXPECT_EQ(transposed[r][c], world[c][r]);
+			}
+		}
+		EXPECT_EQ(Matrix::Transpose(transposed), world);
+	}
+
+	TEST(Maths, BatchedTransforms) {
+		struct Element
+		{
+			Vector3 position;
+			float padding;
+			Vector3 normal;
+		};
+
+		const Matrix world{CreateWorld()};
+		const Matrix worldProjection{world * Matrix::CreatePerspectiveFovLH(0.8f, 4.0f / 3.0f, 0.1f, 100.0f)};
+
+		// Not a multiple of four, the tail goes through the single-element path
+		constexpr size_t count{11};
+		std::vector<Element> elements(count);
+		std::vector<float> xs(count), ys(count), zs(count);
+		for (size_t idx{0}; idx < count; ++idx)
+		{
+			const float f{static_cast<float>(idx)};
+			elements[idx].position = {f * 0.5f - 2.0f, 1.0f - f * 0.25f, f * 1.5f + 1.0f};
+			elements[idx].normal = Vector3{f - 5.0f, 1.0f, -f}.Normalized();
+			xs[idx] = elements[idx].position.x;
+			ys[idx] = elements[idx].position.y;
+			zs[idx] = elements[idx].position.z;
+		}
+		const std::span<const Element> source{elements};
+
+		std::vector<Element> transformed(count);
+		const std::span<Element> destination{transformed};
+		world.TransformPoints({source, &Element::position}, {destination, &Element::position});
+		world.TransformVectors({source, &Element::normal}, {destination, &Element::normal});
+
+		std::vector<Vector4> clip(count);
+		worldProjection.TransformPointsToClip({source, &Element::position}, std::span{clip});
+
+		std::vector<float> outX(count), outY(count), outZ(count);
+		world.TransformPoints(xs, ys, zs, outX, outY, outZ);
+
+		// Same operations as the single-element versions: exact, not just close
+		for (size_t idx{0}; idx < count; ++idx)
+		{
+			const Vector3 point{world.TransformPoint(elements[idx].position)};
+			const Vector3 normal{world.TransformVector(elements[idx].normal)};
+			const Vector4 clipPoint{worldProjection.TransformPoint(elements[idx].position.ToPoint4())};
+			EXPECT_EQ(transformed[idx].position.x, point.x) << "element " << idx;
+			EXPECT_EQ(transformed[idx].position.y, point.y) << "element " << idx;
+			EXPECT_EQ(transformed[idx].position.z, point.z) << "element " << idx;
+			EXPECT_EQ(transformed[idx].normal.x, normal.x) << "element " << idx;
+			EXPECT_EQ(transformed[idx].normal.z, normal.z) << "element " << idx;
+			EXPECT_EQ(clip[idx].x, clipPoint.x) << "element " << idx;
+			EXPECT_EQ(clip[idx].w, clipPoint.w) << "element " << idx;
+			EXPECT_EQ(outX[idx], point.x) << "element " << idx;
+			EXPECT_EQ(outY[idx], point.y) << "element " << idx;
+			EXPECT_EQ(outZ[idx], point.z) << "element " << idx;
+		}
+
+		// In place leaves the neighbouring members alone
+		std::vector<Element> inPlace{elements};
+		const std::span<Element> inPlaceSpan{inPlace};
+		world.TransformVectors({inPlaceSpan, &Element::normal}, {inPlaceSpan, &Element::normal});
+		for (size_t idx{0}; idx < count; ++idx)
+		{
+			EXPECT_EQ(inPlace[idx].normal.y, transformed[idx].normal.y) << "element " << idx;
+			EXPECT_EQ(inPlace[idx].position.x, elements[idx].position.x) << "element " << idx;
+		}
+
+		world.TransformVectors(xs, ys, zs, xs, ys, zs);
+		EXPECT_EQ(xs[count - 1], world.TransformVector(elements[count - 1].position).x);
+	}
+
+	TEST(Maths, ConstantEvaluation) {
+		constexpr Matrix translation{Matrix::CreateTranslation(1.0f, 2.0f, 3.0f)};
+		constexpr Matrix scale{Matrix::CreateScale(2.0f, 2.0f, 2.0f)};
+		static_assert(translation.TransformPoint(Vector3::Zero) == Vector3{1.0f, 2.0f, 3.0f});
+		static_assert((scale * translation).TransformPoint(Vector3::UnitX) == Vector3{3.0f, 2.0f, 3.0f});
+		static_assert((scale * translation).TransformVector(Vector3::UnitX) == Vector3{2.0f, 0.0f, 0.0f});
+		static_assert(Matrix::Transpose(Matrix::Transpose(translation)) == translation);
+		static_assert(Vector3::Dot(Vector3::Cross(Vector3::UnitX, Vector3::UnitY), Vector3::UnitZ) == 1.0f);
+
+		constexpr ColorRGB shaded{colors::White * colors::Gray + colors::Dielectric};
+		static_assert(shaded.r == 0.5f + 0.04f);
+
+		// The series used at compile time against the library sin / cos at run time
+		constexpr Matrix rotation{Matrix::CreateRotation(0.3f, -1.2f, 0.7f)};
+		float pitch{0.3f}, yaw{-1.2f}, roll{0.7f};
+		ExpectNear(rotation, Matrix::CreateRotation(pitch, yaw, roll), 1e-6f);
+		constexpr Matrix halfTurn{Matrix::CreateRotationY(PI)};
+		EXPECT_NEAR(halfTurn[0][0], -1.0f, 1e-6f);
+		EXPECT_NEAR(halfTurn[0][2], 0.0f, 1e-6f);
+	}
+}
@@ -0,0 +1,176 @@
+#include "gtest/gtest.h"
+#include "PngImageLoader.h"
+#include "FrameBuffer.h"
+#include "FrameCapture.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+
+namespace dae
+{
+	namespace
+	{
+		// 5x5 RGBA, fixed Huffman codes, rows filtered with None, Sub, Up, Average and Paeth in turn
+		constexpr uint8_t s_FixedHuffmanPng[]{
+			0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+			0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x05, 0x08, 0x06, 0x00, 0x00, 0x00, 0x8D, 0x6F, 0x26,
+			0xE5, 0x00, 0x00, 0x00, 0x3C, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x63, 0x60, 0x60, 0x60, 0xF8,
+			0x6F, 0xC4, 0x20, 0xF2, 0x35, 0x85, 0x41, 0xE3, 0xF5, 0x34, 0x06, 0x9B, 0x87, 0x27, 0x18, 0x02,
+			0xAE, 0x33, 0x32, 0x18, 0x89, 0x80, 0x04, 0xBF, 0x21, 0x63, 0x26, 0xA0, 0x20, 0x03, 0x3A, 0x66,
+			0x66, 0x48, 0xD1, 0x68, 0x90, 0x94, 0x14, 0xF9, 0x8D, 0x8C, 0x59, 0xC0, 0xB2, 0x0C, 0xA8, 0x18,
+			0x00, 0x72, 0x2F, 0x15, 0x97, 0xB6, 0x2D, 0x13, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E,
+			0x44, 0xAE, 0x42, 0x60, 0x82,
+		};
+
+		bool WriteFile(const std::string& path, const std::vector<uint8_t>& data)
+		{
+			std::ofstream file(path, std::ios::binary);
+			file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+			return static_cast<bool>(file);
+		}
+
+		bool LoadBytes(const std::vector<uint8_t>& data, int& width, int& height, std::vector<uint32_t>& texels)
+		{
+			EXPECT_TRUE(WriteFile("PngImageLoaderTest.png", data));
+			const bool isLoaded{PngImageLoader{}.Load("PngImageLoaderTest.png", width, height, texels)};
+			std::remove("PngImageLoaderTest.png");
+			return isLoaded;
+		}
+	}
+
+	// FrameCapture writes RGB with stored deflate blocks, the loader has to give back the same pixels with full alpha
+	TEST(PngImageLoader, FrameCaptureRoundTrip) {
+		FrameBuffer frameBuffer{160, 150};
+		for (int y{0}; y < 150; ++y)
+		{
+			for (int x{0}; x < 160; ++x)
+			{
+				frameBuffer.GetColorBuffer()[x + y * 160] = FrameBuffer::PackColor(static_cast<uint8_t>(x * 7), static_cast<uint8_t>(y * 11), static_cast<uint8_t>(x + y));
+			}
+		}
+
+		FrameCapture::Settings settings{};
+		settings.format       = CaptureFormat::PNG;
+		settings.outputPrefix = "PngImageLoaderTest";
+		{
+			FrameCapture capture{160, 150, settings};
+			capture.Submit(frameBuffer);
+		}
+
+		int width{0};
+		int height{0};
+		std::vector<uint32_t> texels{};
+		ASSERT_TRUE(PngImageLoader{}.Load("PngImageLoaderTest_000001.png", width, height, texels));
+		std::remove("PngImageLoaderTest_000001.png");
+		ASSERT_EQ(width, 160);
+		ASSERT_EQ(height, 150);
+		for (size_t idx{0}; idx < texels.size(); ++idx)
+		{
+			ASSERT_EQ(texels[idx], frameBuffer.GetColorBuffer()[idx]) << idx;
+		}
+	}
+
+	// Every filter type, decoded through the fixed Huffman codes
+	TEST(PngImageLoader, FixedHuffmanAndFilters) {
+		const std::vector<uint8_t> png{std::begin(s_FixedHuffmanPng), std::end(s_FixedHuffmanPng)};
+
+		int width{0};
+		int height{0};
+		std::vector<uint32_t> texels{};
+		ASSERT_TRUE(LoadBytes(png, width, height, texels));
+		ASSERT_EQ(width, 5);
+		ASSERT_EQ(height, 5);
+		for (int y{0}; y < 5; ++y)
+		{
+			for (int x{0}; x < 5; ++x)
+			{
+				const uint32_t expected{FrameBuffer::PackColor(static_cast<uint8_t>(x * 50), static_cast<uint8_t>(y * 50), static_cast<uint8_t>((x + y) * 20), static_cast<uint8_t>(255 - x * 10))};
+				EXPECT_EQ(texels[x + y * 5], expected) << x << ", " << y;
+			}
+		}
+	}
+
+	// 32x16 gray, a single dynamic Huffman block
+	TEST(PngImageLoader, DynamicHuffmanGray) {
+		const std::vector<uint8_t> png{
+			0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+			0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x08, 0x00, 0x00, 0x00, 0x00, 0x52, 0x6B, 0x22,
+			0x85, 0x00, 0x00, 0x00, 0xA9, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0x05, 0xC1, 0x41, 0x01, 0xC0,
+			0x40, 0x0C, 0x04, 0x21, 0xA6, 0xFB, 0x38, 0xFF, 0xAE, 0x22, 0xAB, 0x00, 0x7B, 0xBD, 0x81, 0xBD,
+			0xDE, 0xC0, 0x5E, 0x6F, 0xA0, 0xBB, 0xD6, 0x5D, 0xEB, 0xAE, 0x75, 0xD7, 0xBA, 0x6B, 0xDD, 0xB5,
+			0x8E, 0x3E, 0x5F, 0x3C, 0xFA, 0x7C, 0xF1, 0xE8, 0xF3, 0xC5, 0x23, 0xA1, 0x50, 0x28, 0x14, 0x0A,
+			0x85, 0xB9, 0x52, 0x67, 0xAE, 0xD4, 0x99, 0x2B, 0x75, 0x26, 0x9B, 0x6C, 0xB2, 0xC9, 0x26, 0x9B,
+			0x6C, 0xC2, 0x95, 0x3A, 0x73, 0xA5, 0xCE, 0x5C, 0xA9, 0x33, 0xA7, 0x50, 0x28, 0x14, 0x0A, 0x85,
+			0xC2, 0xA3, 0xCF, 0x17, 0x8F, 0x3E, 0x5F, 0x3C, 0xFA, 0x7C, 0xA1, 0x75, 0xD7, 0xBA, 0x6B, 0xDD,
+			0xB5, 0xEE, 0x5A, 0x77, 0xAD, 0xBB, 0x06, 0x7B, 0xBD, 0x81, 0xBD, 0xDE, 0xC0, 0x5E, 0x6F, 0xA0,
+			0xBB, 0xD6, 0x5D, 0xEB, 0xAE, 0x75, 0xD7, 0xBA, 0x6B, 0xDD, 0xB5, 0x8E, 0x3E, 0x5F, 0x3C, 0xFA,
+			0x7C, 0xF1, 0xE8, 0xF3, 0xC5, 0x23, 0xA1, 0x50, 0x28, 0x14, 0x0A, 0x85, 0xB9, 0x52, 0x67, 0xAE,
+			0xD4, 0x99, 0x2B, 0x75, 0x26, 0x9B, 0x6C, 0xB2, 0xC9, 0x26, 0x9B, 0x6C, 0xF2, 0x03, 0x7A, 0x85,
+			0x2E, 0xA1, 0x58, 0x96, 0x3F, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42,
+			0x60, 0x82,
+		};
+		const uint8_t values[]{0, 0, 0, 0, 1, 1, 2, 3, 7, 200};
+
+		int width{0};
+		int height{0};
+		std::vector<uint32_t> texels{};
+		ASSERT_TRUE(LoadBytes(png, width, height, texels));
+		ASSERT_EQ(width, 32);
+		ASSERT_EQ(height, 16);
+		for (int y{0}; y < 16; ++y)
+		{
+			for (int x{0}; x < 32; ++x)
+			{
+				const uint8_t gray{values[(x * x * 3 + y * 5 + x * y) % 10]};
+				EXPECT_EQ(texels[x + y * 32], FrameBuffer::PackColor(gray, gray, gray)) << x << ", " << y;
+			}
+		}
+	}
+
+	// 4x2 palette image, only the first entry has a tRNS alpha
+	TEST(PngImageLoader, PaletteWithTransparency) {
+		const std::vector<uint8_t> png{
+			0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
+			0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x08, 0x03, 0x00, 0x00, 0x00, 0x48, 0x76, 0x8D,
+			0x51, 0x00, 0x00, 0x00, 0x09, 0x50, 0x4C, 0x54, 0x45, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+			0x00, 0xFF, 0x2D, 0x4A, 0xCD, 0x8A, 0x00, 0x00, 0x00, 0x01, 0x74, 0x52, 0x4E, 0x53, 0x80, 0xAD,
+			0x5E, 0x5B, 0x46, 0x00, 0x00, 0x00, 0x0F, 0x49, 0x44, 0x41, 0x54, 0x78, 0xDA, 0x63, 0x60, 0x60,
+			0x64, 0x62, 0x00, 0x61, 0x46, 0x00, 0x00, 0x2B, 0x00, 0x08, 0x2E, 0x51, 0x13, 0xFC, 0x00, 0x00,
+			0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,
+		};
+		const uint32_t palette[]{FrameBuffer::PackColor(255, 0, 0, 128), FrameBuffer::PackColor(0, 255, 0), FrameBuffer::PackColor(0, 0, 255)};
+
+		int width{0};
+		int height{0};
+		std::vector<uint32_t> texels{};
+		ASSERT_TRUE(LoadBytes(png, width, height, texels));
+		ASSERT_EQ(width, 4);
+		ASSERT_EQ(height, 2);
+		for (int y{0}; y < 2; ++y)
+		{
+			for (int x{0}; x < 4; ++x)
+			{
+				EXPECT_EQ(texels[x + y * 4], palette[(x + y) % 3]) << x << ", " << y;
+			}
+		}
+	}
+
+	// Failures leave the outputs alone
+	TEST(PngImageLoader, InvalidFiles) {
+		int width{-1};
+		int height{-1};
+		std::vector<uint32_t> texels{};
+		EXPECT_FALSE(PngImageLoader{}.Load("PngImageLoaderTest_missing.png", width, height, texels));
+		EXPECT_FALSE(LoadBytes({'n', 'o', 't', ' ', 'a', ' ', 'p', 'n', 'g'}, width, height, texels));
+
+		// Cut off in the middle of the IDAT chunk
+		EXPECT_FALSE(LoadBytes({std::begin(s_FixedHuffmanPng), std::begin(s_FixedHuffmanPng) + 60}, width, height, texels));
+		EXPECT_EQ(width, -1);
+		EXPECT_EQ(height, -1);
+		EXPECT_TRUE(texels.empty());
+	}
+}
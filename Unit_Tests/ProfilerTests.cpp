@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+#include "Profiler.h"
+
+#include <future>
+#include <sstream>
+#include <string>
+#include <thread>
+
+
+namespace dae
+{
+	namespace
+	{
+		const ProfileThread* FindThread(const ProfileFrame& frame, const std::string& name)
+		{
+			for (const ProfileThread& thread : frame.threads)
+			{
+				if (thread.name == name) return &thread;
+			}
+			return nullptr;
+		}
+	}
+
+	TEST(Profiler, NestedZonesKeepTheirDepth) {
+		Profiler& profiler{Profiler::Get()};
+		profiler.SetThreadName("Test main");
+		profiler.EndFrame();
+
+		{
+			const ProfileZone outer{"Outer"};
+			const ProfileZone inner{"Inner"};
+		}
+		profiler.EndFrame();
+
+		const ProfileThread* threadPtr{FindThread(profiler.GetLastFrame(), "Test main")};
+		ASSERT_NE(threadPtr, nullptr);
+		ASSERT_EQ(threadPtr->events.size(), 2u);
+		EXPECT_STREQ(threadPtr->events[0].name, "Outer");
+		EXPECT_EQ(threadPtr->events[0].depth, 0u);
+		EXPECT_STREQ(threadPtr->events[1].name, "Inner");
+		EXPECT_EQ(threadPtr->events[1].depth, 1u);
+		EXPECT_LE(threadPtr->events[0].startNs, threadPtr->events[1].startNs);
+		EXPECT_GE(threadPtr->events[0].endNs, threadPtr->events[1].endNs);
+	}
+
+	TEST(Profiler, EveryThreadGetsItsOwnLane) {
+		Profiler& profiler{Profiler::Get()};
+		profiler.EndFrame();
+
+		std::thread worker{[]
+		{
+			Profiler::Get().SetThreadName("Test worker");
+			const ProfileZone zone{"Work"};
+		}};
+		worker.join();
+		profiler.EndFrame();
+
+		const ProfileThread* threadPtr{FindThread(profiler.GetLastFrame(), "Test worker")};
+		ASSERT_NE(threadPtr, nullptr);
+		ASSERT_EQ(threadPtr->events.size(), 1u);
+		EXPECT_STREQ(threadPtr->events[0].name, "Work");
+	}
+
+	// A thread outside of the frames (e.g. the capture writer) may be inside a zone at the frame boundary
+	TEST(Profiler, OpenZoneOfAnotherThreadIsKept) {
+		Profiler& profiler{Profiler::Get()};
+		profiler.EndFrame();
+
+		std::promise<void> isInside{};
+		std::promise<void> mayLeave{};
+		std::thread worker{[&isInside, future = mayLeave.get_future()]
+		{
+			Profiler::Get().SetThreadName("Test writer");
+			const ProfileZone zone{"Write"};
+			isInside.set_value();
+			future.wait();
+		}};
+
+		isInside.get_future().wait();
+		profiler.EndFrame();
+		EXPECT_EQ(FindThread(profiler.GetLastFrame(), "Test writer"), nullptr);
+
+		mayLeave.set_value();
+		worker.join();
+		profiler.EndFrame();
+
+		const ProfileThread* threadPtr{FindThread(profiler.GetLastFrame(), "Test writer")};
+		ASSERT_NE(threadPtr, nullptr);
+		ASSERT_EQ(threadPtr->events.size(), 1u);
+		EXPECT_STREQ(threadPtr->events[0].name, "Write");
+		EXPECT_GE(threadPtr->events[0].endNs, threadPtr->events[0].startNs);
+	}
+
+	TEST(Profiler, CaptureWritesAChromeTrace) {
+		Profiler& profiler{Profiler::Get()};
+		profiler.SetThreadName("Test main");
+		profiler.EndFrame();
+
+		profiler.StartCapture(2);
+		for (int frame{0}; frame < 3; ++frame)
+		{
+			const bool isCapturing{profiler.IsCapturing()};
+			{
+				const ProfileZone zone{"Traced \"zone\""};
+			}
+			profiler.EndFrame();
+			EXPECT_EQ(isCapturing, frame < 2);
+		}
+		ASSERT_TRUE(profiler.HasCapture());
+		EXPECT_EQ(profiler.GetCapturedFrameCount(), 2u);
+
+		std::ostringstream stream{};
+		profiler.WriteChromeTrace(stream);
+		const std::string trace{stream.str()};
+		EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+		EXPECT_NE(trace.find("\"name\":\"Traced \\\"zone\\\"\",\"cat\":\"cpu\",\"ph\":\"X\""), std::string::npos);
+		EXPECT_NE(trace.find("\"args\":{\"frame\":1}"), std::string::npos);
+		EXPECT_EQ(trace.find("\"args\":{\"frame\":2}"), std::string::npos);
+		EXPECT_NE(trace.find("\"args\":{\"name\":\"Test main\"}"), std::string::npos);
+
+		profiler.ClearCapture();
+		EXPECT_FALSE(profiler.HasCapture());
+	}
+
+	TEST(Profiler, PauseKeepsTheLastFrame) {
+		Profiler& profiler{Profiler::Get()};
+		profiler.SetThreadName("Test main");
+		{
+			const ProfileZone zone{"Kept"};
+		}
+		profiler.EndFrame();
+
+		profiler.SetPaused(true);
+		{
+			const ProfileZone zone{"Hidden"};
+		}
+		profiler.EndFrame();
+		profiler.SetPaused(false);
+
+		const ProfileThread* threadPtr{FindThread(profiler.GetLastFrame(), "Test main")};
+		ASSERT_NE(threadPtr, nullptr);
+		ASSERT_EQ(threadPtr->events.size(), 1u);
+		EXPECT_STREQ(threadPtr->events[0].name, "Kept");
+	}
+}
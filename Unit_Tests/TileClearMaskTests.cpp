@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include "TileClearMask.h"
+
+
+namespace dae
+{
+	TEST(TileClearMask, PrepareFillsEachTileOnce) {
+		TileClearMask mask{32, 32};
+		mask.SetAll();
+
+		int fillCount{0};
+		const auto fill = [&fillCount](int, int, int, int) { ++fillCount; };
+
+		mask.Prepare(0, 0, 9, 3, fill);
+		EXPECT_EQ(fillCount, 2);
+		mask.Prepare(0, 0, 15, 15, fill);
+		EXPECT_EQ(fillCount, 4);
+		EXPECT_FALSE(mask.IsCleared(1, 1));
+		EXPECT_TRUE(mask.IsCleared(2, 0));
+	}
+
+	TEST(TileClearMask, ResolveVisitsOnlyUntouchedTiles) {
+		// 13 x 7 tiles: the tile count is not a multiple of 64 and the edge tiles are partial
+		TileClearMask mask{100, 50};
+		mask.SetAll();
+		mask.Prepare(0, 0, 7, 7, [](int, int, int, int) {});
+
+		int fillCount{0};
+		int pixelCount{0};
+		mask.ResolveRemaining([&](int beginX, int beginY, int endX, int endY)
+		{
+			++fillCount;
+			pixelCount += (endX - beginX) * (endY - beginY);
+		});
+		EXPECT_EQ(fillCount, 13 * 7 - 1);
+		EXPECT_EQ(pixelCount, 100 * 50 - 8 * 8);
+
+		// Everything is written now
+		mask.ResolveRemaining([&](int, int, int, int) { ++fillCount; });
+		EXPECT_EQ(fillCount, 13 * 7 - 1);
+	}
+
+	TEST(TileClearMask, SetRegionOnlyFlagsTheViewport) {
+		TileClearMask mask{64, 64};
+		mask.SetRegion(20, 9);
+
+		int fillCount{0};
+		mask.ResolveRemaining([&fillCount](int, int, int, int) { ++fillCount; });
+		EXPECT_EQ(fillCount, 3 * 2);
+	}
+}